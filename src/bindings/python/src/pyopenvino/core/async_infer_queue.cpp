@@ -12,6 +12,7 @@
 #include <mutex>
 #include <queue>
 #include <string>
+#include <utility>
 #include <vector>
 
 #include "pyopenvino/core/common.hpp"
@@ -21,6 +22,17 @@ namespace py = pybind11;
 
 class AsyncInferQueue {
 public:
+    // Defines how completed requests are handed back to Python.
+    enum class DispatchMode {
+        // Each completion acquires the GIL and runs the callback on the worker thread.
+        PER_REQUEST,
+        // Completions are queued without touching the GIL and callbacks are run in batches
+        // by the Python thread which calls any of flow control functions.
+        BATCHED,
+        // No callback is called, completed requests are collected with pull_completed().
+        PULL
+    };
+
     AsyncInferQueue(ov::CompiledModel& model, size_t jobs) {
         if (jobs == 0) {
             jobs = static_cast<size_t>(Common::get_optimal_number_of_requests(model));
@@ -28,6 +40,7 @@ public:
 
         m_requests.reserve(jobs);
         m_user_ids.reserve(jobs);
+        m_completed_handles.reserve(jobs);
 
         for (size_t handle = 0; handle < jobs; handle++) {
             // Create new "empty" InferRequestWrapper without pre-defined callback and
@@ -45,6 +58,9 @@ public:
     }
 
     bool _is_ready() {
+        if (m_mode == DispatchMode::BATCHED) {
+            dispatch_completed();
+        }
         // Check if any request has finished already
         py::gil_scoped_release release;
         // acquire the mutex to access m_errors and m_idle_handles
@@ -55,14 +71,33 @@ public:
     }
 
     size_t get_idle_request_id() {
+        if (m_mode == DispatchMode::BATCHED) {
+            {
+                py::gil_scoped_release release;
+                std::unique_lock<std::mutex> lock(m_mutex);
+                m_cv.wait(lock, [this] {
+                    return !(m_idle_handles.empty() && m_completed_handles.empty());
+                });
+            }
+            // Run callbacks of all requests finished so far under single GIL acquisition,
+            // this returns their handles to m_idle_handles
+            dispatch_completed();
+        }
         // Wait for any request to complete and return its id
         // release GIL to avoid deadlock on python callback
         py::gil_scoped_release release;
         // acquire the mutex to access m_errors and m_idle_handles
         std::unique_lock<std::mutex> lock(m_mutex);
         m_cv.wait(lock, [this] {
-            return !(m_idle_handles.empty());
+            // In PULL mode all handles may hold results which were not pulled yet,
+            // none of them can be released without user's action
+            return !(m_idle_handles.empty()) ||
+                   (m_mode == DispatchMode::PULL && m_completed_handles.size() == m_requests.size());
         });
+        if (m_idle_handles.empty()) {
+            OPENVINO_THROW("All InferRequests in AsyncInferQueue hold results which were not pulled yet. "
+                           "Call pull_completed() to release them.");
+        }
         size_t idle_handle = m_idle_handles.front();
         // wait for request to make sure it returned from callback
         m_requests[idle_handle].m_request.wait();
@@ -74,9 +109,14 @@ public:
     void wait_all() {
         // Wait for all request to complete
         // release GIL to avoid deadlock on python callback
-        py::gil_scoped_release release;
-        for (auto&& request : m_requests) {
-            request.m_request.wait();
+        {
+            py::gil_scoped_release release;
+            for (auto&& request : m_requests) {
+                request.m_request.wait();
+            }
+        }
+        if (m_mode == DispatchMode::BATCHED) {
+            dispatch_completed();
         }
         // acquire the mutex to access m_errors
         std::lock_guard<std::mutex> lock(m_mutex);
@@ -84,7 +124,90 @@ public:
             throw m_errors.front();
     }
 
+    // Runs batched callback for all requests completed so far. Must be called with GIL held.
+    void dispatch_completed() {
+        std::vector<size_t> completed;
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            if (m_completed_handles.empty()) {
+                return;
+            }
+            // Take the whole batch at once, worker threads can keep appending to the empty buffer
+            completed.swap(m_completed_handles);
+        }
+        for (auto handle : completed) {
+            try {
+                m_batched_callback(m_requests[handle], m_user_ids[handle]);
+            } catch (const py::error_already_set& py_error) {
+                assert(py_error.type());
+                // acquire the mutex to access m_errors
+                std::lock_guard<std::mutex> lock(m_mutex);
+                m_errors.push(py_error);
+            }
+        }
+        release_handles(completed);
+    }
+
+    // Returns ids and userdata of requests completed since the last call. Returned requests
+    // become idle, so their results should be read before scheduling new jobs.
+    std::vector<std::pair<size_t, py::object>> pull_completed(bool wait) {
+        if (m_mode != DispatchMode::PULL) {
+            OPENVINO_THROW("AsyncInferQueue is not in pull mode. Call set_pull_mode() first.");
+        }
+        std::vector<size_t> completed;
+        {
+            py::gil_scoped_release release;
+            std::unique_lock<std::mutex> lock(m_mutex);
+            if (wait) {
+                // Wait for at least one request unless nothing is running
+                m_cv.wait(lock, [this] {
+                    return !m_completed_handles.empty() ||
+                           m_idle_handles.size() + m_completed_handles.size() == m_requests.size();
+                });
+            }
+            completed.swap(m_completed_handles);
+        }
+        std::vector<std::pair<size_t, py::object>> results;
+        results.reserve(completed.size());
+        for (auto handle : completed) {
+            results.emplace_back(handle, m_user_ids[handle]);
+        }
+        release_handles(completed);
+        return results;
+    }
+
+    void release_handles(const std::vector<size_t>& handles) {
+        if (handles.empty()) {
+            return;
+        }
+        {
+            // acquire the mutex to access m_idle_handles
+            std::lock_guard<std::mutex> lock(m_mutex);
+            for (auto handle : handles) {
+                m_idle_handles.push(handle);
+            }
+        }
+        // Notify locks in getIdleRequestId()
+        m_cv.notify_all();
+    }
+
+    // Completions queued in the previous mode have to be handled before callbacks are replaced
+    void flush_completed() {
+        if (m_mode == DispatchMode::BATCHED) {
+            dispatch_completed();
+        } else {
+            std::vector<size_t> completed;
+            {
+                std::lock_guard<std::mutex> lock(m_mutex);
+                completed.swap(m_completed_handles);
+            }
+            release_handles(completed);
+        }
+    }
+
     void set_default_callbacks() {
+        flush_completed();
+        m_mode = DispatchMode::PER_REQUEST;
         for (size_t handle = 0; handle < m_requests.size(); handle++) {
             // auto end_time = m_requests[handle].m_end_time; // TODO: pass it bellow? like in InferRequestWrapper
 
@@ -110,7 +233,14 @@ public:
         }
     }
 
-    void set_custom_callbacks(py::function f_callback) {
+    void set_custom_callbacks(py::function f_callback, bool batched) {
+        if (batched) {
+            set_queued_callbacks(DispatchMode::BATCHED);
+            m_batched_callback = f_callback;
+            return;
+        }
+        flush_completed();
+        m_mode = DispatchMode::PER_REQUEST;
         for (size_t handle = 0; handle < m_requests.size(); handle++) {
             m_requests[handle].m_request.set_callback([this, f_callback, handle](std::exception_ptr exception_ptr) {
                 *m_requests[handle].m_end_time = Time::now();
@@ -151,10 +281,47 @@ public:
         }
     }
 
+    void set_pull_mode() {
+        set_queued_callbacks(DispatchMode::PULL);
+    }
+
+    // Callbacks for BATCHED and PULL modes never acquire the GIL, they only queue the handle
+    void set_queued_callbacks(DispatchMode mode) {
+        flush_completed();
+        m_mode = mode;
+        for (size_t handle = 0; handle < m_requests.size(); handle++) {
+            m_requests[handle].m_request.set_callback([this, handle](std::exception_ptr exception_ptr) {
+                *m_requests[handle].m_end_time = Time::now();
+                {
+                    std::lock_guard<std::mutex> lock(m_mutex);
+                    // Failed requests are not reported to Python code, same as in PER_REQUEST mode
+                    if (exception_ptr == nullptr) {
+                        m_completed_handles.push_back(handle);
+                    } else {
+                        m_idle_handles.push(handle);
+                    }
+                }
+                m_cv.notify_all();
+
+                try {
+                    if (exception_ptr) {
+                        std::rethrow_exception(exception_ptr);
+                    }
+                } catch (const std::exception& e) {
+                    OPENVINO_THROW(e.what());
+                }
+            });
+        }
+    }
+
     // AsyncInferQueue is the owner of all requests. When AsyncInferQueue is destroyed,
     // all of requests are destroyed as well.
     std::vector<InferRequestWrapper> m_requests;
     std::queue<size_t> m_idle_handles;
+    // Handles of requests which finished, but were not yet dispatched (BATCHED) or pulled (PULL)
+    std::vector<size_t> m_completed_handles;
+    DispatchMode m_mode = DispatchMode::PER_REQUEST;
+    py::function m_batched_callback;
     std::vector<py::object> m_user_ids;  // user ID can be any Python object
     std::mutex m_mutex;
     std::condition_variable m_cv;
@@ -300,6 +467,8 @@ void regclass_AsyncInferQueue(py::module m) {
 
     cls.def("set_callback",
             &AsyncInferQueue::set_custom_callbacks,
+            py::arg("callback"),
+            py::arg("batched") = false,
             R"(
             Sets unified callback on all InferRequests from queue's pool.
             Signature of such function should have two arguments, where
@@ -314,8 +483,57 @@ void regclass_AsyncInferQueue(py::module m) {
 
                 async_infer_queue.set_callback(f)
 
+            When `batched` is set to True, finished requests do not acquire the GIL
+            one by one. Instead, callbacks of all requests finished so far are called
+            together from the Python thread that calls `start_async`, `is_ready`,
+            `get_idle_request_id` or `wait_all`. It reduces GIL contention
+            when many requests are finished per second.
+
             :param callback: Any Python defined function that matches callback's requirements.
             :type callback: function
+            :param batched: Enables batched dispatching of callbacks. Default: False
+            :type batched: bool
+        )");
+
+    cls.def("set_pull_mode",
+            &AsyncInferQueue::set_pull_mode,
+            R"(
+            Switches AsyncInferQueue to mode without callbacks. Finished requests
+            are kept aside and their results have to be collected with `pull_completed`
+            before the request can be reused. When all requests hold results which
+            were not pulled yet, `start_async` raises an error, so the results are
+            pulled before a new job is scheduled.
+
+            .. code-block:: python
+
+                async_infer_queue.set_pull_mode()
+                for data, userdata in dataset:
+                    # waits for a finished request if all of them are busy
+                    completed = async_infer_queue.pull_completed(wait=not async_infer_queue.is_ready())
+                    for request_id, request_userdata in completed:
+                        process(async_infer_queue[request_id].results, request_userdata)
+                    async_infer_queue.start_async(data, userdata)
+                async_infer_queue.wait_all()
+                for request_id, request_userdata in async_infer_queue.pull_completed(wait=False):
+                    process(async_infer_queue[request_id].results, request_userdata)
+        )");
+
+    cls.def("pull_completed",
+            &AsyncInferQueue::pull_completed,
+            py::arg("wait") = true,
+            R"(
+            Returns all requests which finished since the previous call.
+            Available only in pull mode, see `set_pull_mode`.
+            Returned requests become idle, their results should be read
+            before new jobs are scheduled.
+
+            GIL is released while running this function.
+
+            :param wait: If True, waits until at least one request is finished
+                         or there are no running requests. Default: True
+            :type wait: bool
+            :return: List of pairs of InferRequest id and its userdata.
+            :rtype: List[Tuple[int, Any]]
         )");
 
     cls.def(
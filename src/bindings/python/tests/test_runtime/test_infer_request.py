@@ -496,6 +496,101 @@ def test_infer_queue(device, shared_flag):
     assert all(job["latency"] > 0 for job in jobs_done)
 
 
+def test_infer_queue_batched_callback(device):
+    jobs = 8
+    num_request = 4
+    core = Core()
+    model = core.read_model(test_net_xml, test_net_bin)
+    compiled_model = core.compile_model(model, device)
+    infer_queue = AsyncInferQueue(compiled_model, num_request)
+    jobs_done = [{"finished": False, "latency": 0} for _ in range(jobs)]
+
+    def callback(request, job_id):
+        jobs_done[job_id]["finished"] = True
+        jobs_done[job_id]["latency"] = request.latency
+
+    img = generate_image()
+    infer_queue.set_callback(callback, batched=True)
+    assert infer_queue.is_ready()
+
+    for i in range(jobs):
+        infer_queue.start_async({"data": img}, i)
+    infer_queue.wait_all()
+    assert all(job["finished"] for job in jobs_done)
+    assert all(job["latency"] > 0 for job in jobs_done)
+
+
+def test_infer_queue_pull_mode(device):
+    jobs = 8
+    num_request = 4
+    param = ops.parameter([10], np.float32)
+    model = Model(ops.relu(param), [param])
+    core = Core()
+    compiled_model = core.compile_model(model, device)
+    infer_queue = AsyncInferQueue(compiled_model, num_request)
+    infer_queue.set_pull_mode()
+
+    results = {}
+
+    def collect(completed):
+        for request_id, job_id in completed:
+            results[job_id] = infer_queue[request_id].get_output_tensor().data.copy()
+
+    for i in range(jobs):
+        while not infer_queue.is_ready():
+            collect(infer_queue.pull_completed())
+        infer_queue.start_async({0: np.full([10], i - 4, dtype=np.float32)}, i)
+    infer_queue.wait_all()
+    collect(infer_queue.pull_completed(wait=False))
+
+    assert infer_queue.pull_completed() == []
+    assert sorted(results.keys()) == list(range(jobs))
+    for job_id, result in results.items():
+        assert np.array_equal(result, np.full([10], max(job_id - 4, 0), dtype=np.float32))
+
+
+def test_infer_queue_pull_mode_documented_loop(device):
+    # the loop of the set_pull_mode docstring, the dataset is bigger than the queue
+    param = ops.parameter([10], np.float32)
+    model = Model(ops.relu(param), [param])
+    core = Core()
+    compiled_model = core.compile_model(model, device)
+    async_infer_queue = AsyncInferQueue(compiled_model, 2)
+    dataset = [({0: np.full([10], i - 8, dtype=np.float32)}, i) for i in range(16)]
+
+    results = {}
+
+    def process(request_results, userdata):
+        results[userdata] = request_results[0].copy()
+
+    async_infer_queue.set_pull_mode()
+    for data, userdata in dataset:
+        # waits for a finished request if all of them are busy
+        completed = async_infer_queue.pull_completed(wait=not async_infer_queue.is_ready())
+        for request_id, request_userdata in completed:
+            process(async_infer_queue[request_id].results, request_userdata)
+        async_infer_queue.start_async(data, userdata)
+    async_infer_queue.wait_all()
+    for request_id, request_userdata in async_infer_queue.pull_completed(wait=False):
+        process(async_infer_queue[request_id].results, request_userdata)
+
+    assert sorted(results.keys()) == list(range(len(dataset)))
+    for job_id, result in results.items():
+        assert np.array_equal(result, np.full([10], max(job_id - 8, 0), dtype=np.float32))
+
+
+def test_infer_queue_pull_mode_not_enabled(device):
+    param = ops.parameter([10])
+    model = Model(ops.relu(param), [param])
+    core = Core()
+    compiled_model = core.compile_model(model, device)
+    infer_queue = AsyncInferQueue(compiled_model, 1)
+
+    with pytest.raises(RuntimeError) as e:
+        infer_queue.pull_completed()
+    assert "is not in pull mode" in str(e.value)
+
+
 def test_infer_queue_iteration(device):
     core = Core()
     param = ops.parameter([10])
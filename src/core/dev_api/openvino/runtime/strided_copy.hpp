@@ -0,0 +1,47 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include "openvino/core/core_visibility.hpp"
+#include "openvino/core/shape.hpp"
+#include "openvino/core/strides.hpp"
+#include "openvino/core/type/element_type.hpp"
+
+namespace ov {
+namespace util {
+
+/**
+ * @brief Checks whether strided_copy can convert the elements of src_type into dst_type.
+ *
+ * The same types are always supported, the conversion is supported between f32, f16, bf16 and u8.
+ * Types with bitwidth less than 8 are not supported, as they have no strides.
+ */
+OPENVINO_API bool is_strided_copy_supported(const element::Type& src_type, const element::Type& dst_type);
+
+/**
+ * @brief Copies the elements between the buffers with arbitrary byte strides, e.g. ROI of a bigger tensor,
+ * and optionally converts their precision.
+ *
+ * The dimensions, which are contiguous in both buffers, are coalesced, so the dense tensors are copied by a
+ * single memcpy or conversion call. The outer dimensions are split between the threads for the big tensors.
+ *
+ * @param src         Pointer to the first source element.
+ * @param src_type    Source element type.
+ * @param src_strides Source byte strides, empty for the dense layout.
+ * @param dst         Pointer to the first destination element.
+ * @param dst_type    Destination element type.
+ * @param dst_strides Destination byte strides, empty for the dense layout.
+ * @param shape       Shape of the copied region.
+ */
+OPENVINO_API void strided_copy(const void* src,
+                               const element::Type& src_type,
+                               const Strides& src_strides,
+                               void* dst,
+                               const element::Type& dst_type,
+                               const Strides& dst_strides,
+                               const Shape& shape);
+
+}  // namespace util
+}  // namespace ov
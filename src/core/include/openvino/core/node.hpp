@@ -115,14 +115,14 @@ class NodeAccessor;
  * @ingroup ov_model_cpp_api
  */
 class OPENVINO_API Node : public std::enable_shared_from_this<Node> {
-    // For access to m_outputs.
+    // For access to the outputs of m_ports.
     friend class descriptor::Input;
 
-    // For access to m_inputs and m_outputs.
+    // For access to the inputs and the outputs of m_ports.
     template <typename NodeType>
     friend class Input;
 
-    // For access to m_outputs.
+    // For access to the outputs of m_ports.
     template <typename NodeType>
     friend class Output;
 
@@ -468,8 +468,17 @@ private:
     mutable std::string m_unique_name;
     mutable std::atomic_bool m_name_changing{false};
     static std::atomic<size_t> m_next_instance_id;
-    std::deque<descriptor::Input> m_inputs;
-    std::deque<descriptor::Output> m_outputs;
+    // The input and output descriptors are stored out of the class layout, so their storage can change
+    // without changing the ABI of Node. The padding keeps the size and the member offsets of the layout
+    // which stored the descriptors in two std::deque members.
+    struct Ports;
+    struct PortsStorage {
+        Ports* operator->() const {
+            return ports.get();
+        }
+        std::unique_ptr<Ports> ports;
+        char padding[2 * sizeof(std::deque<size_t>) - sizeof(std::unique_ptr<Ports>)];
+    } m_ports;
     RTMap m_rt_info;
 
     // The vector of SharedRTInfo attributes associated to Functions
@@ -178,7 +178,10 @@ public:
     const Shape& get_shape() const;
 
     /**
-     * @brief Copy tensor, destination tensor should have the same element type and shape
+     * @brief Copy tensor, destination tensor should have the same shape
+     *
+     * Tensors with arbitrary strides (e.g. ROI tensors) are supported, big tensors are copied by several threads.
+     * Element types may differ if the precision conversion is supported: between f32, f16, bf16 and u8.
      *
      * @param dst destination tensor
      */
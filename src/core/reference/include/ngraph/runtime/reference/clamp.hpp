@@ -7,20 +7,24 @@
 #include <cmath>
 #include <cstddef>
 
+#include "ngraph/runtime/reference/utils/parallel.hpp"
+
 namespace ngraph {
 namespace runtime {
 namespace reference {
 template <typename T>
 void clamp(const T* arg, T* out, T min, T max, size_t count) {
-    for (size_t i = 0; i < count; i++) {
-        if (arg[i] < min) {
-            out[i] = min;
-        } else if (arg[i] > max) {
-            out[i] = max;
-        } else {
-            out[i] = arg[i];
+    parallel_chunks(count, parallel_min_chunk_size, [&](size_t start, size_t end) {
+        for (size_t i = start; i < end; i++) {
+            if (arg[i] < min) {
+                out[i] = min;
+            } else if (arg[i] > max) {
+                out[i] = max;
+            } else {
+                out[i] = arg[i];
+            }
         }
-    }
+    });
 }
 }  // namespace reference
 }  // namespace runtime
@@ -8,6 +8,7 @@
 #include <cstddef>
 #include <type_traits>
 
+#include "ngraph/runtime/reference/utils/parallel.hpp"
 #include "ngraph/type/bfloat16.hpp"
 #include "ngraph/type/float16.hpp"
 
@@ -16,16 +17,20 @@ namespace runtime {
 namespace reference {
 template <typename T, typename std::enable_if<!std::is_integral<T>::value, bool>::type = true>
 void erf(const T* arg, T* out, size_t count) {
-    for (size_t i = 0; i < count; i++) {
-        out[i] = static_cast<T>(std::erf(arg[i]));
-    }
+    parallel_chunks(count, parallel_min_chunk_size, [&](size_t start, size_t end) {
+        for (size_t i = start; i < end; i++) {
+            out[i] = static_cast<T>(std::erf(arg[i]));
+        }
+    });
 }
 
 template <typename T, typename std::enable_if<std::is_integral<T>::value, bool>::type = true>
 void erf(const T* arg, T* out, size_t count) {
-    for (size_t i = 0; i < count; i++) {
-        out[i] = static_cast<T>(std::round(std::erf(arg[i])));
-    }
+    parallel_chunks(count, parallel_min_chunk_size, [&](size_t start, size_t end) {
+        for (size_t i = start; i < end; i++) {
+            out[i] = static_cast<T>(std::round(std::erf(arg[i])));
+        }
+    });
 }
 }  // namespace reference
 }  // namespace runtime
@@ -7,14 +7,18 @@
 #include <cmath>
 #include <cstddef>
 
+#include "ngraph/runtime/reference/utils/parallel.hpp"
+
 namespace ngraph {
 namespace runtime {
 namespace reference {
 template <typename T>
 void exp(const T* arg, T* out, size_t count) {
-    for (size_t i = 0; i < count; i++) {
-        out[i] = static_cast<T>(std::exp(arg[i]));
-    }
+    parallel_chunks(count, parallel_min_chunk_size, [&](size_t start, size_t end) {
+        for (size_t i = start; i < end; i++) {
+            out[i] = static_cast<T>(std::exp(arg[i]));
+        }
+    });
 }
 }  // namespace reference
 }  // namespace runtime
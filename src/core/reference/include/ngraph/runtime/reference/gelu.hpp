@@ -8,22 +8,28 @@
 #include <cstddef>
 #include <ngraph/op/gelu.hpp>
 
+#include "ngraph/runtime/reference/utils/parallel.hpp"
+
 namespace ngraph {
 namespace runtime {
 namespace reference {
 template <typename T>
 void gelu(const T* arg, T* out, op::GeluApproximationMode mode, size_t count) {
     if (mode == op::GeluApproximationMode::ERF) {
-        for (size_t i = 0; i < count; i++) {
-            out[i] = static_cast<T>((0.5 * arg[i] * (1 + erf(arg[i] / std::sqrt(2.0)))));
-        }
+        parallel_chunks(count, parallel_min_chunk_size, [&](size_t start, size_t end) {
+            for (size_t i = start; i < end; i++) {
+                out[i] = static_cast<T>((0.5 * arg[i] * (1 + std::erf(arg[i] / std::sqrt(2.0)))));
+            }
+        });
     } else if (mode == op::GeluApproximationMode::TANH) {
         const auto pi = atan(1.0) * 4.0;
         const auto sqpi = std::sqrt(2.0 / pi);
-        for (size_t i = 0; i < count; i++) {
-            auto& x = arg[i];
-            out[i] = static_cast<T>(0.5 * x * (1.0 + std::tanh(sqpi * (x + 0.044715 * std::pow(x, 3)))));
-        }
+        parallel_chunks(count, parallel_min_chunk_size, [&](size_t start, size_t end) {
+            for (size_t i = start; i < end; i++) {
+                auto& x = arg[i];
+                out[i] = static_cast<T>(0.5 * x * (1.0 + std::tanh(sqpi * (x + 0.044715 * std::pow(x, 3)))));
+            }
+        });
     }
 }
 }  // namespace reference
@@ -4,6 +4,7 @@
 
 #pragma once
 
+#include <algorithm>
 #include <cmath>
 #include <numeric>
 #include <utility>
@@ -11,42 +12,63 @@
 
 #include "ngraph/runtime/opt_kernel/reshape.hpp"
 #include "ngraph/runtime/reference/broadcast.hpp"
+#include "ngraph/runtime/reference/utils/parallel.hpp"
 #include "ngraph/shape_util.hpp"
 
 namespace ngraph {
 namespace runtime {
 namespace reference {
 namespace details {
-template <typename T>
-void dot(const T* arg0,
-         const T* arg1,
-         T* out,
-         const Shape& arg0_shape,
-         const Shape& arg1_shape,
-         const Shape& out_shape) {
-    std::fill(out, out + shape_size(out_shape), T{0});
+// 2D inputs shapes are interpreted as {I, K} x {K, J}
+// If first input is 1D tensor of shape {K}, it is interpreted as {1, K}
+// If second input is 1D tensor of shape {K}, it is interpreted as {K, 1}
+inline void get_dot_dims(const Shape& arg0_shape,
+                         const Shape& arg1_shape,
+                         size_t& I_dim,
+                         size_t& J_dim,
+                         size_t& K_dim) {
     const size_t arg0_rank = arg0_shape.size();
     const size_t arg1_rank = arg1_shape.size();
+    I_dim = arg0_rank == 1 ? 1 : arg0_shape[arg0_rank - 2];
+    J_dim = arg1_rank == 1 ? 1 : arg1_shape[arg1_rank - 1];
+    K_dim = arg1_rank == 1 ? arg1_shape[arg1_rank - 1] : arg1_shape[arg1_rank - 2];
+}
 
-    // 2D inputs shapes are interpreted as {I, K} x {K, J}
-    // If first input is 1D tensor of shape {K}, it is interpreted as {1, K}
-    // If second input is 1D tensor of shape {K}, it is interpreted as {K, 1}
-    const size_t I_dim = arg0_rank == 1 ? 1 : arg0_shape[arg0_rank - 2];
-    const size_t J_dim = arg1_rank == 1 ? 1 : arg1_shape[arg1_rank - 1];
-    const size_t K_dim = arg1_rank == 1 ? arg1_shape[arg1_rank - 1] : arg1_shape[arg1_rank - 2];
-
-    for (size_t i = 0; i < I_dim; ++i) {
+// Computes rows [I_begin, I_end) of the {I, K} x {K, J} product. The innermost loop runs over
+// contiguous J elements of arg1 and out, so it can be vectorized by compiler.
+template <typename T>
+void dot_rows(const T* arg0,
+              const T* arg1,
+              T* out,
+              const size_t I_begin,
+              const size_t I_end,
+              const size_t J_dim,
+              const size_t K_dim) {
+    std::fill(out + I_begin * J_dim, out + I_end * J_dim, T{0});
+    for (size_t i = I_begin; i < I_end; ++i) {
+        T* out_row = out + i * J_dim;
         for (size_t k = 0; k < K_dim; ++k) {
-            const size_t a_idx = i * K_dim + k;
+            const T a = arg0[i * K_dim + k];
+            const T* arg1_row = arg1 + k * J_dim;
             for (size_t j = 0; j < J_dim; ++j) {
-                const size_t b_idx = k * J_dim + j;
-                const size_t out_idx = i * J_dim + j;
-                out[out_idx] += arg0[a_idx] * arg1[b_idx];
+                out_row[j] += a * arg1_row[j];
             }
         }
     }
 }
 
+template <typename T>
+void dot(const T* arg0,
+         const T* arg1,
+         T* out,
+         const Shape& arg0_shape,
+         const Shape& arg1_shape,
+         const Shape& out_shape) {
+    size_t I_dim, J_dim, K_dim;
+    get_dot_dims(arg0_shape, arg1_shape, I_dim, J_dim, K_dim);
+    dot_rows(arg0, arg1, out, 0, I_dim, J_dim, K_dim);
+}
+
 std::vector<size_t> get_transpose_order(const Shape& input_shape);
 }  // namespace details
 /// \brief Reference kernel for matmul computation.
@@ -128,7 +150,14 @@ void matmul(const T* arg0,
 
     // Inputs are 2D and below, perform dot directly
     if (arg0_rank <= 2 && arg1_rank <= 2) {
-        details::dot(arg0_data, arg1_data, out, arg0_shape_tmp, arg1_shape_tmp, out_shape);
+        size_t I_dim, J_dim, K_dim;
+        details::get_dot_dims(arg0_shape_tmp, arg1_shape_tmp, I_dim, J_dim, K_dim);
+        // Rows of the output are independent, accumulation order of each element is kept
+        parallel_chunks(I_dim,
+                        std::max<size_t>(parallel_min_chunk_size / std::max<size_t>(J_dim * K_dim, 1), 1),
+                        [&](size_t start, size_t end) {
+                            details::dot_rows(arg0_data, arg1_data, out, start, end, J_dim, K_dim);
+                        });
         return;
     }
 
@@ -208,14 +237,26 @@ void matmul(const T* arg0,
     const size_t arg0_offset = (arg0_rank > 2) ? shape_size(dot_arg0_shape) : 0;
     const size_t arg1_offset = (arg1_rank > 2) ? shape_size(dot_arg1_shape) : 0;
     const size_t output_offset = shape_size(dot_output_shape);
-    for (size_t i = 0; i < output_batch_size; i++) {
-        details::dot(arg0_data + i * arg0_offset,
-                     arg1_data + i * arg1_offset,
-                     out + i * output_offset,
-                     dot_arg0_shape,
-                     dot_arg1_shape,
-                     dot_output_shape);
-    }
+    size_t I_dim, J_dim, K_dim;
+    details::get_dot_dims(dot_arg0_shape, dot_arg1_shape, I_dim, J_dim, K_dim);
+    // Work is split by rows of all batches, accumulation order of each output element is kept
+    parallel_chunks(output_batch_size * I_dim,
+                    std::max<size_t>(parallel_min_chunk_size / std::max<size_t>(J_dim * K_dim, 1), 1),
+                    [&](size_t start, size_t end) {
+                        for (size_t row = start; row < end;) {
+                            const size_t batch = row / I_dim;
+                            const size_t I_begin = row % I_dim;
+                            const size_t I_end = std::min(I_dim, I_begin + (end - row));
+                            details::dot_rows(arg0_data + batch * arg0_offset,
+                                              arg1_data + batch * arg1_offset,
+                                              out + batch * output_offset,
+                                              I_begin,
+                                              I_end,
+                                              J_dim,
+                                              K_dim);
+                            row += I_end - I_begin;
+                        }
+                    });
 }
 }  // namespace reference
 }  // namespace runtime
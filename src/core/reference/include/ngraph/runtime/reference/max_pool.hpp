@@ -4,10 +4,12 @@
 
 #pragma once
 
+#include <algorithm>
 #include <cmath>
 #include <numeric>
 
 #include "ngraph/coordinate_transform.hpp"
+#include "ngraph/runtime/reference/utils/parallel.hpp"
 
 namespace ngraph {
 namespace runtime {
@@ -341,10 +343,16 @@ void max_pool(const Values_t* data,
     const auto out_batch_elems = shape_size(std::begin(out_shape) + 1, std::end(out_shape));
     const auto out_channel_elems = shape_size(std::begin(out_shape) + 2, std::end(out_shape));
 
-    for (size_t b = 0; b < data_shape[0]; ++b) {
-        const Indices_t batch_indices_offset = static_cast<Indices_t>(b * data_batch_elems);
-
-        for (size_t c = 0; c < data_shape[1]; ++c) {
+    // Channels are processed independently, so they are split between threads
+    const size_t channels = data_shape[1];
+    const size_t work_amount = data_shape[0] * channels;
+    const size_t min_channels_per_thread =
+        std::max<size_t>(parallel_min_chunk_size / std::max<size_t>(shape_size(kernel) * out_channel_elems, 1), 1);
+    parallel_chunks(work_amount, min_channels_per_thread, [&](size_t start, size_t end) {
+        for (size_t work = start; work < end; ++work) {
+            const size_t b = work / channels;
+            const size_t c = work % channels;
+            const Indices_t batch_indices_offset = static_cast<Indices_t>(b * data_batch_elems);
             // calculate the buffer offsets for a given channel "c" then execute an appropriate
             // kernel for each processed channel
             const Values_t* data_channel_first_elem = data + b * data_batch_elems + c * data_channel_elems;
@@ -397,7 +405,7 @@ void max_pool(const Values_t* data,
                              " passed to the MaxPool reference implementation. Supported shapes: 3D, 4D and 5D.");
             }
         }
-    }
+    });
 
     // adjust the calculated indices to the requested range (specified by the axis attribute) if needed
     if (axis != 0) {
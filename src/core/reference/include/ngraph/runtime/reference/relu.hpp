@@ -6,15 +6,19 @@
 
 #include <cstddef>
 
+#include "ngraph/runtime/reference/utils/parallel.hpp"
+
 namespace ngraph {
 namespace runtime {
 namespace reference {
 template <typename T>
 void relu(const T* arg, T* out, size_t count) {
     T zero = 0;
-    for (size_t i = 0; i < count; i++) {
-        out[i] = arg[i] > zero ? arg[i] : zero;
-    }
+    parallel_chunks(count, parallel_min_chunk_size, [&](size_t start, size_t end) {
+        for (size_t i = start; i < end; i++) {
+            out[i] = arg[i] > zero ? arg[i] : zero;
+        }
+    });
 }
 }  // namespace reference
 }  // namespace runtime
@@ -8,25 +8,29 @@
 #include <cstddef>
 #include <type_traits>
 
+#include "ngraph/runtime/reference/utils/parallel.hpp"
+
 namespace ngraph {
 namespace runtime {
 namespace reference {
 template <typename T, typename std::enable_if<std::is_integral<T>::value, bool>::type = true>
 void sigmoid(const T* arg, T* out, size_t count) {
-    T exp_value;
-    for (size_t i = 0; i < count; i++) {
-        exp_value = static_cast<T>(std::exp(-static_cast<typename std::make_signed<T>::type>(arg[i])));
-        out[i] = static_cast<T>(1 / (1 + exp_value));
-    }
+    parallel_chunks(count, parallel_min_chunk_size, [&](size_t start, size_t end) {
+        for (size_t i = start; i < end; i++) {
+            const auto exp_value = static_cast<T>(std::exp(-static_cast<typename std::make_signed<T>::type>(arg[i])));
+            out[i] = static_cast<T>(1 / (1 + exp_value));
+        }
+    });
 }
 
 template <typename T, typename std::enable_if<!std::is_integral<T>::value, bool>::type = true>
 void sigmoid(const T* arg, T* out, size_t count) {
-    T exp_value;
-    for (size_t i = 0; i < count; i++) {
-        exp_value = static_cast<T>(std::exp(-arg[i]));
-        out[i] = static_cast<T>(1 / (1 + exp_value));
-    }
+    parallel_chunks(count, parallel_min_chunk_size, [&](size_t start, size_t end) {
+        for (size_t i = start; i < end; i++) {
+            const auto exp_value = static_cast<T>(std::exp(-arg[i]));
+            out[i] = static_cast<T>(1 / (1 + exp_value));
+        }
+    });
 }
 }  // namespace reference
 }  // namespace runtime
@@ -7,6 +7,8 @@
 #include <cmath>
 #include <cstddef>
 
+#include "ngraph/runtime/reference/utils/parallel.hpp"
+
 namespace ngraph {
 namespace runtime {
 namespace reference {
@@ -14,9 +16,11 @@ template <typename T>
 void softplus(const T* arg, T* out, size_t count) {
     const T threshold = static_cast<T>(std::log(std::numeric_limits<T>::max()));
 
-    for (size_t i = 0; i < count; i++) {
-        out[i] = (arg[i] < threshold) ? static_cast<T>(std::log(std::exp(arg[i]) + 1)) : arg[i];
-    }
+    parallel_chunks(count, parallel_min_chunk_size, [&](size_t start, size_t end) {
+        for (size_t i = start; i < end; i++) {
+            out[i] = (arg[i] < threshold) ? static_cast<T>(std::log(std::exp(arg[i]) + 1)) : arg[i];
+        }
+    });
 }
 }  // namespace reference
 }  // namespace runtime
@@ -8,20 +8,26 @@
 #include <cstddef>
 #include <type_traits>
 
+#include "ngraph/runtime/reference/utils/parallel.hpp"
+
 namespace ngraph {
 namespace runtime {
 namespace reference {
 template <typename T>
 typename std::enable_if<!std::is_integral<T>::value>::type sqrt(const T* arg, T* out, size_t count) {
-    for (size_t i = 0; i < count; i++) {
-        out[i] = std::sqrt(arg[i]);
-    }
+    parallel_chunks(count, parallel_min_chunk_size, [&](size_t start, size_t end) {
+        for (size_t i = start; i < end; i++) {
+            out[i] = std::sqrt(arg[i]);
+        }
+    });
 }
 template <typename T>
 typename std::enable_if<std::is_integral<T>::value>::type sqrt(const T* arg, T* out, size_t count) {
-    for (size_t i = 0; i < count; i++) {
-        out[i] = static_cast<T>(std::round(std::sqrt(arg[i])));
-    }
+    parallel_chunks(count, parallel_min_chunk_size, [&](size_t start, size_t end) {
+        for (size_t i = start; i < end; i++) {
+            out[i] = static_cast<T>(std::round(std::sqrt(arg[i])));
+        }
+    });
 }
 }  // namespace reference
 }  // namespace runtime
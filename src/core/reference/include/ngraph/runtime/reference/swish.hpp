@@ -7,6 +7,8 @@
 #include <cmath>
 #include <cstddef>
 
+#include "ngraph/runtime/reference/utils/parallel.hpp"
+
 namespace ngraph {
 namespace runtime {
 namespace reference {
@@ -16,9 +18,11 @@ void swish(const T* arg, const T* beta, T* out, size_t count) {
     if (beta != nullptr) {
         beta_value = beta[0];
     }
-    for (size_t i = 0; i < count; i++) {
-        out[i] = static_cast<T>(arg[i] / (1.0 + std::exp(-arg[i] * beta_value)));
-    }
+    parallel_chunks(count, parallel_min_chunk_size, [&](size_t start, size_t end) {
+        for (size_t i = start; i < end; i++) {
+            out[i] = static_cast<T>(arg[i] / (1.0 + std::exp(-arg[i] * beta_value)));
+        }
+    });
 }
 }  // namespace reference
 }  // namespace runtime
@@ -0,0 +1,63 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <cstddef>
+#include <functional>
+
+namespace ngraph {
+namespace runtime {
+namespace reference {
+/// \brief Number of elements processed by a single thread below which kernels stay single-threaded.
+///        Splitting smaller tensors costs more than the work itself.
+constexpr size_t parallel_min_chunk_size = 1 << 16;
+
+/// \brief Allows the kernels called by the current thread to split the work between threads.
+///
+/// The kernels are single-threaded unless the caller opens the scope, e.g. the TEMPLATE plugin running
+/// a whole model with the reference kernels. The plugins calling single kernels from their own parallel
+/// regions don't open it. The nested work of the threads is single-threaded again.
+class ParallelScope {
+public:
+    /// \param max_threads  Maximal number of threads used by a kernel, 0 - the concurrency of the caller's arena.
+    explicit ParallelScope(size_t max_threads = 0);
+    ~ParallelScope();
+
+    ParallelScope(const ParallelScope&) = delete;
+    ParallelScope& operator=(const ParallelScope&) = delete;
+
+private:
+    size_t m_previous;
+};
+
+/// \brief Splits [0, work_amount) into contiguous chunks and processes them with ov::parallel_nt.
+///
+/// The chunks run on the threads of the caller's arena (TBB or OpenMP), so the kernels called from
+/// the streams of a plugin don't use more threads than the stream owns. The number of the threads is
+/// limited by the ParallelScope of the calling thread.
+///
+/// \param work_amount     Number of work items.
+/// \param min_chunk_size  Minimal number of work items per thread.
+/// \param func            Callable processing the work items [start, end).
+void parallel_chunks_impl(size_t work_amount,
+                          size_t min_chunk_size,
+                          const std::function<void(size_t start, size_t end)>& func);
+
+/// \brief Splits [0, work_amount) into contiguous chunks and processes them concurrently.
+///
+/// \param work_amount     Number of work items.
+/// \param min_chunk_size  Minimal number of work items per thread.
+/// \param func            Callable with signature void(size_t start, size_t end).
+template <typename F>
+void parallel_chunks(const size_t work_amount, const size_t min_chunk_size, const F& func) {
+    if (work_amount < 2 * min_chunk_size) {
+        func(0, work_amount);
+        return;
+    }
+    parallel_chunks_impl(work_amount, min_chunk_size, func);
+}
+}  // namespace reference
+}  // namespace runtime
+}  // namespace ngraph
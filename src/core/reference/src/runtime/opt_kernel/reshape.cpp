@@ -9,6 +9,7 @@
 
 #include "ngraph/check.hpp"
 #include "ngraph/runtime/reference/reshape.hpp"
+#include "ngraph/runtime/reference/utils/parallel.hpp"
 
 using namespace ngraph;
 
@@ -200,6 +201,90 @@ void reshape_in6(const char* in,
         }
     }
 }
+// Copies output elements [start, end) of the transposed tensor. Output coordinate is tracked
+// incrementally, so the innermost dimension is a plain strided loop with typed copies.
+template <typename T>
+void reshape_range(const T* in,
+                   T* out,
+                   const std::vector<size_t>& out_dims,
+                   const std::vector<size_t>& in_strides,
+                   size_t start,
+                   size_t end) {
+    const size_t rank = out_dims.size();
+    std::vector<size_t> out_index(rank, 0);
+    size_t in_offset = 0;
+    for (size_t i = rank, rest = start; i-- > 0;) {
+        out_index[i] = rest % out_dims[i];
+        rest /= out_dims[i];
+        in_offset += out_index[i] * in_strides[i];
+    }
+
+    const size_t inner_dim = out_dims[rank - 1];
+    const size_t inner_stride = in_strides[rank - 1];
+    for (size_t i = start; i < end;) {
+        const size_t count = std::min(inner_dim - out_index[rank - 1], end - i);
+        const T* src = in + in_offset;
+        T* dst = out + i;
+        for (size_t j = 0; j < count; ++j) {
+            dst[j] = src[j * inner_stride];
+        }
+        i += count;
+        in_offset += count * inner_stride;
+        out_index[rank - 1] += count;
+        for (size_t d = rank - 1; d > 0 && out_index[d] == out_dims[d]; --d) {
+            in_offset -= out_index[d] * in_strides[d];
+            out_index[d] = 0;
+            ++out_index[d - 1];
+            in_offset += in_strides[d - 1];
+        }
+    }
+}
+
+template <typename T>
+void reshape_parallel(const char* in, char* out, const Shape& in_shape, const AxisVector& in_axis_order) {
+    const size_t rank = in_shape.size();
+    const auto strides = row_major_strides(in_shape);
+    std::vector<size_t> out_dims(rank), in_strides(rank);
+    for (size_t i = 0; i < rank; ++i) {
+        out_dims[i] = in_shape[in_axis_order[i]];
+        in_strides[i] = strides[in_axis_order[i]];
+    }
+    const auto src = reinterpret_cast<const T*>(in);
+    const auto dst = reinterpret_cast<T*>(out);
+    runtime::reference::parallel_chunks(shape_size(in_shape),
+                                        runtime::reference::parallel_min_chunk_size,
+                                        [&](size_t start, size_t end) {
+                                            reshape_range(src, dst, out_dims, in_strides, start, end);
+                                        });
+}
+
+// Large transposes of elements with native size are split between threads
+bool reshape_parallel_if_large(const char* in,
+                               char* out,
+                               const Shape& in_shape,
+                               const AxisVector& in_axis_order,
+                               size_t elem_size) {
+    if (in_shape.empty() || shape_size(in_shape) < 2 * runtime::reference::parallel_min_chunk_size)
+        return false;
+
+    switch (elem_size) {
+    case 1:
+        reshape_parallel<uint8_t>(in, out, in_shape, in_axis_order);
+        return true;
+    case 2:
+        reshape_parallel<uint16_t>(in, out, in_shape, in_axis_order);
+        return true;
+    case 4:
+        reshape_parallel<uint32_t>(in, out, in_shape, in_axis_order);
+        return true;
+    case 8:
+        reshape_parallel<uint64_t>(in, out, in_shape, in_axis_order);
+        return true;
+    default:
+        return false;
+    }
+}
+
 bool no_axis_reordering(const AxisVector& axis_order) {
     auto tmp = axis_order;
     std::sort(begin(tmp), end(tmp));
@@ -218,6 +303,10 @@ void runtime::opt_kernel::reshape(const char* in,
         return;
     }
 
+    if (reshape_parallel_if_large(in, out, in_shape, in_axis_order, elem_size)) {
+        return;
+    }
+
     switch (in_shape.size()) {
     case 0:
         reshape_in0(in, out, in_shape, in_axis_order, out_shape, elem_size);
@@ -0,0 +1,54 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "ngraph/runtime/reference/utils/parallel.hpp"
+
+#include <algorithm>
+
+#include "openvino/core/parallel.hpp"
+
+namespace ngraph {
+namespace runtime {
+namespace reference {
+namespace {
+// the limit of the threads set by ParallelScope, 1 - single-threaded, 0 - the concurrency of the arena
+thread_local size_t max_threads_limit = 1;
+}  // namespace
+
+ParallelScope::ParallelScope(const size_t max_threads) : m_previous(max_threads_limit) {
+    max_threads_limit = max_threads;
+}
+
+ParallelScope::~ParallelScope() {
+    max_threads_limit = m_previous;
+}
+
+void parallel_chunks_impl(const size_t work_amount,
+                          const size_t min_chunk_size,
+                          const std::function<void(size_t, size_t)>& func) {
+    if (max_threads_limit == 1) {
+        func(0, work_amount);
+        return;
+    }
+    size_t max_threads = static_cast<size_t>(std::max(parallel_get_max_threads(), 1));
+    if (max_threads_limit != 0)
+        max_threads = std::min(max_threads, max_threads_limit);
+    const size_t nthr = std::min(max_threads, work_amount / std::max<size_t>(min_chunk_size, 1));
+    if (nthr <= 1) {
+        func(0, work_amount);
+        return;
+    }
+
+    ov::parallel_nt(static_cast<int>(nthr), [&](const int ithr, const int nthr) {
+        // the kernels called by the chunks don't split their work again
+        ParallelScope scope(1);
+        size_t start = 0, end = 0;
+        ov::splitter(work_amount, static_cast<size_t>(nthr), static_cast<size_t>(ithr), start, end);
+        if (start < end)
+            func(start, end);
+    });
+}
+}  // namespace reference
+}  // namespace runtime
+}  // namespace ngraph
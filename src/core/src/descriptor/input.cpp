@@ -8,6 +8,7 @@
 #include "openvino/core/descriptor/output.hpp"
 #include "openvino/core/node.hpp"
 #include "openvino/core/type/element_type.hpp"
+#include "port_vector.hpp"
 #include "shared_node_info.hpp"
 
 ov::descriptor::Input::Input(ov::Node* node, size_t index, Output& output)
@@ -49,7 +50,7 @@ void ov::descriptor::Input::replace_output(Output& new_output) {
 }
 
 void ov::descriptor::Input::replace_output(const std::shared_ptr<ov::Node>& node, size_t i) {
-    replace_output(node->m_outputs.at(i));
+    replace_output(node->m_ports->outputs.at(i));
 }
 
 void ov::descriptor::Input::remove_output() {
@@ -20,6 +20,7 @@
 #include "ngraph/pattern/matcher.hpp"
 #include "openvino/core/descriptor/input.hpp"
 #include "openvino/pass/constant_folding.hpp"
+#include "port_vector.hpp"
 #include "shape_util.hpp"
 #include "shared_node_info.hpp"
 #include "tensor_conversion_util.hpp"
@@ -36,7 +37,9 @@ void ov::NodeValidationFailure::create(const CheckLocInfo& check_loc_info,
 
 atomic<size_t> ov::Node::m_next_instance_id(0);
 
-ov::Node::Node() = default;
+ov::Node::Node() {
+    m_ports.ports.reset(new Ports());
+}
 
 ov::Node::Node(const Node& node)
     : m_control_dependents(node.m_control_dependents),
@@ -45,12 +48,11 @@ ov::Node::Node(const Node& node)
       m_friendly_name(node.m_friendly_name)
       // skip m_unique_name -- will be generated automatically
       ,
-      m_inputs(node.m_inputs)  // will be modified in the body
-      // skip m_outputs -- should be initialized outside
-      ,
       m_rt_info(node.m_rt_info) {
-    // cannot do it without copying node.m_inputs first due to too limiting const qualifiers
-    for (auto& input : m_inputs) {
+    // the inputs will be modified below, skip the outputs -- should be initialized outside
+    m_ports.ports.reset(new Ports(node.m_ports->inputs));
+    // cannot do it without copying node inputs first due to too limiting const qualifiers
+    for (auto& input : m_ports->inputs) {
         input = descriptor::Input(this, input.get_index(), input.get_output());
         input.get_output().add_input(&input);
     }
@@ -61,10 +63,10 @@ ov::Node& ov::Node::operator=(const Node& node) {
     this->m_control_dependencies = node.m_control_dependencies;
     this->m_instance_id = m_next_instance_id.fetch_add(1);
     this->m_friendly_name = node.m_friendly_name;
-    this->m_inputs = node.m_inputs;
+    this->m_ports->inputs = node.m_ports->inputs;
     this->m_rt_info = node.m_rt_info;
-    // cannot do it without copying node.m_inputs first due to too limiting const qualifiers
-    for (auto& input : m_inputs) {
+    // cannot do it without copying node inputs first due to too limiting const qualifiers
+    for (auto& input : m_ports->inputs) {
         input = descriptor::Input(this, input.get_index(), input.get_output());
         input.get_output().add_input(&input);
     }
@@ -92,7 +94,7 @@ ov::Node::~Node() {
             info->set_use_topological_cache(false);
         });
 
-        for (descriptor::Input& input : m_inputs) {
+        for (descriptor::Input& input : m_ports->inputs) {
             if (input.has_output()) {
                 // This test adds 1 to the actual count, so a count of 2 means this input is the only
                 // reference to the node.
@@ -148,7 +150,7 @@ std::shared_ptr<ov::Node> ov::Node::copy_with_new_inputs(
 }
 
 void ov::Node::safe_delete(NodeVector& nodes, bool recurse) {
-    for (auto& input : m_inputs) {
+    for (auto& input : m_ports->inputs) {
         if (input.has_output()) {
             // This test adds 1 to the actual count, so a count of 2 means this input is the only
             // reference to the node.
@@ -181,7 +183,7 @@ void ov::Node::set_arguments(const NodeVector& arguments) {
 
 void ov::Node::set_arguments(const OutputVector& arguments) {
     // Remove existing inputs of this node
-    m_inputs.clear();
+    m_ports->inputs.clear();
 
     // Add this node as a user of each argument.
     size_t i = 0;
@@ -196,33 +198,33 @@ void ov::Node::set_arguments(const OutputVector& arguments) {
 }
 
 ov::descriptor::Input& ov::Node::get_input_descriptor(size_t position) {
-    while (m_inputs.size() <= position) {
-        m_inputs.emplace_back(this, m_inputs.size());
+    while (m_ports->inputs.size() <= position) {
+        m_ports->inputs.emplace_back(this, m_ports->inputs.size());
     }
-    return m_inputs.at(position);
+    return m_ports->inputs.at(position);
 }
 
 ov::descriptor::Output& ov::Node::get_output_descriptor(size_t position) {
-    while (m_outputs.size() <= position) {
-        size_t i = m_outputs.size();
+    while (m_ports->outputs.size() <= position) {
+        size_t i = m_ports->outputs.size();
         auto tensor_descriptor = make_shared<descriptor::Tensor>(element::dynamic, PartialShape::dynamic(), this, i);
-        m_outputs.emplace_back(this, i, tensor_descriptor);
+        m_ports->outputs.emplace_back(this, i, tensor_descriptor);
     }
-    return m_outputs[position];
+    return m_ports->outputs[position];
 }
 
 void ov::Node::set_argument(size_t position, const Output<Node>& argument) {
     auto output_node = argument.get_node();
-    auto& output_descriptor = output_node->m_outputs.size() > argument.get_index()
-                                  ? output_node->m_outputs.at(argument.get_index())
+    auto& output_descriptor = output_node->m_ports->outputs.size() > argument.get_index()
+                                  ? output_node->m_ports->outputs.at(argument.get_index())
                                   : output_node->get_output_descriptor(argument.get_index());
-    if (position < m_inputs.size()) {
+    if (position < m_ports->inputs.size()) {
         get_input_descriptor(position).replace_output(output_descriptor);
     } else {
-        while (m_inputs.size() < position) {
-            m_inputs.emplace_back(this, m_inputs.size());
+        while (m_ports->inputs.size() < position) {
+            m_ports->inputs.emplace_back(this, m_ports->inputs.size());
         }
-        m_inputs.emplace_back(this, position, output_descriptor);
+        m_ports->inputs.emplace_back(this, position, output_descriptor);
     }
 }
 
@@ -231,8 +233,8 @@ void ov::Node::constructor_validate_and_infer_types() {
 }
 
 void ov::Node::set_output_size(size_t n) {
-    NGRAPH_CHECK(n >= m_outputs.size(), "shrinking ", m_outputs.size(), " to ", n);
-    for (size_t i = m_outputs.size(); i < n; ++i) {
+    NGRAPH_CHECK(n >= m_ports->outputs.size(), "shrinking ", m_ports->outputs.size(), " to ", n);
+    for (size_t i = m_ports->outputs.size(); i < n; ++i) {
         // create the descriptors
         get_output_descriptor(i);
     }
@@ -246,19 +248,19 @@ void ov::Node::invalidate_values() {
 void ov::Node::validate_and_infer_types() {}
 
 void ov::Node::set_input_is_relevant_to_shape(size_t i, bool relevant) {
-    NGRAPH_CHECK(i < m_inputs.size(),
+    NGRAPH_CHECK(i < m_ports->inputs.size(),
                  "index '",
                  i,
                  "' out of range in set_input_is_relevant_to_shape(size_t index, bool relevant)");
-    m_inputs[i].m_is_relevant_to_shape = relevant;
+    m_ports->inputs[i].m_is_relevant_to_shape = relevant;
 }
 
 void ov::Node::set_input_is_relevant_to_value(size_t i, bool relevant) {
-    NGRAPH_CHECK(i < m_inputs.size(),
+    NGRAPH_CHECK(i < m_ports->inputs.size(),
                  "index '",
                  i,
                  "' out of range in set_input_is_relevant_to_value(size_t index, bool relevant)");
-    m_inputs[i].m_is_relevant_to_value = relevant;
+    m_ports->inputs[i].m_is_relevant_to_value = relevant;
 }
 
 void ov::Node::set_output_type(size_t i, const element::Type& element_type, const PartialShape& pshape) {
@@ -290,13 +292,13 @@ void ov::Node::set_friendly_name(const string& name) {
 }
 
 ov::Node* ov::Node::get_input_node_ptr(size_t index) const {
-    NGRAPH_CHECK(index < m_inputs.size(), "index '", index, "' out of range in get_argument(size_t index)");
-    return m_inputs[index].get_output().get_node().get();
+    NGRAPH_CHECK(index < m_ports->inputs.size(), "index '", index, "' out of range in get_argument(size_t index)");
+    return m_ports->inputs[index].get_output().get_node().get();
 }
 
 std::shared_ptr<ov::Node> ov::Node::get_input_node_shared_ptr(size_t index) const {
-    NGRAPH_CHECK(index < m_inputs.size(), "index '", index, "' out of range in get_argument(size_t index)");
-    return m_inputs[index].get_output().get_node();
+    NGRAPH_CHECK(index < m_ports->inputs.size(), "index '", index, "' out of range in get_argument(size_t index)");
+    return m_ports->inputs[index].get_output().get_node();
 }
 
 ov::Output<ov::Node> ov::Node::get_input_source_output(size_t i) const {
@@ -415,12 +417,12 @@ std::ostream& ov::Node::write_description(std::ostream& out, uint32_t depth) con
 }
 
 size_t ov::Node::get_output_size() const {
-    return m_outputs.size();
+    return m_ports->outputs.size();
 }
 
 const ov::element::Type& ov::Node::get_output_element_type(size_t i) const {
-    NGRAPH_CHECK(i < m_outputs.size(), "index '", i, "' out of range in get_output_element_type(size_t i)");
-    return m_outputs[i].get_element_type();
+    NGRAPH_CHECK(i < m_ports->outputs.size(), "index '", i, "' out of range in get_output_element_type(size_t i)");
+    return m_ports->outputs[i].get_element_type();
 }
 
 const ov::element::Type& ov::Node::get_element_type() const {
@@ -431,13 +433,13 @@ const ov::element::Type& ov::Node::get_element_type() const {
 }
 
 const ov::Shape& ov::Node::get_output_shape(size_t i) const {
-    NGRAPH_CHECK(i < m_outputs.size(), "index '", i, "' out of range in get_output_shape(size_t i)");
-    return m_outputs[i].get_shape();
+    NGRAPH_CHECK(i < m_ports->outputs.size(), "index '", i, "' out of range in get_output_shape(size_t i)");
+    return m_ports->outputs[i].get_shape();
 }
 
 const ov::PartialShape& ov::Node::get_output_partial_shape(size_t i) const {
-    NGRAPH_CHECK(i < m_outputs.size(), "index '", i, "' out of range in get_output_partial_shape(size_t i)");
-    return m_outputs[i].get_partial_shape();
+    NGRAPH_CHECK(i < m_ports->outputs.size(), "index '", i, "' out of range in get_output_partial_shape(size_t i)");
+    return m_ports->outputs[i].get_partial_shape();
 }
 
 const ov::Shape& ov::Node::get_shape() const {
@@ -448,7 +450,7 @@ const ov::Shape& ov::Node::get_shape() const {
 std::set<ov::Input<ov::Node>> ov::Node::get_output_target_inputs(size_t i) const {
     std::set<Input<Node>> result;
 
-    for (auto& input : m_outputs.at(i).get_inputs()) {
+    for (auto& input : m_ports->outputs.at(i).get_inputs()) {
         result.emplace(input->get_raw_pointer_node(), input->get_index());
     }
 
@@ -456,33 +458,37 @@ std::set<ov::Input<ov::Node>> ov::Node::get_output_target_inputs(size_t i) const
 }
 
 ov::descriptor::Tensor& ov::Node::get_output_tensor(size_t i) const {
-    NGRAPH_CHECK(i < m_outputs.size(), "index '", i, "' out of range in get_output_tensor(size_t i) for node ", *this);
-    return m_outputs[i].get_tensor();
+    NGRAPH_CHECK(i < m_ports->outputs.size(),
+                 "index '",
+                 i,
+                 "' out of range in get_output_tensor(size_t i) for node ",
+                 *this);
+    return m_ports->outputs[i].get_tensor();
 }
 
 ov::descriptor::Tensor& ov::Node::get_input_tensor(size_t i) const {
-    NGRAPH_CHECK(i < m_inputs.size(), "index '", i, "' out of range in get_input_tensor(size_t i)");
-    descriptor::Input input = m_inputs[i];
+    NGRAPH_CHECK(i < m_ports->inputs.size(), "index '", i, "' out of range in get_input_tensor(size_t i)");
+    descriptor::Input input = m_ports->inputs[i];
     return input.get_tensor();
 }
 
 size_t ov::Node::get_input_size() const {
-    return m_inputs.size();
+    return m_ports->inputs.size();
 }
 
 const ov::element::Type& ov::Node::get_input_element_type(size_t i) const {
-    NGRAPH_CHECK(i < m_inputs.size(), "index '", i, "' out of range in get_input_element_type(size_t i)");
-    return m_inputs[i].get_element_type();
+    NGRAPH_CHECK(i < m_ports->inputs.size(), "index '", i, "' out of range in get_input_element_type(size_t i)");
+    return m_ports->inputs[i].get_element_type();
 }
 
 const ov::Shape& ov::Node::get_input_shape(size_t i) const {
-    NGRAPH_CHECK(i < m_inputs.size(), "index '", i, "' out of range in get_input_shape(size_t i)");
-    return m_inputs[i].get_shape();
+    NGRAPH_CHECK(i < m_ports->inputs.size(), "index '", i, "' out of range in get_input_shape(size_t i)");
+    return m_ports->inputs[i].get_shape();
 }
 
 const ov::PartialShape& ov::Node::get_input_partial_shape(size_t i) const {
-    NGRAPH_CHECK(i < m_inputs.size(), "index '", i, "' out of range in get_input_partial_shape(size_t i)");
-    return m_inputs[i].get_partial_shape();
+    NGRAPH_CHECK(i < m_ports->inputs.size(), "index '", i, "' out of range in get_input_partial_shape(size_t i)");
+    return m_ports->inputs[i].get_partial_shape();
 }
 
 bool ov::Node::has_same_type(std::shared_ptr<const Node> node) const {
@@ -574,7 +580,7 @@ bool ov::Node::is_dynamic() const {
 }
 
 ov::Input<ov::Node> ov::Node::input(size_t input_index) {
-    if (input_index >= m_inputs.size()) {
+    if (input_index >= m_ports->inputs.size()) {
         throw out_of_range("node input index is out of range");
     }
 
@@ -586,7 +592,7 @@ ov::Output<ov::Node> ov::Node::input_value(size_t input_index) const {
 }
 
 ov::Input<const ov::Node> ov::Node::input(size_t input_index) const {
-    if (input_index >= m_inputs.size()) {
+    if (input_index >= m_ports->inputs.size()) {
         throw out_of_range("node input index is out of range");
     }
 
@@ -595,7 +601,7 @@ ov::Input<const ov::Node> ov::Node::input(size_t input_index) const {
 
 ov::Output<ov::Node> ov::Node::output(size_t output_index) {
     // All nodes will have at least 1 output
-    if (output_index > 0 && output_index >= m_outputs.size()) {
+    if (output_index > 0 && output_index >= m_ports->outputs.size()) {
         throw out_of_range("node output index is out of range");
     }
 
@@ -604,7 +610,7 @@ ov::Output<ov::Node> ov::Node::output(size_t output_index) {
 
 ov::Output<const ov::Node> ov::Node::output(size_t output_index) const {
     // All nodes will have at least 1 output
-    if (output_index > 0 && output_index >= m_outputs.size()) {
+    if (output_index > 0 && output_index >= m_ports->outputs.size()) {
         throw out_of_range("node output index is out of range");
     }
 
@@ -5,6 +5,7 @@
 #include "openvino/core/node_input.hpp"
 
 #include "openvino/core/node.hpp"
+#include "port_vector.hpp"
 
 namespace ov {
 Input<Node>::Input(Node* node, size_t index) : m_node(node), m_index(index) {
@@ -29,28 +30,29 @@ const PartialShape& Input<Node>::get_partial_shape() const {
 }
 
 Output<Node> Input<Node>::get_source_output() const {
-    auto& output_descriptor = m_node->m_inputs.at(m_index).get_output();
+    auto& output_descriptor = m_node->m_ports->inputs.at(m_index).get_output();
     return Output<Node>(output_descriptor.get_node(), output_descriptor.get_index());
 }
 
 descriptor::Tensor& Input<Node>::get_tensor() const {
-    return m_node->m_inputs.at(m_index).get_output().get_tensor();
+    return m_node->m_ports->inputs.at(m_index).get_output().get_tensor();
 }
 
 std::shared_ptr<descriptor::Tensor> Input<Node>::get_tensor_ptr() const {
-    return m_node->m_inputs.at(m_index).get_output().get_tensor_ptr();
+    return m_node->m_ports->inputs.at(m_index).get_output().get_tensor_ptr();
 }
 
 bool Input<Node>::get_is_relevant_to_shapes() const {
-    return m_node->m_inputs.at(m_index).get_is_relevant_to_shape();
+    return m_node->m_ports->inputs.at(m_index).get_is_relevant_to_shape();
 }
 
 bool Input<Node>::get_is_relevant_to_values() const {
-    return m_node->m_inputs.at(m_index).get_is_relevant_to_value();
+    return m_node->m_ports->inputs.at(m_index).get_is_relevant_to_value();
 }
 
 void Input<Node>::replace_source_output(const Output<Node>& new_source_output) const {
-    m_node->m_inputs.at(m_index).replace_output(new_source_output.get_node_shared_ptr(), new_source_output.get_index());
+    m_node->m_ports->inputs.at(m_index).replace_output(new_source_output.get_node_shared_ptr(),
+                                                       new_source_output.get_index());
 }
 
 bool Input<Node>::operator==(const Input& other) const {
@@ -79,15 +81,15 @@ Input<const Node>::Input(const Node* node, size_t index) : m_node(node), m_index
 }
 
 RTMap& Input<Node>::get_rt_info() {
-    return m_node->m_inputs.at(m_index).get_rt_info();
+    return m_node->m_ports->inputs.at(m_index).get_rt_info();
 }
 
 const RTMap& Input<Node>::get_rt_info() const {
-    return m_node->m_inputs.at(m_index).get_rt_info();
+    return m_node->m_ports->inputs.at(m_index).get_rt_info();
 }
 
 const RTMap& Input<const Node>::get_rt_info() const {
-    return m_node->m_inputs.at(m_index).get_rt_info();
+    return m_node->m_ports->inputs.at(m_index).get_rt_info();
 }
 
 const Node* Input<const Node>::get_node() const {
@@ -107,24 +109,24 @@ const PartialShape& Input<const Node>::get_partial_shape() const {
 }
 
 Output<Node> Input<const Node>::get_source_output() const {
-    auto& output_descriptor = m_node->m_inputs.at(m_index).get_output();
+    auto& output_descriptor = m_node->m_ports->inputs.at(m_index).get_output();
     return Output<Node>(output_descriptor.get_node(), output_descriptor.get_index());
 }
 
 descriptor::Tensor& Input<const Node>::get_tensor() const {
-    return m_node->m_inputs.at(m_index).get_output().get_tensor();
+    return m_node->m_ports->inputs.at(m_index).get_output().get_tensor();
 }
 
 std::shared_ptr<descriptor::Tensor> Input<const Node>::get_tensor_ptr() const {
-    return m_node->m_inputs.at(m_index).get_output().get_tensor_ptr();
+    return m_node->m_ports->inputs.at(m_index).get_output().get_tensor_ptr();
 }
 
 bool Input<const Node>::get_is_relevant_to_shapes() const {
-    return m_node->m_inputs.at(m_index).get_is_relevant_to_shape();
+    return m_node->m_ports->inputs.at(m_index).get_is_relevant_to_shape();
 }
 
 bool Input<const Node>::get_is_relevant_to_values() const {
-    return m_node->m_inputs.at(m_index).get_is_relevant_to_value();
+    return m_node->m_ports->inputs.at(m_index).get_is_relevant_to_value();
 }
 
 bool Input<const Node>::operator==(const Input& other) const {
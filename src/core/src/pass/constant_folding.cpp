@@ -4,15 +4,22 @@
 
 #include "openvino/pass/constant_folding.hpp"
 
+#include <algorithm>
 #include <openvino/cc/pass/itt.hpp>
+#include <unordered_map>
 
+#include "ngraph/runtime/reference/utils/parallel.hpp"
 #include "openvino/core/rt_info.hpp"
 #include "openvino/core/validation_util.hpp"
 #include "openvino/op/constant.hpp"
+#include "openvino/op/convert.hpp"
+#include "openvino/op/transpose.hpp"
+#include "openvino/op/util/binary_elementwise_arithmetic.hpp"
 #include "openvino/op/util/op_types.hpp"
 #include "openvino/op/util/read_value_base.hpp"
 #include "openvino/op/util/shape_of_base.hpp"
 #include "openvino/op/util/sub_graph_base.hpp"
+#include "openvino/op/util/unary_elementwise_arithmetic.hpp"
 
 using namespace std;
 
@@ -51,19 +58,117 @@ const auto friendly_name_from = [](const ov::Node& node, const size_t output_cou
     }
 };
 
+/**
+ * \brief Split topologically sorted nodes into levels. Nodes of the same level do not depend on each other,
+ * nodes of each level depend only on nodes from previous levels.
+ *
+ * \param ordered_ops  Nodes in topological order.
+ *
+ * \return Nodes grouped by level, each group keeps the topological order of nodes.
+ */
+const auto split_by_levels = [](const std::vector<std::shared_ptr<ov::Node>>& ordered_ops) {
+    std::unordered_map<const ov::Node*, size_t> node_levels;
+    std::vector<std::vector<std::shared_ptr<ov::Node>>> levels;
+    for (const auto& node : ordered_ops) {
+        size_t level = 0;
+        const auto update_level = [&](const ov::Node* dependency) {
+            const auto dependency_level = node_levels.find(dependency);
+            if (dependency_level != node_levels.end())
+                level = std::max(level, dependency_level->second + 1);
+        };
+        for (const auto& input : node->inputs())
+            update_level(input.get_source_output().get_node());
+        for (const auto& control_dependency : node->get_control_dependencies())
+            update_level(control_dependency.get());
+
+        node_levels[node.get()] = level;
+        if (levels.size() <= level)
+            levels.resize(level + 1);
+        levels[level].push_back(node);
+    }
+    return levels;
+};
+
+/**
+ * \brief Check if node can be folded concurrently with other nodes.
+ *
+ * Only ops which are folded by default Node::constant_fold with pure reference kernels are taken, so folding does
+ * not touch the graph. Large tensors are skipped as reference kernels already split them between threads.
+ *
+ * \param node  Node to check.
+ *
+ * \return true if node can be folded in parallel otherwise false.
+ */
+const auto is_parallel_foldable = [](const std::shared_ptr<ov::Node>& node) {
+    if (!ov::is_type<ov::op::util::BinaryElementwiseArithmetic>(node) &&
+        !ov::is_type<ov::op::util::UnaryElementwiseArithmetic>(node) && !ov::is_type<ov::op::v0::Convert>(node) &&
+        !ov::is_type<ov::op::v1::Transpose>(node))
+        return false;
+    if (ov::pass::constant_folding_is_disabled(node))
+        return false;
+    for (const auto& input : node->input_values()) {
+        if (!ov::is_type<ov::op::v0::Constant>(input.get_node()))
+            return false;
+    }
+    for (const auto& output : node->outputs()) {
+        const auto& shape = output.get_partial_shape();
+        if (shape.is_dynamic() ||
+            ov::shape_size(shape.to_shape()) >= ngraph::runtime::reference::parallel_min_chunk_size)
+            return false;
+    }
+    return true;
+};
+
 bool ov::pass::ConstantFolding::run_on_model(const std::shared_ptr<ov::Model>& model) {
     RUN_ON_MODEL_SCOPE(ConstantFolding);
+    // the independent nodes and the big folds are split between the threads of the caller
+    ngraph::runtime::reference::ParallelScope parallel_scope;
 
     bool rewritten = pre_calculated_values_folding(model);
 
-    for (const auto& node : model->get_ordered_ops()) {
+    for (const auto& level : split_by_levels(model->get_ordered_ops())) {
         if (rewritten) {
-            node->validate_and_infer_types();
+            for (const auto& node : level) {
+                node->validate_and_infer_types();
+            }
         }
 
-        OutputVector replacements(node->get_output_size());
+        // Independent nodes of the level are evaluated concurrently, graph is modified sequentially below
+        std::vector<OutputVector> level_replacements(level.size());
+        std::vector<char> folded(level.size(), false);
+        std::vector<size_t> parallel_nodes;
+        for (size_t i = 0; i < level.size(); ++i) {
+            level_replacements[i].resize(level[i]->get_output_size());
+            if (is_parallel_foldable(level[i]))
+                parallel_nodes.push_back(i);
+        }
+        if (parallel_nodes.size() > 1) {
+            ngraph::runtime::reference::parallel_chunks(parallel_nodes.size(), 1, [&](size_t start, size_t end) {
+                for (size_t j = start; j < end; ++j) {
+                    const auto i = parallel_nodes[j];
+                    folded[i] = level[i]->constant_fold(level_replacements[i], level[i]->input_values());
+                }
+            });
+        } else {
+            parallel_nodes.clear();
+        }
 
-        if (node->constant_fold(replacements, node->input_values())) {
+        for (size_t node_idx = 0; node_idx < level.size(); ++node_idx) {
+            const auto& node = level[node_idx];
+            auto& replacements = level_replacements[node_idx];
+            const bool is_folded = std::binary_search(parallel_nodes.begin(), parallel_nodes.end(), node_idx)
+                                       ? folded[node_idx]
+                                       : node->constant_fold(replacements, node->input_values());
+            if (!is_folded) {
+                // recursively constant fold operators containing subgraphs (ie: TensorIterator, Loop)
+                if (auto sub_graph_node = std::dynamic_pointer_cast<ov::op::util::MultiSubGraphOp>(node)) {
+                    size_t sub_graphs_num = sub_graph_node->get_internal_subgraphs_size();
+                    for (size_t sub_graph_ind = 0; sub_graph_ind < sub_graphs_num; ++sub_graph_ind) {
+                        rewritten |= run_on_model(sub_graph_node->get_function(static_cast<int>(sub_graph_ind)));
+                    }
+                }
+                continue;
+            }
             OPENVINO_ASSERT(!constant_folding_is_disabled(node),
                             "Node folded but constant folding disabled. Check constant_fold implementation for ",
                             node);
@@ -87,14 +192,6 @@ bool ov::pass::ConstantFolding::run_on_model(const std::shared_ptr<ov::Model>& m
                     rewritten = true;
                 }
             }
-        } else {
-            // recursively constant fold operators containing subgraphs (ie: TensorIterator, Loop)
-            if (auto sub_graph_node = std::dynamic_pointer_cast<ov::op::util::MultiSubGraphOp>(node)) {
-                size_t sub_graphs_num = sub_graph_node->get_internal_subgraphs_size();
-                for (size_t sub_graph_ind = 0; sub_graph_ind < sub_graphs_num; ++sub_graph_ind) {
-                    rewritten |= run_on_model(sub_graph_node->get_function(static_cast<int>(sub_graph_ind)));
-                }
-            }
         }
     }
 
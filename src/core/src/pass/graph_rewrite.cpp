@@ -5,18 +5,23 @@
 #include "ngraph/pass/graph_rewrite.hpp"
 
 #include <algorithm>
+#include <chrono>
 #include <deque>
+#include <iomanip>
 #include <iostream>
 #include <ngraph/pattern/op/wrap_type.hpp>
 #include <openvino/cc/pass/itt.hpp>
 #include <regex>
+#include <sstream>
 #include <string>
+#include <unordered_map>
 #include <unordered_set>
 #include <vector>
 
 #include "ngraph/env_util.hpp"
 #include "ngraph/log.hpp"
 #include "ngraph/op/util/sub_graph_base.hpp"
+#include "openvino/util/env_util.hpp"
 #include "openvino/util/log.hpp"
 #include "perf_counters.hpp"
 
@@ -50,7 +55,11 @@
  * In this case, you need to register nodes in MatcherPass manually using register_new_node method.
  * GraphRewrite will automatically add this nodes in the beginning of execution queue.
  * If MatcherPass register more than one node make sure that this nodes are registered in
- * topological order. */
+ * topological order.
+ * After a successful rewrite the producers and the consumers of the rewritten node, which were already
+ * visited and have matchers of their type, are queued again in front of the registered nodes, so a match
+ * enabled by the rewrite is found in the same run. E.g. if `m3` folds `Add4`, the matchers run on `Abs2`
+ * and `Neg3` once more. The rest of the visited nodes are not revisited. */
 
 #ifdef ENABLE_PROFILING_ITT
 
@@ -67,6 +76,48 @@ PerfCounters& perf_counters_graph_rewrite() {
 
 #endif  // ENABLE_PROFILING_ITT
 
+namespace {
+bool getenv_profile_pass() {
+    static const bool profile_enabled =
+        ov::util::getenv_bool("NGRAPH_PROFILE_PASS_ENABLE") || ov::util::getenv_bool("OV_PROFILE_PASS_ENABLE");
+    return profile_enabled;
+}
+
+// Per MatcherPass statistics collected when OV_PROFILE_PASS_ENABLE is set
+struct MatcherPassStats {
+    size_t calls = 0;
+    size_t matches = 0;
+    std::chrono::nanoseconds duration{0};
+};
+
+void report_matcher_pass_stats(const std::string& pass_name,
+                               const std::vector<std::shared_ptr<ov::pass::MatcherPass>>& matchers,
+                               const std::vector<MatcherPassStats>& stats) {
+    std::vector<size_t> order;
+    for (size_t i = 0; i < stats.size(); ++i) {
+        if (stats[i].calls > 0)
+            order.push_back(i);
+    }
+    std::sort(order.begin(), order.end(), [&](size_t lhs, size_t rhs) {
+        return stats[lhs].duration > stats[rhs].duration;
+    });
+    auto& profile = ov::pass::matcher_pass_profile();
+    for (auto i : order) {
+        const auto ms = std::chrono::duration<double, std::milli>(stats[i].duration).count();
+        std::ostringstream line;
+        line << "    " << std::setw(7) << ms << "ms   matched " << stats[i].matches << "/" << stats[i].calls << " "
+             << pass_name << "::" << matchers[i]->get_name();
+        if (profile.managers > 0)
+            profile.lines.push_back(line.str());
+        else
+            std::cout << line.str() << "\n";
+    }
+}
+
+// A node is queued again at most this many times, which bounds the callbacks reporting the changes they didn't make
+constexpr size_t max_node_requeues = 4;
+}  // namespace
+
 bool ov::pass::BackwardGraphRewrite::run_on_model(const std::shared_ptr<ov::Model>& f) {
     RUN_ON_MODEL_SCOPE(BackwardGraphRewrite);
     // Initialize execution queue with nodes in topological order
@@ -136,10 +187,14 @@ bool ov::pass::GraphRewrite::apply_matcher_passes(std::shared_ptr<Model> f,
         // including ones triggered by parent type info.
     }
 
+    const bool profile_enabled = getenv_profile_pass();
+    std::vector<MatcherPassStats> stats(profile_enabled ? m_matchers.size() : 0);
+
     // This lambda preforms execution of particular MatcherPass on given node.
     // It automatically handles nodes registered by MatcherPass during transformation and set
     // transformation callback.
-    auto run_matcher_pass = [&](std::shared_ptr<MatcherPass> m_pass, std::shared_ptr<Node> node) -> bool {
+    auto run_matcher_pass = [&](size_t matcher_index, std::shared_ptr<Node> node) -> bool {
+        const auto& m_pass = m_matchers[matcher_index];
         // Keep this property check for backward compatibility. In future transformation property
         // will be deprecated and removed.
         if (m_pass->get_property(PassProperty::REQUIRE_STATIC_SHAPE) && f->is_dynamic()) {
@@ -152,7 +207,17 @@ bool ov::pass::GraphRewrite::apply_matcher_passes(std::shared_ptr<Model> f,
 
         // Apply MatcherPass. In case if it returns true no other MatcherPasses will apply
         // to this node
-        bool status = m_pass->apply(node);
+        bool status = false;
+        if (profile_enabled) {
+            const auto start = std::chrono::steady_clock::now();
+            status = m_pass->apply(node);
+            auto& matcher_stats = stats[matcher_index];
+            matcher_stats.duration += std::chrono::steady_clock::now() - start;
+            matcher_stats.calls++;
+            matcher_stats.matches += status ? 1 : 0;
+        } else {
+            status = m_pass->apply(node);
+        }
 
         // In case if MatcherPass registered nodes they will be added to the beginning of execution
         // queue
@@ -168,8 +233,67 @@ bool ov::pass::GraphRewrite::apply_matcher_passes(std::shared_ptr<Model> f,
         return status;
     };
 
-    // list of matchers to run for a node; define here to keep memory allocated
-    std::vector<size_t> matcher_passes_to_run;
+    // Resolved list of matchers for each node type including matchers registered for parent types.
+    // Collecting them requires walking the type hierarchy and sorting, so the result is cached
+    // and nodes without applicable matchers are skipped with a single lookup.
+    std::unordered_map<const DiscreteTypeInfo*, std::vector<size_t>> type_to_resolved_matchers;
+    auto get_matcher_passes_to_run = [&](const DiscreteTypeInfo* type_info) -> const std::vector<size_t>& {
+        auto resolved = type_to_resolved_matchers.find(type_info);
+        if (resolved != type_to_resolved_matchers.end())
+            return resolved->second;
+
+        std::vector<size_t> matcher_passes_to_run;
+        for (auto node_type_info = type_info; node_type_info; node_type_info = node_type_info->parent) {
+            auto matchers = type_to_matcher.find(*node_type_info);
+            if (matchers != type_to_matcher.end()) {
+                // do not run found matchers immediately, need to collect all matchers for
+                // parents and sort them in order of the registration
+                matcher_passes_to_run.insert(matcher_passes_to_run.end(),
+                                             matchers->second.begin(),
+                                             matchers->second.end());
+            }
+        }
+        std::sort(matcher_passes_to_run.begin(), matcher_passes_to_run.end());
+        return type_to_resolved_matchers.emplace(type_info, std::move(matcher_passes_to_run)).first->second;
+    };
+
+    // Instance ids of the nodes the matchers were run on and the number of their re-queues
+    std::unordered_set<size_t> visited;
+    std::unordered_map<size_t, size_t> requeues;
+
+    // The matchers of the nodes around a rewrite may match the changed graph, so the producers and the consumers of
+    // the rewritten node, which were already visited, are queued again. The other visited nodes are not revisited.
+    auto requeue_neighbors = [&](const std::shared_ptr<Node>& node, const std::vector<std::weak_ptr<Node>>& consumers) {
+        std::vector<std::shared_ptr<Node>> neighbors;
+        for (const auto& input : node->input_values()) {
+            neighbors.push_back(input.get_node_shared_ptr());
+        }
+        for (const auto& weak_consumer : consumers) {
+            if (auto consumer = weak_consumer.lock())
+                neighbors.push_back(consumer);
+        }
+        // Need to push nodes in reverse order to visit the producers first
+        for (auto it = neighbors.rbegin(); it != neighbors.rend(); it++) {
+            const auto& neighbor = *it;
+            if (neighbor == node || visited.count(neighbor->get_instance_id()) == 0)
+                continue;
+            auto& count = requeues[neighbor->get_instance_id()];
+            if (count == max_node_requeues)
+                continue;
+            count++;
+            nodes_to_run.emplace_front(neighbor);
+        }
+    };
+
+    auto get_consumers = [](const std::shared_ptr<Node>& node) {
+        std::vector<std::weak_ptr<Node>> consumers;
+        for (const auto& output : node->outputs()) {
+            for (const auto& input : output.get_target_inputs()) {
+                consumers.emplace_back(input.get_node()->shared_from_this());
+            }
+        }
+        return consumers;
+    };
 
     while (!nodes_to_run.empty()) {
         auto weak_node = nodes_to_run.front();
@@ -195,47 +319,43 @@ bool ov::pass::GraphRewrite::apply_matcher_passes(std::shared_ptr<Model> f,
         }
         // If all Matchers in MatcherPasses has type based root node then we apply efficient
         // algorithm for finding matchers
+        bool node_rewritten = false;
+        std::vector<std::weak_ptr<Node>> consumers;
         if (all_roots_has_type) {
-            const DiscreteTypeInfo* node_type_info = &node->get_type_info();
-            matcher_passes_to_run.clear();
-            while (node_type_info) {
-                auto matchers = type_to_matcher.find(*node_type_info);
-                if (matchers != type_to_matcher.end()) {
-                    // do not run found matchers immediately, need to collect all matchers for
-                    // parents
-                    // and sort them in order of the registration
-                    matcher_passes_to_run.insert(matcher_passes_to_run.end(),
-                                                 matchers->second.begin(),
-                                                 matchers->second.end());
-                }
-                node_type_info = node_type_info->parent;
+            const auto& matcher_passes = get_matcher_passes_to_run(&node->get_type_info());
+            if (!matcher_passes.empty()) {
+                visited.insert(node->get_instance_id());
+                consumers = get_consumers(node);
             }
-
-            std::sort(matcher_passes_to_run.begin(), matcher_passes_to_run.end());
-
-            // TODO: type_to_matcher with just collected list of matchers to enable
-            // fast processing at the next time when node with the same type will be processed
-
-            for (size_t matcher_index : matcher_passes_to_run) {
-                if (run_matcher_pass(m_matchers[matcher_index], node)) {
-                    rewritten = true;
+            for (size_t matcher_index : matcher_passes) {
+                if (run_matcher_pass(matcher_index, node)) {
+                    node_rewritten = true;
                     break;
                 }
             }
         }
         // Otherwise we use default algorithm that iterates over all registered matcher passes
         else {
-            for (auto& m_pass : m_matchers) {
+            visited.insert(node->get_instance_id());
+            consumers = get_consumers(node);
+            for (size_t matcher_index = 0; matcher_index < m_matchers.size(); ++matcher_index) {
                 // Skip passes that are disabled
-                if (pass_config->is_disabled(m_pass->get_type_info()))
+                if (pass_config->is_disabled(m_matchers[matcher_index]->get_type_info()))
                     continue;
 
-                if (run_matcher_pass(m_pass, node)) {
-                    rewritten = true;
+                if (run_matcher_pass(matcher_index, node)) {
+                    node_rewritten = true;
                     break;
                 }
             }
         }
+        if (node_rewritten) {
+            rewritten = true;
+            requeue_neighbors(node, consumers);
+        }
+    }
+    if (profile_enabled) {
+        report_matcher_pass_stats(get_name(), m_matchers, stats);
     }
     return rewritten;
 }
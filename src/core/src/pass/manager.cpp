@@ -67,6 +67,19 @@ bool ov::pass::Manager::run_passes(shared_ptr<ov::Model> func) {
     static bool profile_enabled =
         ov::util::getenv_bool("NGRAPH_PROFILE_PASS_ENABLE") || ov::util::getenv_bool("OV_PROFILE_PASS_ENABLE");
 
+    // the matcher passes of the GraphRewrites are reported under the pass
+    auto& matcher_pass_profile = ov::pass::matcher_pass_profile();
+    struct ProfileGuard {
+        ov::pass::MatcherPassProfile& profile;
+        bool enabled;
+        ~ProfileGuard() {
+            if (enabled)
+                profile.managers--;
+        }
+    } profile_guard{matcher_pass_profile, profile_enabled};
+    if (profile_enabled)
+        matcher_pass_profile.managers++;
+
     size_t index = 0;
     ngraph::stopwatch pass_timer;
     ngraph::stopwatch overall_timer;
@@ -140,6 +153,9 @@ bool ov::pass::Manager::run_passes(shared_ptr<ov::Model> func) {
         pass_timer.stop();
         if (profile_enabled) {
             cout << setw(7) << pass_timer.get_milliseconds() << "ms " << pass->get_name() << "\n";
+            for (const auto& line : matcher_pass_profile.lines)
+                cout << line << "\n";
+            matcher_pass_profile.lines.clear();
         }
         function_changed = function_changed || pass_applied;
         needs_validate = pass_applied;
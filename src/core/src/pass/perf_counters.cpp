@@ -12,5 +12,10 @@ openvino::itt::handle_t PerfCounters::operator[](::ngraph::Node::type_info_t con
         return it->second;
     return m_counters[&type_inf] = openvino::itt::handle(type_inf.name);
 }
+
+MatcherPassProfile& matcher_pass_profile() {
+    static thread_local MatcherPassProfile profile;
+    return profile;
+}
 }  // namespace pass
 }  // namespace ov
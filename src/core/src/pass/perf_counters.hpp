@@ -5,7 +5,9 @@
 #include <itt.hpp>
 #include <mutex>
 #include <ngraph/node.hpp>
+#include <string>
 #include <unordered_map>
+#include <vector>
 
 namespace ov {
 namespace pass {
@@ -26,5 +28,14 @@ private:
     std::mutex m_mutex;
     counters_map m_counters;
 };
+
+/// \brief Report of the matcher passes run by the GraphRewrites of the calling thread with OV_PROFILE_PASS_ENABLE.
+/// Manager prints the lines under the timing of the pass, the GraphRewrites run outside Manager print them at once.
+struct MatcherPassProfile {
+    size_t managers = 0;
+    std::vector<std::string> lines;
+};
+
+MatcherPassProfile& matcher_pass_profile();
 }  // namespace pass
 }  // namespace ov
@@ -0,0 +1,233 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <cstddef>
+#include <deque>
+#include <iterator>
+#include <memory>
+#include <new>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+#include "openvino/core/descriptor/input.hpp"
+#include "openvino/core/descriptor/output.hpp"
+#include "openvino/core/node.hpp"
+
+namespace ov {
+namespace descriptor {
+/// \brief Sequence container for input and output descriptors of a Node.
+///
+/// Descriptors are referenced by raw pointers from other nodes, so elements must never be
+/// relocated when the container grows. std::deque gives this guarantee, but allocates its map
+/// and the first chunk even when empty. PortVector keeps first InlineCapacity elements inside
+/// the owning object and creates the overflow storage only for nodes with many ports.
+///
+/// \tparam T               Element type.
+/// \tparam InlineCapacity  Number of elements stored without heap allocation.
+template <typename T, size_t InlineCapacity>
+class PortVector {
+    template <typename Container, typename Value>
+    class Iterator {
+    public:
+        using iterator_category = std::random_access_iterator_tag;
+        using value_type = typename std::remove_const<Value>::type;
+        using difference_type = std::ptrdiff_t;
+        using pointer = Value*;
+        using reference = Value&;
+
+        Iterator() : m_container(nullptr), m_index(0) {}
+        Iterator(Container* container, size_t index) : m_container(container), m_index(index) {}
+
+        reference operator*() const {
+            return (*m_container)[m_index];
+        }
+        pointer operator->() const {
+            return &(*m_container)[m_index];
+        }
+        reference operator[](difference_type n) const {
+            return (*m_container)[m_index + n];
+        }
+        Iterator& operator++() {
+            ++m_index;
+            return *this;
+        }
+        Iterator operator++(int) {
+            auto tmp = *this;
+            ++m_index;
+            return tmp;
+        }
+        Iterator& operator--() {
+            --m_index;
+            return *this;
+        }
+        Iterator operator--(int) {
+            auto tmp = *this;
+            --m_index;
+            return tmp;
+        }
+        Iterator& operator+=(difference_type n) {
+            m_index += n;
+            return *this;
+        }
+        Iterator& operator-=(difference_type n) {
+            m_index -= n;
+            return *this;
+        }
+        Iterator operator+(difference_type n) const {
+            return Iterator(m_container, m_index + n);
+        }
+        friend Iterator operator+(difference_type n, const Iterator& it) {
+            return it + n;
+        }
+        Iterator operator-(difference_type n) const {
+            return Iterator(m_container, m_index - n);
+        }
+        difference_type operator-(const Iterator& other) const {
+            return static_cast<difference_type>(m_index) - static_cast<difference_type>(other.m_index);
+        }
+        bool operator==(const Iterator& other) const {
+            return m_index == other.m_index && m_container == other.m_container;
+        }
+        bool operator!=(const Iterator& other) const {
+            return !(*this == other);
+        }
+        bool operator<(const Iterator& other) const {
+            return m_index < other.m_index;
+        }
+        bool operator>(const Iterator& other) const {
+            return other < *this;
+        }
+        bool operator<=(const Iterator& other) const {
+            return !(other < *this);
+        }
+        bool operator>=(const Iterator& other) const {
+            return !(*this < other);
+        }
+
+    private:
+        Container* m_container;
+        size_t m_index;
+    };
+
+public:
+    using value_type = T;
+    using size_type = size_t;
+    using iterator = Iterator<PortVector, T>;
+    using const_iterator = Iterator<const PortVector, const T>;
+
+    PortVector() = default;
+
+    PortVector(const PortVector& other) {
+        for (const auto& value : other) {
+            emplace_back(value);
+        }
+    }
+
+    PortVector& operator=(const PortVector& other) {
+        if (this != &other) {
+            clear();
+            for (const auto& value : other) {
+                emplace_back(value);
+            }
+        }
+        return *this;
+    }
+
+    ~PortVector() {
+        clear();
+    }
+
+    template <typename... Args>
+    T& emplace_back(Args&&... args) {
+        if (m_inline_size < InlineCapacity) {
+            T* value = new (inline_data() + m_inline_size) T(std::forward<Args>(args)...);
+            ++m_inline_size;
+            return *value;
+        }
+        if (!m_overflow) {
+            m_overflow.reset(new std::deque<T>());
+        }
+        m_overflow->emplace_back(std::forward<Args>(args)...);
+        return m_overflow->back();
+    }
+
+    void clear() {
+        m_overflow.reset();
+        while (m_inline_size > 0) {
+            --m_inline_size;
+            inline_data()[m_inline_size].~T();
+        }
+    }
+
+    size_t size() const {
+        return m_inline_size + (m_overflow ? m_overflow->size() : 0);
+    }
+
+    bool empty() const {
+        return size() == 0;
+    }
+
+    T& operator[](size_t index) {
+        return index < InlineCapacity ? inline_data()[index] : (*m_overflow)[index - InlineCapacity];
+    }
+
+    const T& operator[](size_t index) const {
+        return index < InlineCapacity ? inline_data()[index] : (*m_overflow)[index - InlineCapacity];
+    }
+
+    T& at(size_t index) {
+        if (index >= size())
+            throw std::out_of_range("PortVector index is out of range");
+        return (*this)[index];
+    }
+
+    const T& at(size_t index) const {
+        if (index >= size())
+            throw std::out_of_range("PortVector index is out of range");
+        return (*this)[index];
+    }
+
+    iterator begin() {
+        return iterator(this, 0);
+    }
+    iterator end() {
+        return iterator(this, size());
+    }
+    const_iterator begin() const {
+        return const_iterator(this, 0);
+    }
+    const_iterator end() const {
+        return const_iterator(this, size());
+    }
+
+private:
+    T* inline_data() {
+        return reinterpret_cast<T*>(m_inline_storage);
+    }
+    const T* inline_data() const {
+        return reinterpret_cast<const T*>(m_inline_storage);
+    }
+
+    alignas(T) unsigned char m_inline_storage[sizeof(T) * InlineCapacity];
+    size_t m_inline_size = 0;
+    std::unique_ptr<std::deque<T>> m_overflow;
+};
+}  // namespace descriptor
+}  // namespace ov
+
+/// \brief Input and output descriptors of a Node.
+///
+/// Most operations have at most two inputs and a single output, they are kept inline, so a node allocates
+/// a single block for all its descriptors.
+struct ov::Node::Ports {
+    Ports() = default;
+    // the outputs are not copied, the copy of a node creates its own outputs
+    explicit Ports(const descriptor::PortVector<descriptor::Input, 2>& other_inputs) : inputs(other_inputs) {}
+
+    descriptor::PortVector<descriptor::Input, 2> inputs;
+    descriptor::PortVector<descriptor::Output, 1> outputs;
+};
@@ -0,0 +1,252 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "openvino/runtime/strided_copy.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <limits>
+#include <type_traits>
+
+#include "ngraph/runtime/reference/convert.hpp"
+#include "openvino/core/except.hpp"
+#include "openvino/core/parallel.hpp"
+
+namespace ov {
+namespace util {
+namespace {
+
+// Number of elements copied by a single thread below which the copy stays single-threaded
+constexpr size_t min_chunk_size = 1 << 16;
+
+// Splits [0, work_amount) into contiguous chunks processed on the threads of the caller's arena
+template <typename F>
+void for_chunks(const size_t work_amount, const size_t min_chunk, const F& func) {
+    const size_t nchunks = std::min(static_cast<size_t>(std::max(parallel_get_max_threads(), 1)),
+                                    work_amount / std::max<size_t>(min_chunk, 1));
+    if (nchunks <= 1) {
+        func(0, work_amount);
+        return;
+    }
+    ov::parallel_for(nchunks, [&](size_t chunk) {
+        size_t start = 0, end = 0;
+        ov::splitter(work_amount, nchunks, chunk, start, end);
+        func(start, end);
+    });
+}
+
+template <typename T>
+struct is_floating : std::integral_constant<bool,
+                                            std::is_floating_point<T>::value || std::is_same<T, ov::float16>::value ||
+                                                std::is_same<T, ov::bfloat16>::value> {};
+
+// The floating point values are rounded to the nearest and saturated, when converted to the integers,
+// the same as the JIT converters of the reference convert do
+template <typename TO, typename TI>
+typename std::enable_if<is_floating<TI>::value && std::is_integral<TO>::value, TO>::type convert_value(TI value) {
+    const float f = static_cast<float>(value);
+    if (std::isnan(f))
+        return TO{0};
+    const float lowest = static_cast<float>(std::numeric_limits<TO>::lowest());
+    const float highest = static_cast<float>(std::numeric_limits<TO>::max());
+    return static_cast<TO>(std::nearbyint(std::min(std::max(f, lowest), highest)));
+}
+
+template <typename TO, typename TI>
+typename std::enable_if<!(is_floating<TI>::value && std::is_integral<TO>::value), TO>::type convert_value(TI value) {
+    return static_cast<TO>(value);
+}
+
+// Copies a row of count elements, the strides are in bytes
+using RowKernel = void (*)(const uint8_t* src, size_t src_stride, uint8_t* dst, size_t dst_stride, size_t count);
+
+template <typename TI, typename TO>
+void convert_row(const uint8_t* src, size_t src_stride, uint8_t* dst, size_t dst_stride, size_t count) {
+    // the reference convert casts the floating point values to the integers without the saturation
+    constexpr bool saturate = is_floating<TI>::value && std::is_integral<TO>::value;
+    if (src_stride == sizeof(TI) && dst_stride == sizeof(TO) && !saturate) {
+        // dense rows go to the vectorized conversion
+        ngraph::runtime::reference::convert(reinterpret_cast<const TI*>(src), reinterpret_cast<TO*>(dst), count);
+        return;
+    }
+    for_chunks(count, min_chunk_size, [&](size_t start, size_t end) {
+        for (size_t i = start; i < end; ++i) {
+            *reinterpret_cast<TO*>(dst + i * dst_stride) =
+                convert_value<TO>(*reinterpret_cast<const TI*>(src + i * src_stride));
+        }
+    });
+}
+
+template <typename TI>
+RowKernel get_convert_kernel(const element::Type& dst_type) {
+    switch (dst_type) {
+    case element::f32:
+        return convert_row<TI, float>;
+    case element::f16:
+        return convert_row<TI, ov::float16>;
+    case element::bf16:
+        return convert_row<TI, ov::bfloat16>;
+    case element::u8:
+        return convert_row<TI, uint8_t>;
+    default:
+        return nullptr;
+    }
+}
+
+RowKernel get_convert_kernel(const element::Type& src_type, const element::Type& dst_type) {
+    switch (src_type) {
+    case element::f32:
+        return get_convert_kernel<float>(dst_type);
+    case element::f16:
+        return get_convert_kernel<ov::float16>(dst_type);
+    case element::bf16:
+        return get_convert_kernel<ov::bfloat16>(dst_type);
+    case element::u8:
+        return get_convert_kernel<uint8_t>(dst_type);
+    default:
+        return nullptr;
+    }
+}
+
+Strides dense_byte_strides(const Shape& shape, size_t element_size) {
+    Strides strides(shape.size());
+    size_t stride = element_size;
+    for (size_t i = shape.size(); i > 0; --i) {
+        strides[i - 1] = stride;
+        stride *= shape[i - 1];
+    }
+    return strides;
+}
+
+// Shape and strides, where the dimensions of size 1 are dropped and the dimensions,
+// which are contiguous in both the source and the destination, are merged
+struct CoalescedLayout {
+    Shape shape;
+    Strides src_strides;
+    Strides dst_strides;
+};
+
+CoalescedLayout coalesce(const Shape& shape, const Strides& src_strides, const Strides& dst_strides) {
+    CoalescedLayout layout;
+    for (size_t i = 0; i < shape.size(); ++i) {
+        if (shape[i] == 1)
+            continue;
+        if (!layout.shape.empty() && layout.src_strides.back() == src_strides[i] * shape[i] &&
+            layout.dst_strides.back() == dst_strides[i] * shape[i]) {
+            layout.shape.back() *= shape[i];
+            layout.src_strides.back() = src_strides[i];
+            layout.dst_strides.back() = dst_strides[i];
+            continue;
+        }
+        layout.shape.push_back(shape[i]);
+        layout.src_strides.push_back(src_strides[i]);
+        layout.dst_strides.push_back(dst_strides[i]);
+    }
+    if (layout.shape.empty()) {
+        // a single element
+        layout.shape.push_back(1);
+        layout.src_strides.push_back(0);
+        layout.dst_strides.push_back(0);
+    }
+    return layout;
+}
+
+}  // namespace
+
+bool is_strided_copy_supported(const element::Type& src_type, const element::Type& dst_type) {
+    if (src_type.bitwidth() < 8 || dst_type.bitwidth() < 8)
+        return false;
+    return src_type == dst_type || get_convert_kernel(src_type, dst_type) != nullptr;
+}
+
+void strided_copy(const void* src,
+                  const element::Type& src_type,
+                  const Strides& src_strides,
+                  void* dst,
+                  const element::Type& dst_type,
+                  const Strides& dst_strides,
+                  const Shape& shape) {
+    OPENVINO_ASSERT(is_strided_copy_supported(src_type, dst_type),
+                    "Copy from ",
+                    src_type,
+                    " to ",
+                    dst_type,
+                    " is not supported.");
+    OPENVINO_ASSERT(src_strides.empty() || src_strides.size() == shape.size(),
+                    "Source strides rank doesn't match the shape.");
+    OPENVINO_ASSERT(dst_strides.empty() || dst_strides.size() == shape.size(),
+                    "Destination strides rank doesn't match the shape.");
+    if (shape_size(shape) == 0)
+        return;
+    // the dense rows are converted by the reference kernels, which split the long rows between the threads
+    ngraph::runtime::reference::ParallelScope parallel_scope;
+
+    const auto layout = coalesce(shape,
+                                 src_strides.empty() ? dense_byte_strides(shape, src_type.size()) : src_strides,
+                                 dst_strides.empty() ? dense_byte_strides(shape, dst_type.size()) : dst_strides);
+    const size_t rank = layout.shape.size();
+    const size_t row_size = layout.shape.back();
+    const size_t src_row_stride = layout.src_strides.back();
+    const size_t dst_row_stride = layout.dst_strides.back();
+    const size_t rows = shape_size(layout.shape) / row_size;
+
+    const bool same_type = src_type == dst_type;
+    const bool dense_rows = src_row_stride == src_type.size() && dst_row_stride == dst_type.size();
+    const RowKernel convert = same_type ? nullptr : get_convert_kernel(src_type, dst_type);
+    const auto* src_data = static_cast<const uint8_t*>(src);
+    auto* dst_data = static_cast<uint8_t*>(dst);
+
+    // the long rows are split between the threads, the short ones are copied by the calling thread
+    const auto copy_row = [&](const uint8_t* src_row, uint8_t* dst_row) {
+        if (!same_type) {
+            convert(src_row, src_row_stride, dst_row, dst_row_stride, row_size);
+            return;
+        }
+        const size_t element_size = src_type.size();
+        for_chunks(row_size, min_chunk_size, [&](size_t start, size_t end) {
+            if (dense_rows) {
+                std::memcpy(dst_row + start * element_size,
+                            src_row + start * element_size,
+                            (end - start) * element_size);
+                return;
+            }
+            for (size_t i = start; i < end; ++i)
+                std::memcpy(dst_row + i * dst_row_stride, src_row + i * src_row_stride, element_size);
+        });
+    };
+
+    const auto copy_rows = [&](size_t start, size_t end) {
+        // position of the row in the outer dimensions
+        Shape pos(rank - 1, 0);
+        size_t src_offset = 0, dst_offset = 0;
+        for (size_t i = rank - 1, rest = start; i > 0; --i) {
+            pos[i - 1] = rest % layout.shape[i - 1];
+            rest /= layout.shape[i - 1];
+            src_offset += pos[i - 1] * layout.src_strides[i - 1];
+            dst_offset += pos[i - 1] * layout.dst_strides[i - 1];
+        }
+        for (size_t row = start; row < end; ++row) {
+            copy_row(src_data + src_offset, dst_data + dst_offset);
+            for (size_t i = rank - 1; i > 0; --i) {
+                src_offset += layout.src_strides[i - 1];
+                dst_offset += layout.dst_strides[i - 1];
+                if (++pos[i - 1] < layout.shape[i - 1])
+                    break;
+                src_offset -= pos[i - 1] * layout.src_strides[i - 1];
+                dst_offset -= pos[i - 1] * layout.dst_strides[i - 1];
+                pos[i - 1] = 0;
+            }
+        }
+    };
+
+    if (rows == 1 || row_size >= min_chunk_size) {
+        copy_rows(0, rows);
+    } else {
+        for_chunks(rows, min_chunk_size / row_size, copy_rows);
+    }
+}
+
+}  // namespace util
+}  // namespace ov
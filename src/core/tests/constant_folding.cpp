@@ -656,6 +656,51 @@ TEST(constant_folding, const_convert) {
     }
 }
 
+TEST(constant_folding, independent_weights_subgraphs) {
+    // Several independent Convert -> Transpose -> Multiply chains, both small tensors which are folded
+    // concurrently and large tensors which are folded by multi-threaded kernels
+    const std::vector<Shape> shapes{{4, 3}, {16, 8}, {2, 3}, {512, 300}, {300, 512}};
+    OutputVector results;
+    std::vector<std::vector<float>> expected;
+    for (const auto& shape : shapes) {
+        const auto size = shape_size(shape);
+        std::vector<int8_t> weights(size);
+        for (size_t i = 0; i < size; ++i) {
+            weights[i] = static_cast<int8_t>(i % 127);
+        }
+        auto weights_const = op::Constant::create(element::i8, shape, weights);
+        auto convert = std::make_shared<op::v0::Convert>(weights_const, element::f32);
+        auto transpose =
+            std::make_shared<op::v1::Transpose>(convert, op::Constant::create(element::i64, Shape{2}, {1, 0}));
+        auto multiply =
+            std::make_shared<op::v1::Multiply>(transpose, op::Constant::create(element::f32, Shape{}, {0.5f}));
+        results.push_back(multiply);
+
+        std::vector<float> values(size);
+        for (size_t row = 0; row < shape[1]; ++row) {
+            for (size_t col = 0; col < shape[0]; ++col) {
+                values[row * shape[0] + col] = weights[col * shape[1] + row] * 0.5f;
+            }
+        }
+        expected.push_back(values);
+    }
+    auto model = std::make_shared<Function>(results, ParameterVector{});
+
+    pass::Manager pass_manager;
+    pass_manager.register_pass<pass::ConstantFolding>();
+    pass_manager.run_passes(model);
+
+    ASSERT_EQ(count_ops_of_type<op::v0::Convert>(model), 0);
+    ASSERT_EQ(count_ops_of_type<op::v1::Transpose>(model), 0);
+    ASSERT_EQ(count_ops_of_type<op::v1::Multiply>(model), 0);
+    for (size_t i = 0; i < shapes.size(); ++i) {
+        auto result_const = get_result_constant(model, i);
+        ASSERT_TRUE(result_const);
+        ASSERT_EQ(result_const->get_shape(), (Shape{shapes[i][1], shapes[i][0]}));
+        ASSERT_EQ(result_const->cast_vector<float>(), expected[i]);
+    }
+}
+
 TEST(constant_folding, shape_of_v0) {
     Shape input_shape{3, 4, 0, 22, 608, 909, 3};
 
@@ -4,10 +4,15 @@
 
 #include <gtest/gtest.h>
 
+#include <functional>
+#include <map>
+#include <string>
+
 #include <common_test_utils/ngraph_test_utils.hpp>
 #include <ngraph/opsets/opset3.hpp>
 #include <ngraph/pass/graph_rewrite.hpp>
 #include <ngraph/pass/manager.hpp>
+#include <ngraph/pattern/op/wrap_type.hpp>
 
 NGRAPH_SUPPRESS_DEPRECATED_START
 
@@ -442,3 +447,243 @@ TEST(GraphRewriteTest, nodes_use_count) {
     m.register_pass<CheckConsumers>();
     ASSERT_NO_THROW(m.run_passes(f));
 }
+
+// Type based MatcherPass, the root of the pattern is wrap_type of the given types
+class TypeBasedCallbackPass : public ngraph::pass::MatcherPass {
+public:
+    using Callback = std::function<bool(const std::shared_ptr<Node>& root, TypeBasedCallbackPass& pass)>;
+
+    TypeBasedCallbackPass(const std::shared_ptr<Node>& pattern, const Callback& callback) : MatcherPass() {
+        ngraph::matcher_pass_callback matcher_callback = [this, callback](pattern::Matcher& m) {
+            return callback(m.get_match_root(), *this);
+        };
+        auto m = std::make_shared<ngraph::pattern::Matcher>(pattern, "TypeBasedCallbackPass");
+        this->register_matcher(m, matcher_callback);
+    }
+};
+
+// Replaces the root with Relu or Tanh of its first input
+TypeBasedCallbackPass::Callback replace_with(bool relu) {
+    return [relu](const std::shared_ptr<Node>& root, TypeBasedCallbackPass&) {
+        std::shared_ptr<Node> replacement;
+        if (relu)
+            replacement = std::make_shared<ngraph::opset3::Relu>(root->input_value(0));
+        else
+            replacement = std::make_shared<ngraph::opset3::Tanh>(root->input_value(0));
+        ngraph::replace_node(root, replacement);
+        return true;
+    };
+}
+
+// Divide -> PrivateDivide -> Divide, the nodes of the same type are resolved once per run
+std::shared_ptr<Function> get_mixed_function() {
+    auto data = std::make_shared<ngraph::opset3::Parameter>(ngraph::element::f32, ngraph::Shape{3, 1, 2});
+    auto constant = ngraph::opset3::Constant::create(ngraph::element::f32, ngraph::Shape{1}, {1.5});
+    auto divide1 = std::make_shared<ngraph::opset3::Divide>(data, constant);
+    auto divide2 = std::make_shared<PrivateDivide>(divide1, constant);
+    auto divide3 = std::make_shared<ngraph::opset3::Divide>(divide2, constant);
+    return std::make_shared<ngraph::Function>(ngraph::NodeVector{divide3}, ngraph::ParameterVector{data});
+}
+
+TEST(GraphRewriteTest, TypeBasedMatcherPassOnBaseType) {
+    auto f = get_mixed_function();
+
+    Anchor anchor;
+    anchor.add_matcher<TypeBasedCallbackPass>(
+        ngraph::pattern::wrap_type<ov::op::util::BinaryElementwiseArithmetic>(),
+        replace_with(true));
+    anchor.run_on_model(f);
+
+    ASSERT_EQ(count_ops_of_type<opset3::Divide>(f), 0);
+    ASSERT_EQ(count_ops_of_type<opset3::Relu>(f), 3);
+}
+
+TEST(GraphRewriteTest, TypeBasedMatcherPassOnBaseTypeAfterAddingMatchers) {
+    Anchor anchor;
+    anchor.add_matcher<TypeBasedCallbackPass>(
+        ngraph::pattern::wrap_type<ov::op::util::BinaryElementwiseArithmetic>(),
+        replace_with(true));
+    auto f = get_mixed_function();
+    anchor.run_on_model(f);
+    ASSERT_EQ(count_ops_of_type<opset3::Relu>(f), 3);
+
+    // the matcher of the base type was registered first, so it still takes the derived nodes
+    anchor.add_matcher<TypeBasedCallbackPass>(ngraph::pattern::wrap_type<PrivateDivide>(), replace_with(false));
+    f = get_mixed_function();
+    anchor.run_on_model(f);
+    ASSERT_EQ(count_ops_of_type<opset3::Divide>(f), 0);
+    ASSERT_EQ(count_ops_of_type<opset3::Relu>(f), 3);
+    ASSERT_EQ(count_ops_of_type<opset3::Tanh>(f), 0);
+
+    // the matchers of the derived type registered first take the derived nodes only
+    Anchor derived_first;
+    derived_first.add_matcher<TypeBasedCallbackPass>(ngraph::pattern::wrap_type<PrivateDivide>(), replace_with(false));
+    derived_first.add_matcher<TypeBasedCallbackPass>(
+        ngraph::pattern::wrap_type<ov::op::util::BinaryElementwiseArithmetic>(),
+        replace_with(true));
+    f = get_mixed_function();
+    derived_first.run_on_model(f);
+    ASSERT_EQ(count_ops_of_type<opset3::Divide>(f), 0);
+    ASSERT_EQ(count_ops_of_type<opset3::Relu>(f), 2);
+    ASSERT_EQ(count_ops_of_type<opset3::Tanh>(f), 1);
+}
+
+TEST(GraphRewriteOrderTest, TypeBasedMatcherPass) {
+    auto f = get_mixed_function();
+
+    // the matcher of the root type visits all the nodes in the topological order
+    NodeVector order;
+    Anchor anchor;
+    anchor.add_matcher<TypeBasedCallbackPass>(ngraph::pattern::wrap_type<ov::op::Op>(),
+                                              [&order](const std::shared_ptr<Node>& root, TypeBasedCallbackPass&) {
+                                                  order.push_back(root);
+                                                  return false;
+                                              });
+    anchor.run_on_model(f);
+
+    ASSERT_EQ(order, f->get_ordered_ops());
+}
+
+TEST(GraphRewriteOrderTest, TypeBasedMatcherPassCascading) {
+    auto data = std::make_shared<ngraph::opset3::Parameter>(ngraph::element::f32, ngraph::Shape{3, 1, 2});
+    auto constant = ngraph::opset3::Constant::create(ngraph::element::f32, ngraph::Shape{1}, {1.5});
+    auto divide = std::make_shared<ngraph::opset3::Divide>(data, constant);
+    auto relu = std::make_shared<ngraph::opset3::Relu>(divide);
+    relu->set_friendly_name("relu");
+    auto f = std::make_shared<ngraph::Function>(ngraph::NodeVector{relu}, ngraph::ParameterVector{data});
+
+    // the registered nodes are visited right after the rewrite, before the rest of the queue
+    std::vector<std::string> order;
+    Anchor anchor;
+    anchor.add_matcher<TypeBasedCallbackPass>(ngraph::pattern::wrap_type<opset3::Divide>(),
+                                              [](const std::shared_ptr<Node>& root, TypeBasedCallbackPass& pass) {
+                                                  auto new_relu = pass.register_new_node<opset3::Relu>(
+                                                      root->input_value(0));
+                                                  new_relu->set_friendly_name("new_relu");
+                                                  ngraph::replace_node(root, new_relu);
+                                                  return true;
+                                              });
+    anchor.add_matcher<TypeBasedCallbackPass>(ngraph::pattern::wrap_type<opset3::Relu>(),
+                                              [&order](const std::shared_ptr<Node>& root, TypeBasedCallbackPass&) {
+                                                  order.push_back(root->get_friendly_name());
+                                                  return false;
+                                              });
+    anchor.run_on_model(f);
+
+    ASSERT_EQ(order, (std::vector<std::string>{"new_relu", "relu"}));
+}
+
+TEST(GraphRewriteTest, TypeBasedMatcherPassOnWrappedTypes) {
+    auto f = get_mixed_function();
+    auto relu = std::make_shared<ngraph::opset3::Relu>(f->get_results()[0]->input_value(0));
+    f->get_results()[0]->input(0).replace_source_output(relu);
+
+    // the matcher of several types fires on each of them and on the types derived from them
+    std::vector<std::string> matched;
+    Anchor anchor;
+    anchor.add_matcher<TypeBasedCallbackPass>(ngraph::pattern::wrap_type<opset3::Relu, opset3::Divide>(),
+                                              [&matched](const std::shared_ptr<Node>& root, TypeBasedCallbackPass&) {
+                                                  matched.push_back(root->get_type_name());
+                                                  return false;
+                                              });
+    anchor.run_on_model(f);
+
+    ASSERT_EQ(matched, (std::vector<std::string>{"Divide", "PrivateDivide", "Divide", "Relu"}));
+}
+
+// Replaces Divide with Multiply if all its consumers are Relu
+TypeBasedCallbackPass::Callback divide_to_multiply(std::map<std::string, size_t>& visits) {
+    return [&visits](const std::shared_ptr<Node>& root, TypeBasedCallbackPass&) {
+        visits[root->get_friendly_name()]++;
+        for (const auto& input : root->output(0).get_target_inputs()) {
+            if (!ov::is_type<opset3::Relu>(input.get_node()))
+                return false;
+        }
+        auto multiply = std::make_shared<ngraph::opset3::Multiply>(root->input_value(0), root->input_value(1));
+        ngraph::replace_node(root, multiply);
+        return true;
+    };
+}
+
+TEST(GraphRewriteTest, ProducersAreRevisitedAfterRewrite) {
+    auto data = std::make_shared<ngraph::opset3::Parameter>(ngraph::element::f32, ngraph::Shape{3, 1, 2});
+    auto constant = ngraph::opset3::Constant::create(ngraph::element::f32, ngraph::Shape{1}, {1.5});
+    auto divide = std::make_shared<ngraph::opset3::Divide>(data, constant);
+    divide->set_friendly_name("divide");
+    auto tanh = std::make_shared<ngraph::opset3::Tanh>(divide);
+    // the branch is not touched by the rewrites
+    auto other_divide = std::make_shared<ngraph::opset3::Divide>(data, constant);
+    other_divide->set_friendly_name("other_divide");
+    auto sigmoid = std::make_shared<ngraph::opset3::Sigmoid>(other_divide);
+    auto f = std::make_shared<ngraph::Function>(ngraph::NodeVector{tanh, sigmoid}, ngraph::ParameterVector{data});
+
+    std::map<std::string, size_t> visits;
+    Anchor anchor;
+    anchor.add_matcher<TypeBasedCallbackPass>(ngraph::pattern::wrap_type<opset3::Divide>(), divide_to_multiply(visits));
+    anchor.add_matcher<TypeBasedCallbackPass>(ngraph::pattern::wrap_type<opset3::Tanh>(), replace_with(true));
+    ASSERT_TRUE(anchor.run_on_model(f));
+
+    // the Tanh replaced with Relu after its producer was visited enables the rewrite of the producer
+    ASSERT_EQ(count_ops_of_type<opset3::Tanh>(f), 0);
+    ASSERT_EQ(count_ops_of_type<opset3::Multiply>(f), 1);
+    ASSERT_EQ(count_ops_of_type<opset3::Divide>(f), 1);
+    ASSERT_EQ(visits, (std::map<std::string, size_t>{{"divide", 2}, {"other_divide", 1}}));
+    ASSERT_NO_THROW(f->validate_nodes_and_infer_types());
+}
+
+TEST(BackwardGraphRewriteTest, ConsumersAreRevisitedAfterRewrite) {
+    auto data = std::make_shared<ngraph::opset3::Parameter>(ngraph::element::f32, ngraph::Shape{3, 1, 2});
+    auto constant = ngraph::opset3::Constant::create(ngraph::element::f32, ngraph::Shape{1}, {1.5});
+    auto divide = std::make_shared<ngraph::opset3::Divide>(data, constant);
+    divide->set_friendly_name("divide");
+    auto tanh = std::make_shared<ngraph::opset3::Tanh>(divide);
+    auto relu = std::make_shared<ngraph::opset3::Relu>(tanh);
+    auto f = std::make_shared<ngraph::Function>(ngraph::NodeVector{relu}, ngraph::ParameterVector{data});
+
+    // Relu is visited first and doesn't match until its producer Tanh is folded
+    std::map<std::string, size_t> visits;
+    size_t relu_visits = 0;
+    auto remove_relu_after_divide = [&relu_visits](const std::shared_ptr<Node>& root, TypeBasedCallbackPass&) {
+        relu_visits++;
+        if (!ov::is_type<opset3::Divide>(root->get_input_node_ptr(0)))
+            return false;
+        return ngraph::replace_output_update_name(root->output(0), root->input_value(0));
+    };
+    ngraph::pass::BackwardGraphRewrite anchor;
+    anchor.add_matcher<TypeBasedCallbackPass>(ngraph::pattern::wrap_type<opset3::Relu>(), remove_relu_after_divide);
+    anchor.add_matcher<TypeBasedCallbackPass>(ngraph::pattern::wrap_type<opset3::Tanh>(),
+                                              [](const std::shared_ptr<Node>& root, TypeBasedCallbackPass&) {
+                                                  return ngraph::replace_output_update_name(root->output(0),
+                                                                                            root->input_value(0));
+                                              });
+    anchor.add_matcher<TypeBasedCallbackPass>(ngraph::pattern::wrap_type<opset3::Divide>(), divide_to_multiply(visits));
+    ASSERT_TRUE(anchor.run_on_model(f));
+
+    ASSERT_EQ(relu_visits, 2);
+    ASSERT_EQ(count_ops_of_type<opset3::Relu>(f), 0);
+    ASSERT_EQ(count_ops_of_type<opset3::Tanh>(f), 0);
+    ASSERT_EQ(count_ops_of_type<opset3::Divide>(f), 1);
+    // the Divide took the name of the removed Relu, it is visited once
+    ASSERT_EQ(visits.size(), 1);
+    ASSERT_EQ(visits.begin()->second, 1);
+}
+
+TEST(GraphRewriteTest, RequeuesAreLimited) {
+    auto data = std::make_shared<ngraph::opset3::Parameter>(ngraph::element::f32, ngraph::Shape{3, 1, 2});
+    auto relu1 = std::make_shared<ngraph::opset3::Relu>(data);
+    auto relu2 = std::make_shared<ngraph::opset3::Relu>(relu1);
+    auto f = std::make_shared<ngraph::Function>(ngraph::NodeVector{relu2}, ngraph::ParameterVector{data});
+
+    // the callback reports a change it didn't make, the neighbors are re-queued a limited number of times
+    size_t calls = 0;
+    Anchor anchor;
+    anchor.add_matcher<TypeBasedCallbackPass>(ngraph::pattern::wrap_type<opset3::Relu>(),
+                                              [&calls](const std::shared_ptr<Node>&, TypeBasedCallbackPass&) {
+                                                  calls++;
+                                                  return true;
+                                              });
+    ASSERT_TRUE(anchor.run_on_model(f));
+
+    ASSERT_GT(calls, 2);
+    ASSERT_LE(calls, 10);
+}
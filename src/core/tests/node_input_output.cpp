@@ -2,13 +2,25 @@
 // SPDX-License-Identifier: Apache-2.0
 //
 
+#include <chrono>
+#include <cstdio>
+#include <fstream>
+#include <functional>
 #include <memory>
 #include <sstream>
 #include <string>
 #include <vector>
 
+#ifdef __linux__
+#    include <unistd.h>
+#endif
+
+#include "common_test_utils/common_utils.hpp"
 #include "gtest/gtest.h"
 #include "ngraph/ngraph.hpp"
+#include "openvino/pass/serialize.hpp"
+#include "openvino/util/log.hpp"
+#include "pass/serialization/read_ir.hpp"
 
 NGRAPH_SUPPRESS_DEPRECATED_START
 
@@ -150,3 +162,96 @@ TEST(node_input_output, create_wrong_input_output) {
     EXPECT_THROW(ov::Input<ov::Node>(nullptr, 0), ov::Exception);
     EXPECT_THROW(ov::Input<const ov::Node>(nullptr, 0), ov::Exception);
 }
+
+TEST(node_input_output, many_inputs_outputs_keep_connections) {
+    // Inputs and outputs beyond the inline capacity of a node must not be relocated,
+    // consumers and producers keep raw pointers to them.
+    ParameterVector params;
+    OutputVector concat_args;
+    for (size_t i = 0; i < 16; ++i) {
+        params.push_back(make_shared<op::Parameter>(element::f32, Shape{1, 2}));
+        concat_args.push_back(params.back());
+    }
+    auto concat = make_shared<op::v0::Concat>(concat_args, 0);
+    auto axis = op::Constant::create(element::i64, Shape{}, {1});
+    auto split = make_shared<op::v1::Split>(concat, axis, 2);
+
+    ASSERT_EQ(concat->get_input_size(), 16);
+    for (size_t i = 0; i < params.size(); ++i) {
+        const auto targets = params[i]->output(0).get_target_inputs();
+        ASSERT_EQ(targets.size(), 1);
+        EXPECT_EQ(targets.begin()->get_node(), concat.get());
+        EXPECT_EQ(targets.begin()->get_index(), i);
+        EXPECT_EQ(concat->input_value(i), params[i]->output(0));
+    }
+    ASSERT_EQ(split->get_output_size(), 2);
+    EXPECT_EQ(split->output(1).get_shape(), (Shape{16, 1}));
+
+    auto clone = concat->clone_with_new_inputs(concat_args);
+    for (size_t i = 0; i < params.size(); ++i) {
+        EXPECT_EQ(params[i]->output(0).get_target_inputs().size(), 2);
+        EXPECT_EQ(clone->input_value(i), params[i]->output(0));
+    }
+    clone.reset();
+    for (const auto& param : params) {
+        EXPECT_EQ(param->output(0).get_target_inputs().size(), 1);
+    }
+}
+
+namespace {
+// resident memory of the process in KB, 0 where it is not available
+int64_t get_resident_kb() {
+#ifdef __linux__
+    std::ifstream statm("/proc/self/statm");
+    int64_t size = 0, resident = 0;
+    statm >> size >> resident;
+    return resident * static_cast<int64_t>(sysconf(_SC_PAGESIZE)) / 1024;
+#else
+    return 0;
+#endif
+}
+}  // namespace
+
+TEST(benchmark, read_and_clone_large_model) {
+    // Measures the time and the resident memory taken by a model of ~100k nodes when it is built,
+    // read from IR and cloned. Run with --gtest_filter=benchmark.read_and_clone_large_model.
+    const size_t num_blocks = 25000;
+    const auto file_prefix = CommonTestUtils::generateTestFilePrefix();
+    const auto xml_path = file_prefix + ".xml";
+    const auto bin_path = file_prefix + ".bin";
+
+    auto measure = [](const std::string& stage, const std::function<shared_ptr<Function>()>& create) {
+        const auto resident_kb = get_resident_kb();
+        const auto start = chrono::steady_clock::now();
+        auto model = create();
+        const auto elapsed = chrono::duration_cast<chrono::milliseconds>(chrono::steady_clock::now() - start);
+        OPENVINO_INFO << stage << ": " << model->get_ops().size() << " nodes, " << elapsed.count() << "ms, "
+                      << get_resident_kb() - resident_kb << "KB";
+        return model;
+    };
+
+    auto model = measure("build", [&] {
+        auto param = make_shared<op::Parameter>(element::f32, Shape{1, 8});
+        Output<Node> last = param;
+        for (size_t i = 0; i < num_blocks; ++i) {
+            auto bias = op::Constant::create(element::f32, Shape{1, 8}, {0.5f});
+            auto add = make_shared<op::v1::Add>(last, bias);
+            auto relu = make_shared<op::Relu>(add);
+            last = make_shared<op::v1::Multiply>(relu, bias);
+        }
+        return make_shared<Function>(OutputVector{last}, ParameterVector{param});
+    });
+    ov::pass::Serialize(xml_path, bin_path).run_on_model(model);
+
+    auto read = measure("read_model", [&] {
+        return ov::test::readModel(xml_path, bin_path);
+    });
+    auto cloned = measure("clone", [&] {
+        return ov::clone_model(*read);
+    });
+
+    EXPECT_EQ(model->get_ops().size(), read->get_ops().size());
+    EXPECT_EQ(model->get_ops().size(), cloned->get_ops().size());
+    std::remove(xml_path.c_str());
+    std::remove(bin_path.c_str());
+}
@@ -7,6 +7,7 @@
 #include <gtest/gtest-param-test.h>
 #include <gtest/gtest.h>
 
+#include <cmath>
 #include <cstdint>
 #include <openvino/core/shape.hpp>
 #include <openvino/core/strides.hpp>
@@ -564,3 +565,81 @@ INSTANTIATE_TEST_SUITE_P(copy_tests,
                                                               }
                                            )));
 // clang-format on
+
+TEST_F(OVTensorTest, copyRoiWithConversion) {
+    ov::Tensor src{ov::element::f32, {1, 3, 6, 5}};
+    auto src_data = src.data<float>();
+    for (size_t i = 0; i < src.get_size(); ++i)
+        src_data[i] = static_cast<float>(i);
+    ov::Tensor src_roi{src, {0, 1, 2, 1}, {1, 3, 5, 4}};
+    ov::Tensor dst{ov::element::f16, {1, 2, 3, 3}};
+
+    src_roi.copy_to(dst);
+    auto dst_data = dst.data<ov::float16>();
+    const auto& strides = src.get_strides();
+    for (auto&& c : ngraph::CoordinateTransformBasic{dst.get_shape()}) {
+        const size_t src_offset = (c[1] + 1) * strides[1] + (c[2] + 2) * strides[2] + (c[3] + 1) * strides[3];
+        const size_t dst_offset = ((c[1] * 3 + c[2]) * 3 + c[3]);
+        EXPECT_EQ(static_cast<float>(dst_data[dst_offset]), src_data[src_offset / sizeof(float)]);
+    }
+}
+
+TEST_F(OVTensorTest, copyToStridedWithConversion) {
+    ov::Tensor src{ov::element::u8, {2, 3, 4}};
+    auto src_data = src.data<uint8_t>();
+    for (size_t i = 0; i < src.get_size(); ++i)
+        src_data[i] = static_cast<uint8_t>(i);
+    std::vector<float> storage(2 * 40, -1.f);
+    ov::Tensor dst{ov::element::f32, {2, 3, 4}, storage.data(), ov::Strides{160, 48, 8}};
+
+    src.copy_to(dst);
+    for (auto&& c : ngraph::CoordinateTransformBasic{src.get_shape()}) {
+        EXPECT_EQ(storage[c[0] * 40 + c[1] * 12 + c[2] * 2],
+                  static_cast<float>(src_data[(c[0] * 3 + c[1]) * 4 + c[2]]));
+        // the gaps of the destination are not touched
+        EXPECT_EQ(storage[c[0] * 40 + c[1] * 12 + c[2] * 2 + 1], -1.f);
+    }
+}
+
+TEST_F(OVTensorTest, copyBigRoi) {
+    // several threads copy the rows of the big tensor
+    ov::Tensor src{ov::element::i32, {4, 256, 512}};
+    auto src_data = src.data<int32_t>();
+    for (size_t i = 0; i < src.get_size(); ++i)
+        src_data[i] = static_cast<int32_t>(i);
+    ov::Tensor src_roi{src, {1, 0, 1}, {4, 256, 511}};
+    ov::Tensor dst{ov::element::i32, {0}};
+
+    src_roi.copy_to(dst);
+    ASSERT_EQ(dst.get_shape(), src_roi.get_shape());
+    auto dst_data = dst.data<int32_t>();
+    for (auto&& c : ngraph::CoordinateTransformBasic{dst.get_shape()}) {
+        ASSERT_EQ(dst_data[(c[0] * 256 + c[1]) * 510 + c[2]], src_data[((c[0] + 1) * 256 + c[1]) * 512 + c[2] + 1]);
+    }
+}
+
+TEST_F(OVTensorTest, copyWithSaturatingConversion) {
+    const std::vector<float> values{-1.f, 0.4f, 0.6f, 2.5f, 254.6f, 255.f, 300.f, 1e10f, -1e10f, NAN};
+    const std::vector<uint8_t> expected{0, 0, 1, 2, 255, 255, 255, 255, 0, 0};
+    for (const auto& src_type : {ov::element::f32, ov::element::f16}) {
+        ov::Tensor f32{ov::element::f32, {values.size()}, const_cast<float*>(values.data())};
+        ov::Tensor src{src_type, {values.size()}};
+        f32.copy_to(src);
+        // dense and strided rows are converted the same way
+        ov::Tensor dense{ov::element::u8, {values.size()}};
+        std::vector<uint8_t> storage(2 * values.size(), 7);
+        ov::Tensor strided{ov::element::u8, {values.size()}, storage.data(), ov::Strides{2}};
+        src.copy_to(dense);
+        src.copy_to(strided);
+        for (size_t i = 0; i < values.size(); ++i) {
+            EXPECT_EQ(dense.data<uint8_t>()[i], expected[i]) << src_type << " " << values[i];
+            EXPECT_EQ(storage[2 * i], expected[i]) << src_type << " " << values[i];
+        }
+    }
+}
+
+TEST_F(OVTensorTest, copyWithUnsupportedConversionThrow) {
+    ov::Tensor src{ov::element::f32, {1, 2, 3}};
+    ov::Tensor dst{ov::element::i64, {1, 2, 3}};
+    ASSERT_THROW(src.copy_to(dst), ov::Exception);
+}
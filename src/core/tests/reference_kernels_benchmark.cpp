@@ -0,0 +1,262 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <chrono>
+#include <cmath>
+#include <functional>
+#include <string>
+#include <vector>
+
+#include "gtest/gtest.h"
+#include "ngraph/runtime/opt_kernel/reshape.hpp"
+#include "ngraph/runtime/reference/add.hpp"
+#include "ngraph/runtime/reference/avg_pool.hpp"
+#include "ngraph/runtime/reference/clamp.hpp"
+#include "ngraph/runtime/reference/convert.hpp"
+#include "ngraph/runtime/reference/divide.hpp"
+#include "ngraph/runtime/reference/erf.hpp"
+#include "ngraph/runtime/reference/exp.hpp"
+#include "ngraph/runtime/reference/gelu.hpp"
+#include "ngraph/runtime/reference/log.hpp"
+#include "ngraph/runtime/reference/matmul.hpp"
+#include "ngraph/runtime/reference/max_pool.hpp"
+#include "ngraph/runtime/reference/mish.hpp"
+#include "ngraph/runtime/reference/multiply.hpp"
+#include "ngraph/runtime/reference/relu.hpp"
+#include "ngraph/runtime/reference/sigmoid.hpp"
+#include "ngraph/runtime/reference/softplus.hpp"
+#include "ngraph/runtime/reference/sqrt.hpp"
+#include "ngraph/runtime/reference/subtract.hpp"
+#include "ngraph/runtime/reference/swish.hpp"
+#include "ngraph/runtime/reference/tanh.hpp"
+#include "ngraph/runtime/reference/utils/parallel.hpp"
+#include "openvino/util/log.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+// Compares the reference kernels split between threads by ParallelScope with the same kernels run by a single
+// thread, i.e. with the loops TEMPLATE ran before. The results must be bit-exact. The benchmarks are excluded from
+// the default run, use --gtest_filter=benchmark.reference_*
+
+namespace {
+template <typename F>
+double measure_ms(F&& func, size_t iterations = 5) {
+    func();  // warm up
+    const auto start = chrono::steady_clock::now();
+    for (size_t i = 0; i < iterations; ++i) {
+        func();
+    }
+    return chrono::duration<double, milli>(chrono::steady_clock::now() - start).count() / iterations;
+}
+
+template <typename T>
+void compare(const string& kernel, vector<T>& sequential, vector<T>& parallel, const function<void(T*)>& func) {
+    const auto sequential_ms = measure_ms([&] {
+        func(sequential.data());
+    });
+    double parallel_ms = 0;
+    {
+        runtime::reference::ParallelScope scope;
+        parallel_ms = measure_ms([&] {
+            func(parallel.data());
+        });
+    }
+    EXPECT_EQ(sequential, parallel) << kernel;
+    OPENVINO_INFO << kernel << ": sequential " << sequential_ms << "ms, parallel " << parallel_ms << "ms, speedup "
+                  << sequential_ms / parallel_ms << "x";
+}
+
+vector<float> make_data(size_t size) {
+    vector<float> data(size);
+    for (size_t i = 0; i < size; ++i) {
+        data[i] = static_cast<float>(i % 97) / 16.f - 3.f;
+    }
+    return data;
+}
+
+// the activations of a typical CNN
+const Shape activation_shape{32, 256, 56, 56};
+
+using unary_kernel = function<void(const float*, float*, size_t)>;
+
+// shift moves the data to the domain of the kernel
+void compare_unary(const string& kernel, const unary_kernel& func, float shift = 0.f) {
+    auto arg = make_data(shape_size(activation_shape));
+    for (auto& value : arg)
+        value += shift;
+    vector<float> sequential(arg.size()), parallel(arg.size());
+    compare<float>(kernel, sequential, parallel, [&](float* out) {
+        func(arg.data(), out, arg.size());
+    });
+}
+
+using binary_kernel = function<void(const float*, const float*, float*, const Shape&, const Shape&)>;
+
+void compare_binary(const string& kernel, const binary_kernel& func) {
+    // the second argument is broadcasted per channel, e.g. a bias or a scale
+    const Shape arg1_shape{1, activation_shape[1], 1, 1};
+    const auto arg0 = make_data(shape_size(activation_shape));
+    auto arg1 = make_data(shape_size(arg1_shape));
+    // no division by zero
+    for (auto& value : arg1)
+        value += 3.5f;
+    vector<float> sequential(arg0.size()), parallel(arg0.size());
+    compare<float>(kernel, sequential, parallel, [&](float* out) {
+        func(arg0.data(), arg1.data(), out, activation_shape, arg1_shape);
+    });
+}
+}  // namespace
+
+TEST(benchmark, reference_matmul) {
+    const Shape arg0_shape{8, 384, 256};
+    const Shape arg1_shape{8, 256, 384};
+    const Shape out_shape{8, 384, 384};
+    const auto arg0 = make_data(shape_size(arg0_shape));
+    const auto arg1 = make_data(shape_size(arg1_shape));
+    vector<float> expected(shape_size(out_shape)), sequential(shape_size(out_shape)), parallel(shape_size(out_shape));
+
+    // the loops of matmul before the rows were made contiguous for the vectorization
+    const size_t I = 384, K = 256, J = 384;
+    const auto naive_ms = measure_ms([&] {
+        fill(expected.begin(), expected.end(), 0.f);
+        for (size_t b = 0; b < 8; ++b) {
+            for (size_t i = 0; i < I; ++i) {
+                for (size_t k = 0; k < K; ++k) {
+                    for (size_t j = 0; j < J; ++j) {
+                        expected[b * I * J + i * J + j] += arg0[b * I * K + i * K + k] * arg1[b * K * J + k * J + j];
+                    }
+                }
+            }
+        }
+    });
+    OPENVINO_INFO << "matmul: naive loops " << naive_ms << "ms";
+    compare<float>("matmul", sequential, parallel, [&](float* out) {
+        runtime::reference::matmul(arg0.data(), arg1.data(), out, arg0_shape, arg1_shape, out_shape, false, false);
+    });
+    EXPECT_EQ(expected, parallel);
+}
+
+TEST(benchmark, reference_max_pool) {
+    const Shape data_shape{16, 64, 112, 112};
+    const Shape out_shape{16, 64, 56, 56};
+    const auto data = make_data(shape_size(data_shape));
+    vector<float> sequential(shape_size(out_shape)), parallel(shape_size(out_shape));
+    vector<int64_t> indices(shape_size(out_shape));
+    compare<float>("max_pool", sequential, parallel, [&](float* out) {
+        runtime::reference::max_pool(data.data(),
+                                     out,
+                                     indices.data(),
+                                     data_shape,
+                                     out_shape,
+                                     Shape{2, 2},
+                                     Strides{2, 2},
+                                     Strides{1, 1},
+                                     Shape{0, 0},
+                                     Shape{0, 0});
+    });
+}
+
+TEST(benchmark, reference_avg_pool) {
+    const Shape data_shape{16, 64, 56, 56};
+    const Shape out_shape{16, 64, 56, 56};
+    const auto data = make_data(shape_size(data_shape));
+    vector<float> sequential(shape_size(out_shape)), parallel(shape_size(out_shape));
+    compare<float>("avg_pool", sequential, parallel, [&](float* out) {
+        runtime::reference::avg_pool(data.data(),
+                                     out,
+                                     data_shape,
+                                     out_shape,
+                                     Shape{3, 3},
+                                     Strides{1, 1},
+                                     Shape{1, 1},
+                                     Shape{1, 1},
+                                     false);
+    });
+}
+
+TEST(benchmark, reference_transpose) {
+    const Shape shape{32, 128, 64, 64};
+    const AxisVector order{0, 2, 3, 1};
+    const Shape out_shape{32, 64, 64, 128};
+    const auto arg = make_data(shape_size(shape));
+    vector<float> sequential(shape_size(shape)), parallel(shape_size(shape));
+    compare<float>("transpose", sequential, parallel, [&](float* out) {
+        runtime::opt_kernel::reshape(reinterpret_cast<const char*>(arg.data()),
+                                     reinterpret_cast<char*>(out),
+                                     shape,
+                                     order,
+                                     out_shape,
+                                     sizeof(float));
+    });
+}
+
+TEST(benchmark, reference_convert) {
+    const auto arg = make_data(shape_size(activation_shape));
+    vector<float16> sequential(arg.size()), parallel(arg.size());
+    compare<float16>("convert f32 to f16", sequential, parallel, [&](float16* out) {
+        runtime::reference::convert(arg.data(), out, arg.size());
+    });
+}
+
+TEST(benchmark, reference_binary_elementwise) {
+    const op::AutoBroadcastSpec numpy(op::AutoBroadcastType::NUMPY);
+    compare_binary("add", [&](const float* arg0, const float* arg1, float* out, const Shape& s0, const Shape& s1) {
+        runtime::reference::add(arg0, arg1, out, s0, s1, numpy);
+    });
+    compare_binary("subtract", [&](const float* arg0, const float* arg1, float* out, const Shape& s0, const Shape& s1) {
+        runtime::reference::subtract(arg0, arg1, out, s0, s1, numpy);
+    });
+    compare_binary("multiply", [&](const float* arg0, const float* arg1, float* out, const Shape& s0, const Shape& s1) {
+        runtime::reference::multiply(arg0, arg1, out, s0, s1, numpy);
+    });
+    compare_binary("divide", [&](const float* arg0, const float* arg1, float* out, const Shape& s0, const Shape& s1) {
+        runtime::reference::divide(arg0, arg1, out, s0, s1, numpy, false);
+    });
+}
+
+TEST(benchmark, reference_activations) {
+    compare_unary("relu", [](const float* arg, float* out, size_t count) {
+        runtime::reference::relu(arg, out, count);
+    });
+    compare_unary("clamp", [](const float* arg, float* out, size_t count) {
+        runtime::reference::clamp(arg, out, -1.f, 1.f, count);
+    });
+    compare_unary("sigmoid", [](const float* arg, float* out, size_t count) {
+        runtime::reference::sigmoid(arg, out, count);
+    });
+    compare_unary("tanh", [](const float* arg, float* out, size_t count) {
+        runtime::reference::tanh(arg, out, count);
+    });
+    compare_unary("exp", [](const float* arg, float* out, size_t count) {
+        runtime::reference::exp(arg, out, count);
+    });
+    compare_unary(
+        "log",
+        [](const float* arg, float* out, size_t count) {
+            runtime::reference::log(arg, out, count);
+        },
+        3.5f);
+    compare_unary(
+        "sqrt",
+        [](const float* arg, float* out, size_t count) {
+            runtime::reference::sqrt(arg, out, count);
+        },
+        3.5f);
+    compare_unary("erf", [](const float* arg, float* out, size_t count) {
+        runtime::reference::erf(arg, out, count);
+    });
+    compare_unary("gelu", [](const float* arg, float* out, size_t count) {
+        runtime::reference::gelu(arg, out, op::GeluApproximationMode::ERF, count);
+    });
+    compare_unary("swish", [](const float* arg, float* out, size_t count) {
+        runtime::reference::swish<float>(arg, nullptr, out, count);
+    });
+    compare_unary("mish", [](const float* arg, float* out, size_t count) {
+        runtime::reference::mish(arg, out, count);
+    });
+    compare_unary("softplus", [](const float* arg, float* out, size_t count) {
+        runtime::reference::softplus(arg, out, count);
+    });
+}
@@ -0,0 +1,295 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <algorithm>
+#include <cmath>
+#include <mutex>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include "gtest/gtest.h"
+#include "ngraph/runtime/opt_kernel/reshape.hpp"
+#include "ngraph/runtime/reference/add.hpp"
+#include "ngraph/runtime/reference/avg_pool.hpp"
+#include "ngraph/runtime/reference/clamp.hpp"
+#include "ngraph/runtime/reference/gelu.hpp"
+#include "ngraph/runtime/reference/matmul.hpp"
+#include "ngraph/runtime/reference/max_pool.hpp"
+#include "ngraph/runtime/reference/sigmoid.hpp"
+#include "ngraph/runtime/reference/utils/parallel.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+// The kernels split the work between threads only inside ParallelScope, the results must be bit-exact
+// with the single-threaded loops.
+
+namespace {
+vector<float> make_data(size_t size) {
+    vector<float> data(size);
+    for (size_t i = 0; i < size; ++i) {
+        data[i] = static_cast<float>(i % 97) / 16.f - 3.f;
+    }
+    return data;
+}
+
+// the chunks processed by parallel_chunks and the threads processed them
+struct Chunks {
+    vector<pair<size_t, size_t>> ranges;
+    vector<thread::id> threads;
+    mutex guard;
+
+    void add(size_t start, size_t end) {
+        lock_guard<mutex> lock(guard);
+        ranges.emplace_back(start, end);
+        threads.push_back(this_thread::get_id());
+    }
+
+    bool cover(size_t work_amount) {
+        sort(ranges.begin(), ranges.end());
+        size_t next = 0;
+        for (const auto& range : ranges) {
+            if (range.first != next || range.second <= range.first)
+                return false;
+            next = range.second;
+        }
+        return next == work_amount;
+    }
+};
+}  // namespace
+
+TEST(reference_parallel, single_threaded_without_scope) {
+    const size_t work_amount = 8 * runtime::reference::parallel_min_chunk_size;
+    Chunks chunks;
+    runtime::reference::parallel_chunks(work_amount,
+                                        runtime::reference::parallel_min_chunk_size,
+                                        [&](size_t start, size_t end) {
+                                            chunks.add(start, end);
+                                        });
+    ASSERT_EQ(chunks.ranges.size(), 1u);
+    ASSERT_TRUE(chunks.cover(work_amount));
+    ASSERT_EQ(chunks.threads.front(), this_thread::get_id());
+}
+
+TEST(reference_parallel, scope_limits_threads) {
+    const size_t work_amount = 8 * runtime::reference::parallel_min_chunk_size;
+    for (const size_t max_threads : {1, 2, 0}) {
+        Chunks chunks;
+        {
+            runtime::reference::ParallelScope scope(max_threads);
+            runtime::reference::parallel_chunks(work_amount,
+                                                runtime::reference::parallel_min_chunk_size,
+                                                [&](size_t start, size_t end) {
+                                                    chunks.add(start, end);
+                                                });
+        }
+        ASSERT_TRUE(chunks.cover(work_amount)) << max_threads;
+        if (max_threads != 0)
+            ASSERT_LE(chunks.ranges.size(), max_threads);
+        ASSERT_LE(chunks.ranges.size(), 8u);
+    }
+    // the scope is restored
+    Chunks chunks;
+    runtime::reference::parallel_chunks(work_amount, 1, [&](size_t start, size_t end) {
+        chunks.add(start, end);
+    });
+    ASSERT_EQ(chunks.ranges.size(), 1u);
+}
+
+TEST(reference_parallel, nested_work_is_single_threaded) {
+    const size_t work_amount = 8 * runtime::reference::parallel_min_chunk_size;
+    runtime::reference::ParallelScope scope;
+    mutex guard;
+    vector<size_t> nested_chunks;
+    runtime::reference::parallel_chunks(work_amount, runtime::reference::parallel_min_chunk_size, [&](size_t, size_t) {
+        size_t count = 0;
+        runtime::reference::parallel_chunks(work_amount, 1, [&](size_t, size_t) {
+            ++count;
+        });
+        lock_guard<mutex> lock(guard);
+        nested_chunks.push_back(count);
+    });
+    for (const auto count : nested_chunks)
+        ASSERT_EQ(count, 1u);
+}
+
+TEST(reference_parallel, matmul) {
+    const Shape arg0_shape{4, 64, 96};
+    const Shape arg1_shape{4, 96, 80};
+    const Shape out_shape{4, 64, 80};
+    const auto arg0 = make_data(shape_size(arg0_shape));
+    const auto arg1 = make_data(shape_size(arg1_shape));
+    vector<float> expected(shape_size(out_shape), 0.f), actual(shape_size(out_shape));
+
+    const size_t I = 64, K = 96, J = 80;
+    for (size_t b = 0; b < 4; ++b) {
+        for (size_t i = 0; i < I; ++i) {
+            for (size_t k = 0; k < K; ++k) {
+                for (size_t j = 0; j < J; ++j) {
+                    expected[b * I * J + i * J + j] += arg0[b * I * K + i * K + k] * arg1[b * K * J + k * J + j];
+                }
+            }
+        }
+    }
+    runtime::reference::ParallelScope scope;
+    runtime::reference::matmul(arg0.data(),
+                               arg1.data(),
+                               actual.data(),
+                               arg0_shape,
+                               arg1_shape,
+                               out_shape,
+                               false,
+                               false);
+    EXPECT_EQ(expected, actual);
+}
+
+TEST(reference_parallel, add) {
+    const Shape shape{4, 64, 32, 32};
+    const auto arg0 = make_data(shape_size(shape));
+    const auto arg1 = make_data(shape_size(shape));
+    vector<float> expected(shape_size(shape)), actual(shape_size(shape));
+
+    for (size_t i = 0; i < expected.size(); ++i) {
+        expected[i] = arg0[i] + arg1[i];
+    }
+    runtime::reference::ParallelScope scope;
+    runtime::reference::add(arg0.data(), arg1.data(), actual.data(), shape, shape, op::AutoBroadcastType::NUMPY);
+    EXPECT_EQ(expected, actual);
+}
+
+TEST(reference_parallel, sigmoid) {
+    const size_t count = 1 << 20;
+    const auto arg = make_data(count);
+    vector<float> expected(count), actual(count);
+
+    for (size_t i = 0; i < count; ++i) {
+        expected[i] = 1 / (1 + std::exp(-arg[i]));
+    }
+    runtime::reference::ParallelScope scope;
+    runtime::reference::sigmoid(arg.data(), actual.data(), count);
+    EXPECT_EQ(expected, actual);
+}
+
+TEST(reference_parallel, gelu) {
+    const size_t count = 1 << 20;
+    const auto arg = make_data(count);
+    vector<float> expected(count), actual(count);
+
+    for (size_t i = 0; i < count; ++i) {
+        expected[i] = static_cast<float>((0.5 * arg[i] * (1 + erf(arg[i] / std::sqrt(2.0)))));
+    }
+    runtime::reference::ParallelScope scope;
+    runtime::reference::gelu(arg.data(), actual.data(), op::GeluApproximationMode::ERF, count);
+    EXPECT_EQ(expected, actual);
+}
+
+TEST(reference_parallel, transpose) {
+    const Shape shape{8, 32, 32, 32};
+    const AxisVector order{0, 2, 3, 1};
+    const Shape out_shape{8, 32, 32, 32};
+    const auto arg = make_data(shape_size(shape));
+    vector<float> expected(shape_size(shape)), actual(shape_size(shape));
+
+    size_t out_idx = 0;
+    for (size_t n = 0; n < shape[0]; ++n)
+        for (size_t h = 0; h < shape[2]; ++h)
+            for (size_t w = 0; w < shape[3]; ++w)
+                for (size_t c = 0; c < shape[1]; ++c)
+                    expected[out_idx++] = arg[((n * shape[1] + c) * shape[2] + h) * shape[3] + w];
+    runtime::reference::ParallelScope scope;
+    runtime::opt_kernel::reshape(reinterpret_cast<const char*>(arg.data()),
+                                 reinterpret_cast<char*>(actual.data()),
+                                 shape,
+                                 order,
+                                 out_shape,
+                                 sizeof(float));
+    EXPECT_EQ(expected, actual);
+}
+
+TEST(reference_parallel, max_pool) {
+    const Shape data_shape{4, 32, 64, 64};
+    const Shape out_shape{4, 32, 32, 32};
+    const auto data = make_data(shape_size(data_shape));
+    vector<float> expected(shape_size(out_shape)), actual(shape_size(out_shape));
+    vector<int64_t> indices(shape_size(out_shape));
+
+    for (size_t nc = 0; nc < 4 * 32; ++nc) {
+        const float* src = data.data() + nc * 64 * 64;
+        float* dst = expected.data() + nc * 32 * 32;
+        for (size_t oh = 0; oh < 32; ++oh) {
+            for (size_t ow = 0; ow < 32; ++ow) {
+                float max = src[oh * 2 * 64 + ow * 2];
+                for (size_t kh = 0; kh < 2; ++kh)
+                    for (size_t kw = 0; kw < 2; ++kw)
+                        max = std::max(max, src[(oh * 2 + kh) * 64 + ow * 2 + kw]);
+                dst[oh * 32 + ow] = max;
+            }
+        }
+    }
+    runtime::reference::ParallelScope scope;
+    runtime::reference::max_pool(data.data(),
+                                 actual.data(),
+                                 indices.data(),
+                                 data_shape,
+                                 out_shape,
+                                 Shape{2, 2},
+                                 Strides{2, 2},
+                                 Strides{1, 1},
+                                 Shape{0, 0},
+                                 Shape{0, 0});
+    EXPECT_EQ(expected, actual);
+}
+
+TEST(reference_parallel, avg_pool) {
+    const Shape data_shape{4, 32, 32, 32};
+    const Shape out_shape{4, 32, 32, 32};
+    const auto data = make_data(shape_size(data_shape));
+    vector<float> expected(shape_size(out_shape)), actual(shape_size(out_shape));
+
+    // 3x3 window, the padding is excluded from the average
+    for (size_t nc = 0; nc < 4 * 32; ++nc) {
+        const float* src = data.data() + nc * 32 * 32;
+        float* dst = expected.data() + nc * 32 * 32;
+        for (int64_t oh = 0; oh < 32; ++oh) {
+            for (int64_t ow = 0; ow < 32; ++ow) {
+                float sum = 0;
+                size_t count = 0;
+                for (int64_t ih = oh - 1; ih <= oh + 1; ++ih) {
+                    for (int64_t iw = ow - 1; iw <= ow + 1; ++iw) {
+                        if (ih >= 0 && ih < 32 && iw >= 0 && iw < 32) {
+                            sum += src[ih * 32 + iw];
+                            count++;
+                        }
+                    }
+                }
+                dst[oh * 32 + ow] = sum / static_cast<float>(count);
+            }
+        }
+    }
+    runtime::reference::ParallelScope scope;
+    runtime::reference::avg_pool(data.data(),
+                                 actual.data(),
+                                 data_shape,
+                                 out_shape,
+                                 Shape{3, 3},
+                                 Strides{1, 1},
+                                 Shape{1, 1},
+                                 Shape{1, 1},
+                                 false);
+    EXPECT_EQ(expected, actual);
+}
+
+TEST(reference_parallel, clamp) {
+    const size_t count = 1 << 20;
+    const auto arg = make_data(count);
+    vector<float> expected(count), actual(count);
+
+    for (size_t i = 0; i < count; ++i) {
+        expected[i] = std::min(std::max(arg[i], -1.f), 1.f);
+    }
+    runtime::reference::ParallelScope scope;
+    runtime::reference::clamp(arg.data(), actual.data(), -1.f, 1.f, count);
+    EXPECT_EQ(expected, actual);
+}
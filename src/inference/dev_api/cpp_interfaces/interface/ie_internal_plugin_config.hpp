@@ -110,6 +110,20 @@ INFERENCE_ENGINE_1_0_DEPRECATED DECLARE_CONFIG_VALUE(ENABLE);
 INFERENCE_ENGINE_1_0_DEPRECATED DECLARE_CONFIG_VALUE(IGNORE_CALLBACK);
 INFERENCE_ENGINE_1_0_DEPRECATED DECLARE_CONFIG_VALUE(DISABLE);
 
+/**
+ * @brief Enables depth-first tiled execution of convolution chains in CPU plugin: chains of spatial operations are
+ * computed by horizontal stripes which intermediate tensors fit the cache
+ * @ingroup ie_dev_api_plugin_api
+ */
+INFERENCE_ENGINE_1_0_DEPRECATED DECLARE_CONFIG_KEY(CPU_DEPTH_FIRST_TILING);
+
+/**
+ * @brief Overrides the cache budget in bytes used to select the stripe height of the depth-first tiling in CPU plugin,
+ * zero (default) means the budget derived from the L2 cache size
+ * @ingroup ie_dev_api_plugin_api
+ */
+INFERENCE_ENGINE_1_0_DEPRECATED DECLARE_CONFIG_KEY(CPU_DEPTH_FIRST_TILING_CACHE_BUDGET);
+
 }  // namespace PluginConfigInternalParams
 
 }  // namespace InferenceEngine
@@ -28,5 +28,28 @@ static constexpr Property<bool> enable_startup_fallback{"ENABLE_STARTUP_FALLBACK
  * selected device
  */
 static constexpr Property<bool> enable_runtime_fallback{"ENABLE_RUNTIME_FALLBACK"};
+
+/**
+ * @brief auto/multi device setting that enables/disables the latency aware routing of the infer requests in the
+ * cumulative throughput mode. Each request is sent to the device with the earliest expected completion, estimated from
+ * the moving average of the device latency and the number of the requests in flight, instead of the first device with
+ * an idle infer request in the priority order
+ */
+static constexpr Property<bool> enable_latency_aware_routing{"ENABLE_LATENCY_AWARE_ROUTING"};
+
+/**
+ * @brief auto/multi device setting that sets the latency budget of an infer request in milliseconds for the latency
+ * aware routing. The first device in the priority order, which is expected to complete the request within the budget,
+ * is selected. If there is no such device, the request is sent to the one with the earliest expected completion.
+ * 0 (default) means there is no budget
+ */
+static constexpr Property<uint32_t> request_deadline{"REQUEST_DEADLINE"};
+
+/**
+ * @brief Read-only property to get the statistics of the latency aware routing of a compiled model in JSON format:
+ * the moving average latency in milliseconds, the requests in flight, the dispatched requests and the requests, which
+ * exceeded the deadline, per device
+ */
+static constexpr Property<std::string, PropertyMutability::RO> routing_stats{"ROUTING_STATS"};
 }  // namespace intel_auto
 }  // namespace ov
\ No newline at end of file
@@ -63,5 +63,248 @@ static constexpr Property<bool> denormals_optimization{"CPU_DENORMALS_OPTIMIZATI
  */
 static constexpr Property<float> sparse_weights_decompression_rate{"CPU_SPARSE_WEIGHTS_DECOMPRESSION_RATE"};
 
+/**
+ * @brief This property defines how often the inferences are profiled when ov::enable_profiling is set
+ * @ingroup ov_runtime_cpu_prop_cpp_api
+ *
+ * With the value N only each N-th inference of a stream collects the performance counters, so the profiling
+ * can be kept enabled on production traffic. The default value 1 profiles every inference.
+ *
+ * @code
+ * core.set_property(ov::enable_profiling(true), ov::intel_cpu::profiling_sampling_rate(100));
+ * @endcode
+ */
+static constexpr Property<uint32_t> profiling_sampling_rate{"CPU_PROFILING_SAMPLING_RATE"};
+
+/**
+ * @brief Read-only property of a compiled model to get the per-node latency statistics as JSON
+ * @ingroup ov_runtime_cpu_prop_cpp_api
+ *
+ * The statistics are accumulated over all the profiled inferences of all the streams and contain the number of
+ * measurements, p50 and p99 latencies in microseconds for each executed node. Requires ov::enable_profiling.
+ *
+ * @code
+ * auto report = compiled_model.get_property(ov::intel_cpu::profiling_report);
+ * @endcode
+ */
+static constexpr Property<std::string, PropertyMutability::RO> profiling_report{"CPU_PROFILING_REPORT"};
+
+/**
+ * @brief Read-only property of a compiled model to get the latest node executions as Chrome trace JSON
+ * @ingroup ov_runtime_cpu_prop_cpp_api
+ *
+ * The trace can be opened in chrome://tracing or Perfetto UI, each stream is shown as a separate thread.
+ * Only the latest node executions are kept for each stream. Requires ov::enable_profiling.
+ *
+ * @code
+ * std::ofstream("trace.json") << compiled_model.get_property(ov::intel_cpu::profiling_trace);
+ * @endcode
+ */
+static constexpr Property<std::string, PropertyMutability::RO> profiling_trace{"CPU_PROFILING_TRACE"};
+
+/**
+ * @brief This property defines the input shapes, for which a dynamic model is prepared at compile time
+ * @ingroup ov_runtime_cpu_prop_cpp_api
+ *
+ * The value is a list of the shape sets separated by ';', each set lists the inputs as name[dims] separated by ','.
+ * The input name can be omitted for a model with a single input. A dimension can be set as a range min..max,
+ * then the set is prepared for both bounds. The compiled model runs each set once on every stream, so the first
+ * inferences with these shapes don't pay for the shape inference and the creation of the kernels.
+ * The value is stored in the exported model, so a model imported from the cache is prepared for the same shapes.
+ *
+ * @code
+ * core.compile_model(model, "CPU", ov::intel_cpu::warmup_shapes("data[1,3,224,224],mask[1,224];data[1..8,3,320,320],mask[1..8,320]"));
+ * @endcode
+ */
+static constexpr Property<std::string> warmup_shapes{"CPU_WARMUP_SHAPES"};
+
+/**
+ * @brief Read-only property of a compiled model to get the usage of the CPU cores by the model as JSON
+ * @ingroup ov_runtime_cpu_prop_cpp_api
+ *
+ * The compiled models, which set ov::hint::model_priority, share the CPU cores: an inference starts when the cores of
+ * its stream are not busy with the inferences of the other such models, and the models with the higher priority get
+ * the busy cores first. The inferences of the models without the priority are not arbitrated.
+ * The statistics contain the priority of the model, the number of the inferences and of the ones waited for the
+ * cores, the total and maximal waiting times in milliseconds, the time the cores were busy with the inferences and
+ * the share of the CPU used by the model since the compilation.
+ *
+ * @code
+ * auto usage = compiled_model.get_property(ov::intel_cpu::resource_usage);
+ * @endcode
+ */
+static constexpr Property<std::string, PropertyMutability::RO> resource_usage{"CPU_RESOURCE_USAGE"};
+
+/**
+ * @brief Enum to define the page size of the big memory buffers of a compiled model
+ * @ingroup ov_runtime_cpu_prop_cpp_api
+ */
+enum class HugePages {
+    DISABLED = 0,                //!< The default 4KB pages
+    TRANSPARENT_HUGE_PAGES = 1,  //!< The buffers are aligned to 2MB and advised for the transparent huge pages
+                                 //!< (Linux only)
+    EXPLICIT_HUGE_PAGES = 2,     //!< The buffers are mapped from the reserved 1GB or 2MB huge pages (Linux
+                                 //!< hugetlbfs), the transparent huge pages are used if no pages are reserved
+};
+
+/** @cond INTERNAL */
+inline std::ostream& operator<<(std::ostream& os, const HugePages& huge_pages) {
+    switch (huge_pages) {
+    case HugePages::DISABLED:
+        return os << "DISABLED";
+    case HugePages::TRANSPARENT_HUGE_PAGES:
+        return os << "TRANSPARENT_HUGE_PAGES";
+    case HugePages::EXPLICIT_HUGE_PAGES:
+        return os << "EXPLICIT_HUGE_PAGES";
+    default:
+        OPENVINO_THROW("Unsupported huge pages mode");
+    }
+}
+
+inline std::istream& operator>>(std::istream& is, HugePages& huge_pages) {
+    std::string str;
+    is >> str;
+    if (str == "DISABLED") {
+        huge_pages = HugePages::DISABLED;
+    } else if (str == "TRANSPARENT_HUGE_PAGES") {
+        huge_pages = HugePages::TRANSPARENT_HUGE_PAGES;
+    } else if (str == "EXPLICIT_HUGE_PAGES") {
+        huge_pages = HugePages::EXPLICIT_HUGE_PAGES;
+    } else {
+        OPENVINO_THROW("Unsupported huge pages mode: ", str);
+    }
+    return is;
+}
+/** @endcond */
+
+/**
+ * @brief This property defines the page size of the weights, the activations workspace and the I/O tensors
+ * @ingroup ov_runtime_cpu_prop_cpp_api
+ *
+ * The huge pages reduce the TLB misses on the models with big weights or activations. Only the buffers
+ * of 2MB and bigger are affected.
+ *
+ * @code
+ * core.compile_model(model, "CPU", ov::intel_cpu::huge_pages(ov::intel_cpu::HugePages::TRANSPARENT_HUGE_PAGES));
+ * @endcode
+ */
+static constexpr Property<HugePages> huge_pages{"CPU_HUGE_PAGES"};
+
+/**
+ * @brief This property enables the binding of the big memory buffers to the NUMA node of the stream using them
+ * @ingroup ov_runtime_cpu_prop_cpp_api
+ *
+ * Without the binding the pages are placed on the NUMA node of the thread which touches them first.
+ * The binding is applied if the streams are distributed over several NUMA nodes (Linux only).
+ *
+ * @code
+ * core.compile_model(model, "CPU", ov::intel_cpu::numa_aware_allocation(true));
+ * @endcode
+ */
+static constexpr Property<bool> numa_aware_allocation{"CPU_NUMA_AWARE_ALLOCATION"};
+
+/**
+ * @brief This property enables the commit of the pages of the big memory buffers at the allocation
+ * @ingroup ov_runtime_cpu_prop_cpp_api
+ *
+ * The weights and the activations workspace are allocated at compile time, so the first inference
+ * doesn't pay for the page faults. The buffers reallocated by the inference of the dynamic shapes
+ * are not prefaulted.
+ *
+ * @code
+ * core.compile_model(model, "CPU", ov::intel_cpu::prefault_memory(true));
+ * @endcode
+ */
+static constexpr Property<bool> prefault_memory{"CPU_PREFAULT_MEMORY"};
+
+/**
+ * @brief Read-only property of a compiled model to get the statistics of the memory allocations as JSON
+ * @ingroup ov_runtime_cpu_prop_cpp_api
+ *
+ * The statistics contain the number and the total size of the allocations done by the model, the sizes
+ * of the buffers backed by the huge pages, bound to the NUMA nodes and prefaulted, and the number of the
+ * allocations which fell back from the reserved huge pages to the transparent ones.
+ *
+ * @code
+ * auto stats = compiled_model.get_property(ov::intel_cpu::allocation_stats);
+ * @endcode
+ */
+static constexpr Property<std::string, PropertyMutability::RO> allocation_stats{"CPU_ALLOCATION_STATS"};
+
+/**
+ * @brief This property enables the lazy compilation of the model
+ * @ingroup ov_runtime_cpu_prop_cpp_api
+ *
+ * The compilation returns as soon as the topology of the graph is ready, the primitives and the JIT kernels of
+ * the nodes are created in the background by several threads. An inference, which starts before the background
+ * creation is finished, creates the remaining primitives itself with the threads of its stream.
+ *
+ * @code
+ * core.compile_model(model, "CPU", ov::intel_cpu::lazy_compilation(true));
+ * @endcode
+ */
+static constexpr Property<bool> lazy_compilation{"CPU_LAZY_COMPILATION"};
+
+/**
+ * @brief This property enables the parallel creation of the primitives of the nodes during the compilation
+ * @ingroup ov_runtime_cpu_prop_cpp_api
+ *
+ * The primitives and the JIT kernels of the nodes are created by all the threads of the stream after the layouts
+ * are selected. The property is disabled by default, the primitives are created node by node.
+ *
+ * @code
+ * core.compile_model(model, "CPU", ov::intel_cpu::parallel_compilation(true));
+ * @endcode
+ */
+static constexpr Property<bool> parallel_compilation{"CPU_PARALLEL_COMPILATION"};
+
+/**
+ * @brief Read-only property to get the statistics of the JIT kernel cache of the process as JSON
+ * @ingroup ov_runtime_cpu_prop_cpp_api
+ *
+ * The JIT kernels with the equal configurations are generated once and shared by the nodes of all the compiled
+ * models and their streams. The statistics contain the number of the kernels found in the cache and generated,
+ * the number and the code size of the kernels alive, and the code size the cache hits didn't generate.
+ *
+ * @code
+ * auto stats = core.get_property("CPU", ov::intel_cpu::jit_kernel_cache_stats);
+ * @endcode
+ */
+static constexpr Property<std::string, PropertyMutability::RO> jit_kernel_cache_stats{"CPU_JIT_KERNEL_CACHE_STATS"};
+
+/**
+ * @brief This property enables the continuous batching of the stateful models and sets the maximum number of the
+ * sequences executed by one inference
+ * @ingroup ov_runtime_cpu_prop_cpp_api
+ *
+ * Each infer request of a stateful model, e.g. a decoder made stateful by ov::pass::MakeStateful or
+ * ov::pass::LowLatency2, runs its own sequence. In this mode the concurrent inferences of the requests are gathered
+ * into one inference of the model reshaped to the batch of the sequences: each sequence occupies its own row of the
+ * inputs, the outputs and the states, so the sequences of different lengths are batched without padding.
+ * An inference starts as soon as a stream is free, the requests started while all the streams are busy are batched
+ * into the next one. The model must have static shapes and the batch 1 in the first dimension of all the inputs,
+ * the outputs and the states, otherwise the mode is not applied and the compiled model reports 0.
+ * The default value 0 disables the mode.
+ *
+ * @code
+ * core.compile_model(model, "CPU", ov::intel_cpu::continuous_batching(8));
+ * @endcode
+ */
+static constexpr Property<uint32_t> continuous_batching{"CPU_CONTINUOUS_BATCHING"};
+
+/**
+ * @brief Read-only property of a compiled model to get the statistics of the continuous batching as JSON
+ * @ingroup ov_runtime_cpu_prop_cpp_api
+ *
+ * The statistics contain the number of the executed inferences, the sequences they executed, the inferences of
+ * more than one sequence and the maximum number of the sequences of an inference.
+ *
+ * @code
+ * auto stats = compiled_model.get_property(ov::intel_cpu::continuous_batching_stats);
+ * @endcode
+ */
+static constexpr Property<std::string, PropertyMutability::RO> continuous_batching_stats{
+    "CPU_CONTINUOUS_BATCHING_STATS"};
+
 }  // namespace intel_cpu
 }  // namespace ov
@@ -611,6 +611,20 @@ static constexpr Property<Level> level{"LOG_LEVEL"};
  */
 static constexpr Property<std::string> cache_dir{"CACHE_DIR"};
 
+/**
+ * @brief This property defines the maximum total size of the compiled blobs in the cache directory, in bytes.
+ * @ingroup ov_runtime_cpp_prop_api
+ *
+ * When a new blob is stored and the limit is exceeded, the least recently used blobs are removed from the directory.
+ * The usage order is kept in the file system, so it is shared by all the processes using the same cache directory.
+ * The value 0 means no limit and is used by default.
+ *
+ * @code
+ * ie.set_property(ov::cache_dir("cache/"), ov::cache_size_limit(1024 * 1024 * 1024)); // keeps at most 1 GiB of blobs
+ * @endcode
+ */
+static constexpr Property<uint64_t> cache_size_limit{"CACHE_SIZE_LIMIT"};
+
 /**
  * @brief Read-only property to notify user that compiled model was loaded from the cache
  * @ingroup ov_runtime_cpp_prop_api
@@ -766,6 +766,7 @@ ov::AnyMap ov::CoreImpl::get_supported_property(const std::string& full_device_n
 
     static const std::vector<std::string> core_level_properties = {
         ov::cache_dir.name(),
+        ov::cache_size_limit.name(),
         ov::force_tbb_terminate.name(),
         // auto-batch properties are also treated as core-level
         ov::auto_batch_timeout.name(),
@@ -927,6 +928,8 @@ ov::Any ov::CoreImpl::get_property_for_core(const std::string& name) const {
     } else if (name == ov::enable_mmap.name()) {
         const auto flag = coreConfig.get_enable_mmap();
         return decltype(ov::enable_mmap)::value_type(flag);
+    } else if (name == ov::cache_size_limit.name()) {
+        return decltype(ov::cache_size_limit)::value_type(coreConfig.get_cache_size_limit());
     }
 
     OPENVINO_THROW("Exception is thrown while trying to call get_property with unsupported property: '", name, "'");
@@ -1288,14 +1291,26 @@ void ov::CoreImpl::AddExtensionUnsafe(const InferenceEngine::IExtensionPtr& exte
 }
 
 void ov::CoreImpl::CoreConfig::set_and_update(ov::AnyMap& config) {
-    auto it = config.find(CONFIG_KEY(CACHE_DIR));
+    auto it = config.find(ov::cache_size_limit.name());
+    if (it != config.end()) {
+        std::lock_guard<std::mutex> lock(_cacheConfigMutex);
+        _cacheSizeLimit = it->second.as<uint64_t>();
+        // the existing cache managers are recreated with the new limit
+        _cacheConfig = CoreConfig::CacheConfig::create(_cacheConfig._cacheDir, _cacheSizeLimit);
+        for (auto& deviceCfg : _cacheConfigPerDevice) {
+            deviceCfg.second = CoreConfig::CacheConfig::create(deviceCfg.second._cacheDir, _cacheSizeLimit);
+        }
+        config.erase(it);
+    }
+
+    it = config.find(CONFIG_KEY(CACHE_DIR));
     if (it != config.end()) {
         std::lock_guard<std::mutex> lock(_cacheConfigMutex);
         // fill global cache config
-        _cacheConfig = CoreConfig::CacheConfig::create(it->second.as<std::string>());
+        _cacheConfig = CoreConfig::CacheConfig::create(it->second.as<std::string>(), _cacheSizeLimit);
         // sets cache config per-device if it's not set explicitly before
         for (auto& deviceCfg : _cacheConfigPerDevice) {
-            deviceCfg.second = CoreConfig::CacheConfig::create(it->second.as<std::string>());
+            deviceCfg.second = CoreConfig::CacheConfig::create(it->second.as<std::string>(), _cacheSizeLimit);
         }
         config.erase(it);
     }
@@ -1317,7 +1332,7 @@ void ov::CoreImpl::CoreConfig::set_and_update(ov::AnyMap& config) {
 
 void ov::CoreImpl::CoreConfig::set_cache_dir_for_device(const std::string& dir, const std::string& name) {
     std::lock_guard<std::mutex> lock(_cacheConfigMutex);
-    _cacheConfigPerDevice[name] = CoreConfig::CacheConfig::create(dir);
+    _cacheConfigPerDevice[name] = CoreConfig::CacheConfig::create(dir, _cacheSizeLimit);
 }
 
 std::string ov::CoreImpl::CoreConfig::get_cache_dir() const {
@@ -1329,6 +1344,11 @@ bool ov::CoreImpl::CoreConfig::get_enable_mmap() const {
     return _flag_enable_mmap;
 }
 
+uint64_t ov::CoreImpl::CoreConfig::get_cache_size_limit() const {
+    std::lock_guard<std::mutex> lock(_cacheConfigMutex);
+    return _cacheSizeLimit;
+}
+
 // Creating thread-safe copy of config including shared_ptr to ICacheManager
 // Passing empty or not-existing name will return global cache config
 ov::CoreImpl::CoreConfig::CacheConfig ov::CoreImpl::CoreConfig::get_cache_config_for_device(
@@ -1337,7 +1357,7 @@ ov::CoreImpl::CoreConfig::CacheConfig ov::CoreImpl::CoreConfig::get_cache_config
     // cache_dir is enabled locally in compile_model only
     if (parsedConfig.count(ov::cache_dir.name())) {
         auto cache_dir_val = parsedConfig.at(ov::cache_dir.name()).as<std::string>();
-        auto tempConfig = CoreConfig::CacheConfig::create(cache_dir_val);
+        auto tempConfig = CoreConfig::CacheConfig::create(cache_dir_val, get_cache_size_limit());
         // if plugin does not explicitly support cache_dir, and if plugin is not virtual, we need to remove
         // it from config
         if (!util::contains(plugin.get_property(ov::supported_properties), ov::cache_dir) &&
@@ -1355,12 +1375,13 @@ ov::CoreImpl::CoreConfig::CacheConfig ov::CoreImpl::CoreConfig::get_cache_config
     }
 }
 
-ov::CoreImpl::CoreConfig::CacheConfig ov::CoreImpl::CoreConfig::CacheConfig::create(const std::string& dir) {
+ov::CoreImpl::CoreConfig::CacheConfig ov::CoreImpl::CoreConfig::CacheConfig::create(const std::string& dir,
+                                                                                     uint64_t sizeLimit) {
     std::shared_ptr<ov::ICacheManager> cache_manager = nullptr;
 
     if (!dir.empty()) {
         FileUtils::createDirectoryRecursive(dir);
-        cache_manager = std::make_shared<ov::FileStorageCacheManager>(dir);
+        cache_manager = std::make_shared<ov::FileStorageCacheManager>(dir, sizeLimit);
     }
 
     return {dir, cache_manager};
@@ -70,7 +70,7 @@ private:
             std::string _cacheDir;
             std::shared_ptr<ov::ICacheManager> _cacheManager;
 
-            static CacheConfig create(const std::string& dir);
+            static CacheConfig create(const std::string& dir, uint64_t sizeLimit);
         };
 
         /**
@@ -86,6 +86,8 @@ private:
 
         bool get_enable_mmap() const;
 
+        uint64_t get_cache_size_limit() const;
+
         // Creating thread-safe copy of config including shared_ptr to ICacheManager
         // Passing empty or not-existing name will return global cache config
         CacheConfig get_cache_config_for_device(const ov::Plugin& plugin, ov::AnyMap& parsedConfig) const;
@@ -95,6 +97,7 @@ private:
         CacheConfig _cacheConfig;
         std::map<std::string, CacheConfig> _cacheConfigPerDevice;
         bool _flag_enable_mmap = true;
+        uint64_t _cacheSizeLimit = 0;
     };
 
     struct CacheContent {
@@ -0,0 +1,267 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "ie_cache_manager.hpp"
+
+#include <sys/stat.h>
+
+#include <algorithm>
+#include <atomic>
+#include <ctime>
+#include <streambuf>
+#include <thread>
+#include <vector>
+
+#include "ie_itt.hpp"
+#include "openvino/util/common_util.hpp"
+#include "openvino/util/file_util.hpp"
+
+#ifndef _WIN32
+#    include <fcntl.h>
+#    include <sys/mman.h>
+#    include <unistd.h>
+#    include <utime.h>
+#else
+#    ifndef NOMINMAX
+#        define NOMINMAX
+#    endif
+#    include <process.h>
+#    include <sys/utime.h>
+#    include <windows.h>
+#endif
+
+namespace ov {
+namespace {
+
+constexpr const char* blobExtension = ".blob";
+constexpr const char* tempExtension = ".tmp";
+// temporary files of the writers, which have been terminated before the publication, are removed after this time
+constexpr std::time_t staleTempFileAge = 60 * 60;
+
+/**
+ * @brief Read-only memory mapping of the whole file, the mapping is empty if the file can not be mapped
+ */
+class MappedFile {
+    char* m_data = nullptr;
+    size_t m_size = 0;
+
+public:
+    explicit MappedFile(const std::string& path) {
+#ifndef _WIN32
+        const int fd = open(path.c_str(), O_RDONLY);
+        if (fd == -1)
+            return;
+        struct stat sb = {};
+        if (fstat(fd, &sb) != -1 && sb.st_size > 0) {
+            void* data = mmap(nullptr, sb.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+            if (data != MAP_FAILED) {
+                m_data = static_cast<char*>(data);
+                m_size = static_cast<size_t>(sb.st_size);
+                // the plugins parse the blob from the beginning to the end
+                madvise(data, m_size, MADV_SEQUENTIAL);
+            }
+        }
+        // the mapping stays valid after the descriptor is closed
+        close(fd);
+#else
+        // FILE_SHARE_DELETE allows other processes to evict the entry while it is being read
+        HANDLE file = CreateFileA(path.c_str(),
+                                  GENERIC_READ,
+                                  FILE_SHARE_READ | FILE_SHARE_DELETE,
+                                  nullptr,
+                                  OPEN_EXISTING,
+                                  FILE_ATTRIBUTE_NORMAL,
+                                  nullptr);
+        if (file == INVALID_HANDLE_VALUE)
+            return;
+        LARGE_INTEGER size;
+        if (GetFileSizeEx(file, &size) && size.QuadPart > 0) {
+            HANDLE mapping = CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+            if (mapping != nullptr) {
+                void* data = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+                if (data != nullptr) {
+                    m_data = static_cast<char*>(data);
+                    m_size = static_cast<size_t>(size.QuadPart);
+                }
+                // the view keeps the mapping alive
+                CloseHandle(mapping);
+            }
+        }
+        CloseHandle(file);
+#endif
+    }
+
+    MappedFile(const MappedFile&) = delete;
+    MappedFile& operator=(const MappedFile&) = delete;
+
+    ~MappedFile() {
+        if (m_data == nullptr)
+            return;
+#ifndef _WIN32
+        munmap(m_data, m_size);
+#else
+        UnmapViewOfFile(m_data);
+#endif
+    }
+
+    char* data() const noexcept {
+        return m_data;
+    }
+
+    size_t size() const noexcept {
+        return m_size;
+    }
+};
+
+/**
+ * @brief Seekable read-only stream buffer over the memory, the reads are served directly from the mapped pages
+ */
+class MemoryStreamBuffer : public std::streambuf {
+public:
+    MemoryStreamBuffer(char* data, size_t size) {
+        setg(data, data, data + size);
+    }
+
+protected:
+    pos_type seekoff(off_type off, std::ios_base::seekdir dir, std::ios_base::openmode which) override {
+        if (!(which & std::ios_base::in))
+            return pos_type(off_type(-1));
+        char* base = dir == std::ios_base::beg ? eback() : dir == std::ios_base::cur ? gptr() : egptr();
+        const off_type position = (base - eback()) + off;
+        if (position < 0 || position > egptr() - eback())
+            return pos_type(off_type(-1));
+        setg(eback(), eback() + position, egptr());
+        return pos_type(position);
+    }
+
+    pos_type seekpos(pos_type pos, std::ios_base::openmode which) override {
+        return seekoff(off_type(pos), std::ios_base::beg, which);
+    }
+
+    std::streamsize showmanyc() override {
+        return egptr() - gptr();
+    }
+};
+
+std::string get_unique_suffix() {
+    static std::atomic<uint64_t> counter{0};
+#ifndef _WIN32
+    const auto pid = getpid();
+#else
+    const auto pid = _getpid();
+#endif
+    return "." + std::to_string(pid) + "_" + std::to_string(std::hash<std::thread::id>()(std::this_thread::get_id())) +
+           "_" + std::to_string(counter++);
+}
+
+// marks the entry as the most recently used one for all the processes sharing the cache directory
+void touch_file(const std::string& path) {
+#ifndef _WIN32
+    utime(path.c_str(), nullptr);
+#else
+    _utime(path.c_str(), nullptr);
+#endif
+}
+
+}  // namespace
+
+void FileStorageCacheManager::write_cache_entry(const std::string& id, StreamWriter writer) {
+    OV_ITT_SCOPED_TASK(ov::itt::domains::IE, "FileStorageCacheManager::write_cache_entry");
+    const auto blobFileName = getBlobFile(id);
+    const auto tempFileName = blobFileName + get_unique_suffix() + tempExtension;
+    bool isWritten = false;
+    {
+        std::ofstream stream(tempFileName, std::ios_base::binary | std::ofstream::out);
+        try {
+            writer(stream);
+        } catch (...) {
+            stream.close();
+            std::remove(tempFileName.c_str());
+            throw;
+        }
+        stream.close();
+        isWritten = !stream.fail();
+    }
+    if (!isWritten) {
+        std::remove(tempFileName.c_str());
+        return;
+    }
+    // rename is atomic, so the readers see either no entry or the complete one.
+    // It fails on Windows if the entry exists, which means it is already published by another writer
+    if (std::rename(tempFileName.c_str(), blobFileName.c_str()) != 0) {
+        std::remove(tempFileName.c_str());
+    }
+
+    if (m_sizeLimit != 0)
+        evict_cache_entries(blobFileName);
+}
+
+void FileStorageCacheManager::read_cache_entry(const std::string& id, StreamReader reader) {
+    OV_ITT_SCOPED_TASK(ov::itt::domains::IE, "FileStorageCacheManager::read_cache_entry");
+    auto blobFileName = getBlobFile(id);
+    if (!FileUtils::fileExist(blobFileName))
+        return;
+
+    touch_file(blobFileName);
+    MappedFile mappedBlob(blobFileName);
+    if (mappedBlob.data() != nullptr) {
+        MemoryStreamBuffer buffer(mappedBlob.data(), mappedBlob.size());
+        std::istream stream(&buffer);
+        reader(stream);
+    } else {
+        std::ifstream stream(blobFileName, std::ios_base::binary);
+        reader(stream);
+    }
+}
+
+void FileStorageCacheManager::evict_cache_entries(const std::string& keptFile) const {
+    struct Entry {
+        std::string path;
+        std::time_t accessTime;
+        uint64_t size;
+    };
+    std::vector<Entry> entries;
+    uint64_t totalSize = 0;
+    const auto keptFileName = ov::util::get_file_name(keptFile);
+    const auto now = std::time(nullptr);
+
+    try {
+        ov::util::iterate_files(m_cachePath, [&](const std::string& file, bool is_dir) {
+            struct stat sb = {};
+            if (is_dir || stat(file.c_str(), &sb) != 0)
+                return;
+            if (ov::util::ends_with(file, tempExtension)) {
+                if (now - sb.st_mtime > staleTempFileAge)
+                    std::remove(file.c_str());
+                return;
+            }
+            if (!ov::util::ends_with(file, blobExtension) || ov::util::get_file_name(file) == keptFileName)
+                return;
+            entries.push_back({file, sb.st_mtime, static_cast<uint64_t>(sb.st_size)});
+            totalSize += static_cast<uint64_t>(sb.st_size);
+        });
+    } catch (const std::exception&) {
+        // the directory can not be listed, the limit is not applied
+        return;
+    }
+
+    struct stat sb = {};
+    if (stat(keptFile.c_str(), &sb) == 0)
+        totalSize += static_cast<uint64_t>(sb.st_size);
+    if (totalSize <= m_sizeLimit)
+        return;
+
+    std::sort(entries.begin(), entries.end(), [](const Entry& lhs, const Entry& rhs) {
+        return lhs.accessTime < rhs.accessTime;
+    });
+    for (const auto& entry : entries) {
+        if (totalSize <= m_sizeLimit)
+            break;
+        // the entry may be already removed by another process, the mapped entries stay readable on Linux
+        if (std::remove(entry.path.c_str()) == 0)
+            totalSize -= entry.size;
+    }
+}
+
+}  // namespace ov
@@ -9,6 +9,7 @@
  */
 #pragma once
 
+#include <cstdint>
 #include <fstream>
 #include <functional>
 #include <memory>
@@ -76,21 +77,38 @@ public:
  * @brief File storage-based Implementation of ICacheManager
  *
  * Uses simple file for read/write cached models.
+ * The entries are published atomically: the blob is written to a temporary file, which is renamed
+ * to the final name afterwards, so the concurrent readers from other processes never see partially written files.
+ * The entries are read through the memory mapping, so the blob is not copied through the stream buffers.
+ * The last modification time of the file is used as the last access time, which allows to share
+ * the LRU order of the entries between the processes using the same cache directory.
  *
  */
 class FileStorageCacheManager final : public ICacheManager {
     std::string m_cachePath;
+    uint64_t m_sizeLimit;
 
     std::string getBlobFile(const std::string& blobHash) const {
         return FileUtils::makePath(m_cachePath, blobHash + ".blob");
     }
 
+    /**
+     * @brief Removes the least recently used entries until the total size of the blobs fits the size limit
+     *
+     * @param keptFile The file which is never removed, i.e. the entry which has been just written
+     */
+    void evict_cache_entries(const std::string& keptFile) const;
+
 public:
     /**
      * @brief Constructor
      *
+     * @param cachePath Path to the cache directory
+     * @param sizeLimit Maximum total size of the cached blobs in bytes, 0 means no limit
      */
-    FileStorageCacheManager(std::string cachePath) : m_cachePath(std::move(cachePath)) {}
+    FileStorageCacheManager(std::string cachePath, uint64_t sizeLimit = 0)
+        : m_cachePath(std::move(cachePath)),
+          m_sizeLimit(sizeLimit) {}
 
     /**
      * @brief Destructor
@@ -99,18 +117,9 @@ public:
     ~FileStorageCacheManager() override = default;
 
 private:
-    void write_cache_entry(const std::string& id, StreamWriter writer) override {
-        std::ofstream stream(getBlobFile(id), std::ios_base::binary | std::ofstream::out);
-        writer(stream);
-    }
+    void write_cache_entry(const std::string& id, StreamWriter writer) override;
 
-    void read_cache_entry(const std::string& id, StreamReader reader) override {
-        auto blobFileName = getBlobFile(id);
-        if (FileUtils::fileExist(blobFileName)) {
-            std::ifstream stream(blobFileName, std::ios_base::binary);
-            reader(stream);
-        }
-    }
+    void read_cache_entry(const std::string& id, StreamReader reader) override;
 
     void remove_cache_entry(const std::string& id) override {
         auto blobFileName = getBlobFile(id);
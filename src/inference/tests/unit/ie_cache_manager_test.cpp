@@ -0,0 +1,185 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <ctime>
+#include <fstream>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "common_test_utils/common_utils.hpp"
+#include "common_test_utils/file_utils.hpp"
+#include "ie_cache_manager.hpp"
+
+#ifndef _WIN32
+#    include <utime.h>
+#else
+#    include <sys/utime.h>
+#endif
+
+using namespace ov;
+using namespace ::testing;
+
+#ifdef __linux__
+namespace {
+// the field of /proc/self/status in kB, e.g. RssAnon or VmHWM, 0 if the kernel does not report it
+size_t getStatusInKB(const std::string& field) {
+    std::ifstream status("/proc/self/status");
+    std::string line;
+    while (std::getline(status, line)) {
+        if (line.compare(0, field.size() + 1, field + ":") == 0)
+            return std::stoul(line.substr(field.size() + 1));
+    }
+    return 0;
+}
+}  // namespace
+#endif
+
+class FileStorageCacheManagerTests : public Test {
+public:
+    std::string m_cacheDir;
+    std::shared_ptr<ICacheManager> m_cacheManager;
+
+    void SetUp() override {
+        m_cacheDir = CommonTestUtils::generateTestFilePrefix() + "_cache";
+        CommonTestUtils::createDirectory(m_cacheDir);
+    }
+
+    void TearDown() override {
+        CommonTestUtils::removeFilesWithExt(m_cacheDir, "blob");
+        CommonTestUtils::removeFilesWithExt(m_cacheDir, "tmp");
+        CommonTestUtils::removeDir(m_cacheDir);
+    }
+
+    void write(const std::string& id, const std::string& content) {
+        m_cacheManager->write_cache_entry(id, [&](std::ostream& stream) {
+            stream << content;
+        });
+    }
+
+    std::string read(const std::string& id) {
+        std::string content;
+        m_cacheManager->read_cache_entry(id, [&](std::istream& stream) {
+            content.assign(std::istreambuf_iterator<char>(stream), std::istreambuf_iterator<char>());
+        });
+        return content;
+    }
+
+    std::string blobFile(const std::string& id) const {
+        return FileUtils::makePath(m_cacheDir, id + ".blob");
+    }
+
+    static void setAccessTime(const std::string& file, std::time_t time) {
+#ifndef _WIN32
+        struct utimbuf times = {time, time};
+        utime(file.c_str(), &times);
+#else
+        struct _utimbuf times = {time, time};
+        _utime(file.c_str(), &times);
+#endif
+    }
+};
+
+TEST_F(FileStorageCacheManagerTests, ReadWrittenEntry) {
+    m_cacheManager = std::make_shared<FileStorageCacheManager>(m_cacheDir);
+    write("entry", "cached blob");
+    EXPECT_EQ(read("entry"), "cached blob");
+    EXPECT_TRUE(read("missing").empty());
+    // only the published entry is left in the directory
+    EXPECT_EQ(CommonTestUtils::listFilesWithExt(m_cacheDir, "blob").size(), 1);
+    EXPECT_TRUE(CommonTestUtils::listFilesWithExt(m_cacheDir, "tmp").empty());
+}
+
+TEST_F(FileStorageCacheManagerTests, MappedEntryIsSeekable) {
+    m_cacheManager = std::make_shared<FileStorageCacheManager>(m_cacheDir);
+    write("entry", "0123456789");
+    m_cacheManager->read_cache_entry("entry", [&](std::istream& stream) {
+        char value;
+        stream.seekg(5, std::ios_base::beg);
+        stream.get(value);
+        EXPECT_EQ(value, '5');
+        EXPECT_EQ(stream.tellg(), 6);
+        stream.seekg(-2, std::ios_base::end);
+        stream.get(value);
+        EXPECT_EQ(value, '8');
+        stream.seekg(-8, std::ios_base::cur);
+        stream.get(value);
+        EXPECT_EQ(value, '1');
+    });
+}
+
+TEST_F(FileStorageCacheManagerTests, FailedWriterDoesNotPublishEntry) {
+    m_cacheManager = std::make_shared<FileStorageCacheManager>(m_cacheDir);
+    EXPECT_ANY_THROW(m_cacheManager->write_cache_entry("entry", [&](std::ostream& stream) {
+        stream << "partial";
+        throw std::runtime_error("export failed");
+    }));
+    EXPECT_FALSE(FileUtils::fileExist(blobFile("entry")));
+    EXPECT_TRUE(CommonTestUtils::listFilesWithExt(m_cacheDir, "tmp").empty());
+}
+
+TEST_F(FileStorageCacheManagerTests, EvictsLeastRecentlyUsedEntries) {
+    const std::string content(100, 'a');
+    // two entries fit the limit
+    m_cacheManager = std::make_shared<FileStorageCacheManager>(m_cacheDir, 250);
+    const auto now = std::time(nullptr);
+    write("first", content);
+    setAccessTime(blobFile("first"), now - 100);
+    write("second", content);
+    setAccessTime(blobFile("second"), now - 50);
+    // the read makes the first entry the most recently used one
+    EXPECT_EQ(read("first"), content);
+
+    write("third", content);
+    EXPECT_TRUE(FileUtils::fileExist(blobFile("first")));
+    EXPECT_FALSE(FileUtils::fileExist(blobFile("second")));
+    EXPECT_TRUE(FileUtils::fileExist(blobFile("third")));
+}
+
+TEST_F(FileStorageCacheManagerTests, NoEvictionWithoutLimit) {
+    const std::string content(100, 'a');
+    m_cacheManager = std::make_shared<FileStorageCacheManager>(m_cacheDir);
+    for (const auto& id : {"first", "second", "third"})
+        write(id, content);
+    EXPECT_EQ(CommonTestUtils::listFilesWithExt(m_cacheDir, "blob").size(), 3);
+}
+
+#ifdef __linux__
+// Reports the memory used by a cache hit on a large blob. The entry is mapped, so the reader copies the data into its
+// own small buffer without the heap growing by the blob size, and the mapped pages are released after the read.
+TEST_F(FileStorageCacheManagerTests, CacheHitDoesNotCopyEntryToHeap) {
+    const size_t blobSize = 64 << 20, chunkSize = 1 << 20;
+    m_cacheManager = std::make_shared<FileStorageCacheManager>(m_cacheDir);
+    std::vector<char> chunk(chunkSize, 'a');
+    m_cacheManager->write_cache_entry("large", [&](std::ostream& stream) {
+        for (size_t written = 0; written < blobSize; written += chunkSize)
+            stream.write(chunk.data(), chunkSize);
+    });
+    if (getStatusInKB("RssAnon") == 0)
+        GTEST_SKIP() << "RssAnon is not reported";
+
+    const size_t anonBefore = getStatusInKB("RssAnon");
+    const size_t fileBefore = getStatusInKB("RssFile");
+    size_t anonPeak = anonBefore, filePeak = fileBefore, read = 0;
+    m_cacheManager->read_cache_entry("large", [&](std::istream& stream) {
+        while (stream.read(chunk.data(), chunkSize) || stream.gcount() > 0) {
+            read += static_cast<size_t>(stream.gcount());
+            anonPeak = std::max(anonPeak, getStatusInKB("RssAnon"));
+            filePeak = std::max(filePeak, getStatusInKB("RssFile"));
+        }
+    });
+    const size_t fileAfter = getStatusInKB("RssFile");
+    std::cout << "cache hit on " << (blobSize >> 10) << " kB blob: peak RSS +" << (anonPeak - anonBefore)
+              << " kB anonymous, +" << (filePeak - fileBefore) << " kB file backed, VmHWM " << getStatusInKB("VmHWM")
+              << " kB" << std::endl;
+
+    EXPECT_EQ(read, blobSize);
+    EXPECT_LT((anonPeak - anonBefore) << 10, blobSize / 4);
+    EXPECT_LT(fileAfter > fileBefore ? (fileAfter - fileBefore) << 10 : 0, blobSize / 4);
+}
+#endif
@@ -55,7 +55,8 @@ IE::Parameter AutoExecutableNetwork::GetMetric(const std::string& name) const {
             ov::PropertyName{ov::hint::model_priority.name(), ov::PropertyMutability::RO},
             ov::PropertyName{ov::device::priorities.name(), ov::PropertyMutability::RO},
             ov::PropertyName{ov::device::properties.name(), ov::PropertyMutability::RO},
-            ov::PropertyName{ov::execution_devices.name(), ov::PropertyMutability::RO}};
+            ov::PropertyName{ov::execution_devices.name(), ov::PropertyMutability::RO},
+            ov::PropertyName{ov::intel_auto::routing_stats.name(), ov::PropertyMutability::RO}};
     } else if (name == ov::hint::performance_mode) {
         auto value = _autoSContext->_performanceHint;
         if (!_autoSContext->_core->isNewAPI())
@@ -255,6 +256,8 @@ IE::Parameter AutoExecutableNetwork::GetMetric(const std::string& name) const {
             }
         }
         return execution_devices;
+    } else if (name == ov::intel_auto::routing_stats) {
+        return decltype(ov::intel_auto::routing_stats)::value_type {_autoSchedule->GetRoutingStats()};
     } else if (name == ov::model_name) {
         std::lock_guard<std::mutex> lock(_autoSContext->_confMutex);
         if (_autoSchedule->_pCTPUTLoadContext) {
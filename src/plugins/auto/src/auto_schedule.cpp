@@ -160,6 +160,9 @@ void AutoSchedule::GenerateWorkers(const std::string& device,
     auto& workerRequests = _workerRequests[device];
     auto& idleWorkerRequests = _idleWorkerRequests[device];
     workerRequests.resize(numRequests);
+    if (_router) {
+        _router->addDevice(device, numRequests);
+    }
     _inferPipelineTasksDeviceSpecific[device] = std::unique_ptr<IE::ThreadSafeQueue<IE::Task>>(new IE::ThreadSafeQueue<IE::Task>);
     auto* idleWorkerRequestsPtr = &(idleWorkerRequests);
     idleWorkerRequests.set_capacity(numRequests);
@@ -173,6 +176,11 @@ void AutoSchedule::GenerateWorkers(const std::string& device,
             [workerRequestPtr, this, device, idleWorkerRequestsPtr](std::exception_ptr exceptionPtr) mutable {
                 IdleGuard<NotBusyPriorityWorkerRequests> idleGuard{workerRequestPtr, *idleWorkerRequestsPtr};
                 workerRequestPtr->_exceptionPtr = exceptionPtr;
+                if (_router) {
+                    std::chrono::duration<double, std::milli> latency =
+                        std::chrono::steady_clock::now() - workerRequestPtr->_dispatchTime;
+                    _router->onComplete(device, latency.count(), exceptionPtr == nullptr);
+                }
                 {
                     auto stopRetryAndContinue = [workerRequestPtr]() {
                         auto capturedTask = std::move(workerRequestPtr->_task);
@@ -354,6 +362,10 @@ void AutoSchedule::init(const ScheduleContext::Ptr& sContext) {
                 _pCTPUTLoadContext[idx].deviceInfo.config[CONFIG_KEY(PERFORMANCE_HINT)] =
                     IE::PluginConfigParams::THROUGHPUT;
             }
+            if (_autoSContext->_latencyAwareRouting) {
+                LOG_INFO_TAG("latency aware routing enabled, request deadline:%u ms", _autoSContext->_requestDeadline);
+                _router.reset(new LatencyAwareRouter(static_cast<double>(_autoSContext->_requestDeadline)));
+            }
         }
         if (_autoSContext->_LogTag == "MULTI") {
             // MULTI's performance hint always is tput
@@ -760,6 +772,10 @@ void AutoSchedule::WaitActualNetworkReady() const {
     });
 }
 
+std::string AutoSchedule::GetRoutingStats() const {
+    return _router ? _router->report() : std::string("{}");
+}
+
 bool AutoSchedule::ScheduleToWorkerInferRequest(IE::Task inferPipelineTask, DeviceName preferred_device) {
     std::vector<DeviceInformation> devices;
     // AUTO work mode
@@ -798,12 +814,30 @@ bool AutoSchedule::ScheduleToWorkerInferRequest(IE::Task inferPipelineTask, Devi
         }
     }
     lock.unlock();
-    for (auto&& device : devices) {
-        if (!preferred_device.empty() && (device.deviceName != preferred_device)) {
-            continue;
+    if (_router && preferred_device.empty()) {
+        std::vector<DeviceName> deviceNames;
+        for (auto&& device : devices) {
+            deviceNames.push_back(device.deviceName);
         }
-        if (RunPipelineTask(inferPipelineTask, _idleWorkerRequests[device.deviceName], preferred_device)) {
-            return true;
+        const auto routedDevices = _router->route(deviceNames);
+        if (!routedDevices.empty()) {
+            const auto& deviceName = routedDevices.front();
+            _router->onDispatch(deviceName);
+            if (RunPipelineTask(inferPipelineTask, _idleWorkerRequests[deviceName], preferred_device)) {
+                return true;
+            }
+            _router->onCancel(deviceName);
+            // the busy device is still expected to complete earlier than the rest ones,
+            // so the task waits for its next idle request in the queue
+        }
+    } else {
+        for (auto&& device : devices) {
+            if (!preferred_device.empty() && (device.deviceName != preferred_device)) {
+                continue;
+            }
+            if (RunPipelineTask(inferPipelineTask, _idleWorkerRequests[device.deviceName], preferred_device)) {
+                return true;
+            }
         }
     }
     // no vacant requests this time, storing the task to the respective queue
@@ -824,6 +858,7 @@ bool AutoSchedule::RunPipelineTask(IE::Task& inferPipelineTask,
         workerRequestPtr = worker.second;
         IdleGuard<NotBusyPriorityWorkerRequests> idleGuard{workerRequestPtr, idleWorkerRequests};
         _thisWorkerInferRequest = workerRequestPtr;
+        workerRequestPtr->_dispatchTime = std::chrono::steady_clock::now();
         {
             auto capturedTask = std::move(inferPipelineTask);
             capturedTask();
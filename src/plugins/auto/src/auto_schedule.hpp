@@ -6,6 +6,7 @@
 #pragma once
 
 #include "schedule.hpp"
+#include "latency_router.hpp"
 
 #ifdef  MULTIUNITTEST
 #define MOCKTESTMACRO virtual
@@ -61,6 +62,7 @@ public:
     void run(IE::Task inferTask) override;
     Pipeline GetPipeline(const IInferPtr& syncRequestImpl, WorkerInferRequest** WorkerInferRequest) override;
     void WaitActualNetworkReady() const;
+    std::string GetRoutingStats() const;
     virtual ~AutoSchedule();
 
 public:
@@ -83,6 +85,8 @@ protected:
     AutoScheduleContext::Ptr                                _autoSContext;
     std::atomic_size_t                                      _numRequestsCreated = {0};
     DeviceMap<std::vector<WorkerInferRequest>>              _workerRequests;
+    // routes the requests by the expected completion in the cumulative throughput mode, nullptr if disabled
+    std::unique_ptr<LatencyAwareRouter>                     _router;
 
 private:
     /**
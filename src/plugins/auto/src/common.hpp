@@ -82,6 +82,7 @@ struct WorkerInferRequest {
     std::exception_ptr _exceptionPtr = nullptr;
     std::list<Time>    _startTimes;
     std::list<Time>    _endTimes;
+    Time               _dispatchTime;
     int                _index = 0;
     MultiImmediateExecutor::Ptr  _fallbackExec;
 };
@@ -202,6 +203,8 @@ public:
     bool                                           _batchingDisabled = {false};
     bool                                           _startupfallback = true;
     bool                                           _runtimeFallback = true;
+    bool                                           _latencyAwareRouting = false;
+    unsigned int                                   _requestDeadline = 0;
     std::string                                    _modelPath;
     IE::CNNNetwork                                 _network;
     std::string                                    _strDevices;
@@ -0,0 +1,118 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+#include "latency_router.hpp"
+
+#include <algorithm>
+#include <limits>
+#include <sstream>
+
+namespace MultiDevicePlugin {
+LatencyAwareRouter::LatencyAwareRouter(double deadline, double smoothing)
+    : _deadline(deadline),
+      _smoothing(smoothing) {
+}
+
+void LatencyAwareRouter::addDevice(const std::string& device, size_t numRequests) {
+    std::lock_guard<std::mutex> lock(_mutex);
+    if (_devices.find(device) == _devices.end())
+        _order.push_back(device);
+    _devices[device].numRequests = numRequests;
+}
+
+double LatencyAwareRouter::expectedCompletion(const DeviceState& state) const {
+    if (state.numRequests == 0)
+        return std::numeric_limits<double>::max();
+    if (!state.hasLatency) {
+        // a single request probes the latency of the device
+        return state.inFlight == 0 ? 0.0 : std::numeric_limits<double>::max();
+    }
+    if (state.inFlight < state.numRequests)
+        return state.latency;
+    // the requests in flight finish evenly, so the next one starts when the first of them completes
+    const auto waiting = static_cast<double>(state.inFlight - state.numRequests + 1);
+    return state.latency + state.latency * waiting / state.numRequests;
+}
+
+double LatencyAwareRouter::expectedCompletion(const std::string& device) const {
+    std::lock_guard<std::mutex> lock(_mutex);
+    auto it = _devices.find(device);
+    return it == _devices.end() ? std::numeric_limits<double>::max() : expectedCompletion(it->second);
+}
+
+std::vector<std::string> LatencyAwareRouter::route(const std::vector<std::string>& devices) const {
+    struct Candidate {
+        std::string device;
+        double expected;
+        bool meetsDeadline;
+    };
+    std::vector<Candidate> candidates;
+    candidates.reserve(devices.size());
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        for (const auto& device : devices) {
+            auto it = _devices.find(device);
+            const double expected =
+                it == _devices.end() ? std::numeric_limits<double>::max() : expectedCompletion(it->second);
+            candidates.push_back({device, expected, _deadline > 0.0 && expected <= _deadline});
+        }
+    }
+    // the stable sort keeps the priority order of the devices with the same expectation
+    std::stable_sort(candidates.begin(), candidates.end(), [](const Candidate& a, const Candidate& b) {
+        if (a.meetsDeadline || b.meetsDeadline)
+            return a.meetsDeadline && !b.meetsDeadline;
+        return a.expected < b.expected;
+    });
+    std::vector<std::string> result;
+    result.reserve(candidates.size());
+    for (auto& candidate : candidates)
+        result.push_back(std::move(candidate.device));
+    return result;
+}
+
+void LatencyAwareRouter::onDispatch(const std::string& device) {
+    std::lock_guard<std::mutex> lock(_mutex);
+    auto& state = _devices[device];
+    state.inFlight++;
+    state.dispatched++;
+}
+
+void LatencyAwareRouter::onCancel(const std::string& device) {
+    std::lock_guard<std::mutex> lock(_mutex);
+    auto& state = _devices[device];
+    if (state.inFlight > 0)
+        state.inFlight--;
+    if (state.dispatched > 0)
+        state.dispatched--;
+}
+
+void LatencyAwareRouter::onComplete(const std::string& device, double latency, bool succeeded) {
+    std::lock_guard<std::mutex> lock(_mutex);
+    auto& state = _devices[device];
+    if (state.inFlight > 0)
+        state.inFlight--;
+    state.completed++;
+    if (!succeeded)
+        return;
+    state.latency = state.hasLatency ? state.latency + _smoothing * (latency - state.latency) : latency;
+    state.hasLatency = true;
+    if (_deadline > 0.0 && latency > _deadline)
+        state.deadlineMisses++;
+}
+
+std::string LatencyAwareRouter::report() const {
+    std::lock_guard<std::mutex> lock(_mutex);
+    std::ostringstream os;
+    os << "{";
+    for (size_t i = 0; i < _order.size(); i++) {
+        const auto& state = _devices.at(_order[i]);
+        os << (i ? "," : "") << "\"" << _order[i] << "\":{\"latency_ms\":" << state.latency
+           << ",\"in_flight\":" << state.inFlight << ",\"dispatched\":" << state.dispatched
+           << ",\"completed\":" << state.completed << ",\"deadline_misses\":" << state.deadlineMisses << "}";
+    }
+    os << "}";
+    return os.str();
+}
+}  // namespace MultiDevicePlugin
@@ -0,0 +1,74 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+#pragma once
+
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#ifdef  MULTIUNITTEST
+#define MOCKTESTMACRO virtual
+#define MultiDevicePlugin MockMultiDevicePlugin
+#else
+#define MOCKTESTMACRO
+#endif
+
+namespace MultiDevicePlugin {
+/**
+ * @brief Routes the infer requests of the cumulative throughput mode to the device with the earliest expected
+ * completion. The latency of each device is tracked as an exponential moving average, the completion is expected
+ * after the latency if the device has an idle infer request, otherwise after the wait for the first request to finish.
+ */
+class LatencyAwareRouter {
+public:
+    /**
+     * @param deadline  latency budget of a request in milliseconds, 0 if there is no budget
+     * @param smoothing weight of the latest latency sample in the moving average
+     */
+    explicit LatencyAwareRouter(double deadline = 0.0, double smoothing = 0.2);
+
+    void addDevice(const std::string& device, size_t numRequests);
+
+    /**
+     * @brief Orders the devices to try for the next request.
+     * @param devices the candidate devices in the priority order
+     * @return the devices ordered by the expected completion, if the deadline is set, the devices expected to meet it
+     * go first in the priority order
+     */
+    std::vector<std::string> route(const std::vector<std::string>& devices) const;
+
+    // the request was sent to the device
+    void onDispatch(const std::string& device);
+    // the device had no idle infer request, so the request was not sent
+    void onCancel(const std::string& device);
+    // the request completed, the failed ones don't update the latency
+    void onComplete(const std::string& device, double latency, bool succeeded);
+
+    // expected completion of the next request in milliseconds
+    double expectedCompletion(const std::string& device) const;
+    std::string report() const;
+
+private:
+    struct DeviceState {
+        size_t numRequests = 0;
+        size_t inFlight = 0;
+        bool hasLatency = false;
+        double latency = 0.0;
+        size_t dispatched = 0;
+        size_t completed = 0;
+        size_t deadlineMisses = 0;
+    };
+    double expectedCompletion(const DeviceState& state) const;
+
+    const double _deadline;
+    const double _smoothing;
+    mutable std::mutex _mutex;
+    std::unordered_map<std::string, DeviceState> _devices;
+    // to report the devices in the order they were added
+    std::vector<std::string> _order;
+};
+}  // namespace MultiDevicePlugin
@@ -459,12 +459,16 @@ IExecutableNetworkInternal::Ptr MultiDeviceInferencePlugin::LoadNetworkImpl(cons
     autoSContext->_LogTag = _LogTag;
     autoSContext->_startupfallback = loadConfig.get_property(ov::intel_auto::enable_startup_fallback);
     autoSContext->_runtimeFallback = loadConfig.get_property(ov::intel_auto::enable_runtime_fallback);
+    autoSContext->_latencyAwareRouting = loadConfig.get_property(ov::intel_auto::enable_latency_aware_routing);
+    autoSContext->_requestDeadline = loadConfig.get_property(ov::intel_auto::request_deadline);
     IExecutableNetworkInternal::Ptr impl;
     // enable bind only in cumulative_throughput mode
     if (loadConfig.get_property(ov::intel_auto::device_bind_buffer) &&
         autoSContext->_performanceHint == "CUMULATIVE_THROUGHPUT") {
         LOG_INFO_TAG("runtime fallback set to disabled in binder mode");
         autoSContext->_runtimeFallback = false;
+        // the infer requests are bound to the device requests, so there is nothing to route
+        autoSContext->_latencyAwareRouting = false;
         impl = std::make_shared<AutoExecutableNetwork>(autoSContext, std::make_shared<BinderMultiSchedule>());
     } else {
         impl = std::make_shared<AutoExecutableNetwork>(autoSContext, std::make_shared<AutoSchedule>());
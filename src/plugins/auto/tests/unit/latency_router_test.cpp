@@ -0,0 +1,83 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+#include "latency_router.hpp"
+
+using namespace MockMultiDevicePlugin;
+
+namespace {
+const std::vector<std::string> devices = {"GPU", "CPU"};
+
+void complete(LatencyAwareRouter& router, const std::string& device, double latency) {
+    router.onDispatch(device);
+    router.onComplete(device, latency, true);
+}
+}  // namespace
+
+TEST(LatencyAwareRouterTest, probesDevicesInPriorityOrder) {
+    LatencyAwareRouter router;
+    router.addDevice("GPU", 2);
+    router.addDevice("CPU", 2);
+    EXPECT_EQ(router.route(devices), devices);
+    // a single request probes the device without latency samples
+    router.onDispatch("GPU");
+    EXPECT_EQ(router.route(devices), std::vector<std::string>({"CPU", "GPU"}));
+}
+
+TEST(LatencyAwareRouterTest, prefersDeviceWithEarliestCompletion) {
+    LatencyAwareRouter router;
+    router.addDevice("GPU", 2);
+    router.addDevice("CPU", 2);
+    complete(router, "GPU", 30.0);
+    complete(router, "CPU", 10.0);
+    EXPECT_EQ(router.route(devices), std::vector<std::string>({"CPU", "GPU"}));
+    // the fast device is busy: waiting for it takes 10 + 10 / 2, still earlier than the slow one
+    router.onDispatch("CPU");
+    router.onDispatch("CPU");
+    EXPECT_DOUBLE_EQ(router.expectedCompletion("CPU"), 15.0);
+    EXPECT_EQ(router.route(devices), std::vector<std::string>({"CPU", "GPU"}));
+    router.onDispatch("CPU");
+    router.onDispatch("CPU");
+    EXPECT_DOUBLE_EQ(router.expectedCompletion("CPU"), 25.0);
+    router.onDispatch("CPU");
+    EXPECT_EQ(router.route(devices), std::vector<std::string>({"GPU", "CPU"}));
+}
+
+TEST(LatencyAwareRouterTest, latencyIsMovingAverage) {
+    LatencyAwareRouter router(0.0, 0.5);
+    router.addDevice("CPU", 1);
+    complete(router, "CPU", 10.0);
+    complete(router, "CPU", 20.0);
+    EXPECT_DOUBLE_EQ(router.expectedCompletion("CPU"), 15.0);
+    // the failed requests don't update the latency
+    router.onDispatch("CPU");
+    router.onComplete("CPU", 1000.0, false);
+    EXPECT_DOUBLE_EQ(router.expectedCompletion("CPU"), 15.0);
+}
+
+TEST(LatencyAwareRouterTest, deadlineKeepsPriorityOrder) {
+    LatencyAwareRouter router(20.0);
+    router.addDevice("GPU", 1);
+    router.addDevice("CPU", 1);
+    complete(router, "GPU", 15.0);
+    complete(router, "CPU", 5.0);
+    // both devices meet the deadline, so the priority order is kept
+    EXPECT_EQ(router.route(devices), devices);
+    router.onDispatch("GPU");
+    EXPECT_EQ(router.route(devices), std::vector<std::string>({"CPU", "GPU"}));
+    router.onComplete("GPU", 25.0, true);
+    EXPECT_NE(router.report().find("\"GPU\":{\"latency_ms\":17"), std::string::npos);
+    EXPECT_NE(router.report().find("\"deadline_misses\":1"), std::string::npos);
+}
+
+TEST(LatencyAwareRouterTest, cancelRestoresState) {
+    LatencyAwareRouter router;
+    router.addDevice("CPU", 1);
+    router.onDispatch("CPU");
+    router.onCancel("CPU");
+    EXPECT_EQ(router.report(),
+              "{\"CPU\":{\"latency_ms\":0,\"in_flight\":0,\"dispatched\":0,\"completed\":0,\"deadline_misses\":0}}");
+    EXPECT_EQ(router.route({"GPU", "CPU"}), std::vector<std::string>({"CPU", "GPU"}));
+}
@@ -8,10 +8,44 @@
 ov::intel_cpu::AsyncInferRequest::AsyncInferRequest(const InferenceEngine::IInferRequestInternal::Ptr& inferRequest,
                                                     const InferenceEngine::ITaskExecutor::Ptr& taskExecutor,
                                                     const InferenceEngine::ITaskExecutor::Ptr& callbackExecutor)
-    : InferenceEngine::AsyncInferRequestThreadSafeDefault(inferRequest, taskExecutor, callbackExecutor) {
-    static_cast<InferRequestBase*>(inferRequest.get())->SetAsyncRequest(this);
+    : InferenceEngine::AsyncInferRequestThreadSafeDefault(inferRequest, taskExecutor, callbackExecutor),
+      _inferRequest(static_cast<InferRequestBase*>(inferRequest.get())) {
+    _inferRequest->SetAsyncRequest(this);
 }
 
 ov::intel_cpu::AsyncInferRequest::~AsyncInferRequest() {
     StopAndWait();
 }
+
+void ov::intel_cpu::AsyncInferRequest::EnableContinuousBatching(const std::shared_ptr<ContinuousBatching>& batching) {
+    // queues the sequence into the next step instead of running the inference, the step runs the next stage
+    struct SequenceExecutor : public InferenceEngine::ITaskExecutor {
+        SequenceExecutor(AsyncInferRequest* request, std::shared_ptr<ContinuousBatching> batching)
+            : _request(request), _batching(std::move(batching)) {}
+        void run(InferenceEngine::Task task) override {
+            auto request = _request;
+            _batching->enqueue(request->_inferRequest, [request, task](std::exception_ptr exception) {
+                request->_stepException = exception;
+                task();
+            });
+        }
+        AsyncInferRequest* _request;
+        std::shared_ptr<ContinuousBatching> _batching;
+    };
+    _pipeline = {{std::make_shared<SequenceExecutor>(this, batching), [this] {
+                      auto exception = _stepException;
+                      _stepException = nullptr;
+                      if (exception)
+                          std::rethrow_exception(exception);
+                  }}};
+    _continuousBatching = true;
+}
+
+void ov::intel_cpu::AsyncInferRequest::Infer_ThreadUnsafe() {
+    // the sequence waits for its step like the asynchronous inference does
+    if (_continuousBatching) {
+        InferUsingAsync();
+    } else {
+        InferenceEngine::AsyncInferRequestThreadSafeDefault::Infer_ThreadUnsafe();
+    }
+}
@@ -8,6 +8,7 @@
 #include <map>
 #include <cpp_interfaces/impl/ie_infer_async_request_thread_safe_default.hpp>
 #include "infer_request.h"
+#include "continuous_batching.h"
 
 namespace ov {
 namespace intel_cpu {
@@ -18,8 +19,19 @@ public:
                       const InferenceEngine::ITaskExecutor::Ptr &taskExecutor,
                       const InferenceEngine::ITaskExecutor::Ptr &callbackExecutor);
     ~AsyncInferRequest();
+
+    // the inferences of the request are executed as the sequence of the steps of the continuous batching
+    void EnableContinuousBatching(const std::shared_ptr<ContinuousBatching>& batching);
+
+protected:
+    void Infer_ThreadUnsafe() override;
+
+private:
+    InferRequestBase* _inferRequest;
+    bool _continuousBatching = false;
+    // the exception of the last step of the sequence, it is rethrown by the pipeline
+    std::exception_ptr _stepException;
 };
 
 }   // namespace intel_cpu
 }   // namespace ov
-
@@ -6,6 +6,7 @@
 
 #include <memory>
 #include <functional>
+#include <mutex>
 #include "lru_cache.h"
 
 namespace ov {
@@ -29,6 +30,8 @@ public:
  *         interface and must have constructor of type ImplType(size_t).
  *
  * @note In this implementation default constructed value objects are treated as empty objects.
+ * @note The storage is accessed under the lock, the builder is called without it, so the different values are built
+ *       concurrently and the same value may be built twice by the threads missing the cache at the same time.
  */
 
 template<typename KeyType,
@@ -54,18 +57,24 @@ public:
             // fast track
             return {builder(key), CacheEntryBase::LookUpStatus::Miss};
         }
-        auto retStatus = LookUpStatus::Hit;
-        ValType retVal = _impl.get(key);
         auto retEmpty = ValType();
-        if (retVal == retEmpty) {
-            retStatus = LookUpStatus::Miss;
-            retVal = builder(key);
+        {
+            std::lock_guard<std::mutex> lock(_mutex);
+            ValType retVal = _impl.get(key);
             if (retVal != retEmpty)
-                _impl.put(key, retVal);
+                return {retVal, LookUpStatus::Hit};
         }
-        return {retVal, retStatus};
+        ValType retVal = builder(key);
+        if (retVal != retEmpty) {
+            std::lock_guard<std::mutex> lock(_mutex);
+            _impl.put(key, retVal);
+        }
+        return {retVal, LookUpStatus::Miss};
     }
 
+private:
+    std::mutex _mutex;
+
 public:
     ImplType _impl;
 };
@@ -0,0 +1,38 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "jit_kernel_registry.h"
+
+#include <sstream>
+
+namespace ov {
+namespace intel_cpu {
+
+std::atomic_size_t JitKernelRegistry::typeIdCounter{0};
+
+JitKernelRegistry& JitKernelRegistry::instance() {
+    static JitKernelRegistry registry;
+    return registry;
+}
+
+JitKernelRegistry::Stats JitKernelRegistry::getStats() const {
+    Stats stats;
+    std::lock_guard<std::mutex> lock(mutex);
+    stats.hits = hits;
+    stats.misses = misses;
+    stats.sharedCodeSize = sharedCodeSize;
+    for (auto& entry : entries)
+        entry.second->collect(stats);
+    return stats;
+}
+
+std::string JitKernelRegistry::Stats::toJson() const {
+    std::ostringstream os;
+    os << "{\"hits\":" << hits << ",\"misses\":" << misses << ",\"kernels\":" << kernels
+       << ",\"code_size\":" << codeSize << ",\"shared_code_size\":" << sharedCodeSize << "}";
+    return os.str();
+}
+
+}   // namespace intel_cpu
+}   // namespace ov
@@ -0,0 +1,179 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+
+#if defined(OPENVINO_ARCH_X86_64)
+#include <cpu/x64/jit_generator.hpp>
+#endif
+
+namespace ov {
+namespace intel_cpu {
+
+/**
+ * @brief Process-wide registry of the JIT kernels keyed by the content of their configurations.
+ * The kernels with the equal configurations are generated once and shared by the nodes of all the graphs and the
+ * streams. The registry doesn't own the kernels, so a kernel is destroyed together with its last user.
+ *
+ * @note The kernels must not change after the code generation, since they are executed concurrently.
+ */
+class JitKernelRegistry {
+public:
+    struct Stats {
+        // the kernels found in the registry
+        uint64_t hits = 0;
+        // the kernels generated
+        uint64_t misses = 0;
+        // the kernels alive and their code size in bytes
+        size_t kernels = 0;
+        size_t codeSize = 0;
+        // the code size the hits didn't generate
+        uint64_t sharedCodeSize = 0;
+
+        std::string toJson() const;
+    };
+
+    static JitKernelRegistry& instance();
+
+    /**
+     * @brief Searches the kernel with the equal key or generates it with the builder.
+     * @param key is a type that must define hash() const method with return type convertible to size_t and define
+     *        comparison operator. It must contain everything the code generation depends on.
+     * @param builder is a callable object, which creates the polymorphic kernel of KernelType from the key and
+     *        generates its code.
+     *        The builder may return nullptr, e.g. if the ISA is not supported, such a result is not registered.
+     * @note The builder is called without the lock, so the threads missing the same key at the same time generate
+     *       the kernel twice and the first registered one is shared.
+     */
+    template <typename KernelType, typename KeyType, typename BuilderType>
+    std::shared_ptr<KernelType> getOrCreate(const KeyType& key, BuilderType builder);
+
+    Stats getStats() const;
+
+private:
+    struct EntryBase {
+        virtual ~EntryBase() = default;
+        // adds the alive kernels to the stats and forgets the expired ones
+        virtual void collect(Stats& stats) = 0;
+    };
+
+    template <typename KeyType, typename KernelType>
+    struct Entry : public EntryBase {
+        struct KeyHasher {
+            size_t operator()(const KeyType& key) const {
+                return key.hash();
+            }
+        };
+        struct Record {
+            std::weak_ptr<KernelType> kernel;
+            size_t codeSize;
+        };
+
+        void collect(Stats& stats) override {
+            for (auto it = records.begin(); it != records.end();) {
+                if (it->second.kernel.expired()) {
+                    it = records.erase(it);
+                } else {
+                    stats.kernels++;
+                    stats.codeSize += it->second.codeSize;
+                    ++it;
+                }
+            }
+        }
+
+        std::unordered_map<KeyType, Record, KeyHasher> records;
+        // the expired records are forgotten when the number of the records reaches the threshold
+        size_t purgeThreshold = 64;
+    };
+
+    template <typename KeyType, typename KernelType>
+    Entry<KeyType, KernelType>& getEntry();
+
+    template <typename T>
+    static size_t getTypeId();
+
+    template <typename KernelType>
+    static size_t getCodeSize(const KernelType& kernel) {
+#if defined(OPENVINO_ARCH_X86_64)
+        auto generator = dynamic_cast<const dnnl::impl::cpu::x64::jit_generator*>(&kernel);
+        return generator ? generator->getSize() : 0;
+#else
+        return 0;
+#endif
+    }
+
+    static std::atomic_size_t typeIdCounter;
+
+    mutable std::mutex mutex;
+    std::unordered_map<size_t, std::unique_ptr<EntryBase>> entries;
+    uint64_t hits = 0;
+    uint64_t misses = 0;
+    uint64_t sharedCodeSize = 0;
+};
+
+template <typename T>
+size_t JitKernelRegistry::getTypeId() {
+    static size_t id = typeIdCounter.fetch_add(1);
+    return id;
+}
+
+template <typename KeyType, typename KernelType>
+JitKernelRegistry::Entry<KeyType, KernelType>& JitKernelRegistry::getEntry() {
+    using EntryType = Entry<KeyType, KernelType>;
+    auto& entry = entries[getTypeId<EntryType>()];
+    if (!entry)
+        entry.reset(new EntryType());
+    return static_cast<EntryType&>(*entry);
+}
+
+template <typename KernelType, typename KeyType, typename BuilderType>
+std::shared_ptr<KernelType> JitKernelRegistry::getOrCreate(const KeyType& key, BuilderType builder) {
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        auto& records = getEntry<KeyType, KernelType>().records;
+        auto found = records.find(key);
+        if (found != records.end()) {
+            if (auto kernel = found->second.kernel.lock()) {
+                hits++;
+                sharedCodeSize += found->second.codeSize;
+                return kernel;
+            }
+        }
+    }
+
+    std::shared_ptr<KernelType> kernel = builder(key);
+    if (!kernel)
+        return kernel;
+    const size_t codeSize = getCodeSize(*kernel);
+
+    std::lock_guard<std::mutex> lock(mutex);
+    auto& entry = getEntry<KeyType, KernelType>();
+    auto& record = entry.records[key];
+    if (auto registered = record.kernel.lock()) {
+        // another thread has generated the same kernel meanwhile
+        hits++;
+        sharedCodeSize += record.codeSize;
+        return registered;
+    }
+    misses++;
+    record.kernel = kernel;
+    record.codeSize = codeSize;
+    if (entry.records.size() >= entry.purgeThreshold) {
+        Stats stats;
+        entry.collect(stats);
+        entry.purgeThreshold = std::max<size_t>(64, 2 * entry.records.size());
+    }
+    return kernel;
+}
+
+}   // namespace intel_cpu
+}   // namespace ov
@@ -17,6 +17,7 @@
 #include "cpp_interfaces/interface/ie_internal_plugin_config.hpp"
 #include "openvino/core/type/element_type_traits.hpp"
 #include "openvino/runtime/properties.hpp"
+#include "openvino/runtime/intel_cpu/properties.hpp"
 #include "utils/debug_capabilities.h"
 #include "cpu/x64/cpu_isa_traits.hpp"
 
@@ -72,6 +73,50 @@ void Config::applyDebugCapsProperties() {
 }
 #endif
 
+namespace {
+// "name0[1,3,224,224],name1[1,224];name0[1..8,3,320,320],name1[1..8,320]"
+std::vector<std::map<std::string, ov::PartialShape>> parseWarmupShapes(const std::string& value) {
+    auto throwWrongValue = [&value](const std::string& reason) {
+        IE_THROW() << "Wrong value '" << value << "' for property key " << ov::intel_cpu::warmup_shapes.name()
+                   << ". " << reason;
+    };
+
+    std::vector<std::map<std::string, ov::PartialShape>> shapeSets;
+    for (const auto& set : ov::util::split(value, ';')) {
+        std::map<std::string, ov::PartialShape> shapes;
+        size_t pos = 0;
+        while (pos < set.size()) {
+            const auto begin = set.find('[', pos);
+            const auto end = set.find(']', pos);
+            if (begin == std::string::npos || end == std::string::npos || end < begin)
+                throwWrongValue("Expected input shapes in the form name[dims] separated by ','");
+            const auto name = ov::util::trim(set.substr(pos, begin - pos));
+            ov::PartialShape shape;
+            try {
+                shape = ov::PartialShape(set.substr(begin, end - begin + 1));
+            } catch (const std::exception& e) {
+                throwWrongValue(e.what());
+            }
+            if (shape.rank().is_dynamic() || std::any_of(shape.begin(), shape.end(), [](const ov::Dimension& dim) {
+                    return dim.get_max_length() == -1;
+                })) {
+                throwWrongValue("The dimensions must be static or bounded ranges");
+            }
+            if (!shapes.emplace(name, shape).second)
+                throwWrongValue("The input '" + name + "' is set twice in the same set");
+
+            pos = set.find_first_not_of(" ", end + 1);
+            if (pos != std::string::npos && set[pos] != ',')
+                throwWrongValue("The input shapes must be separated by ','");
+            pos = pos == std::string::npos ? set.size() : pos + 1;
+        }
+        if (!shapes.empty())
+            shapeSets.push_back(std::move(shapes));
+    }
+    return shapeSets;
+}
+}  // namespace
+
 void Config::readProperties(const std::map<std::string, std::string> &prop) {
     const auto streamExecutorConfigKeys = streamExecutorConfig.SupportedKeys();
     const auto hintsConfigKeys = perfHintsConfig.SupportedKeys();
@@ -138,6 +183,22 @@ void Config::readProperties(const std::map<std::string, std::string> &prop) {
             else
                 IE_THROW() << "Wrong value for property key " << PluginConfigParams::KEY_PERF_COUNT
                                    << ". Expected only YES/NO";
+        } else if (key == ov::intel_cpu::profiling_sampling_rate.name()) {
+            int val_i = -1;
+            try {
+                val_i = std::stoi(val);
+            } catch (const std::exception&) {
+                IE_THROW() << "Wrong value for property key " << ov::intel_cpu::profiling_sampling_rate.name()
+                           << ". Expected only integer numbers";
+            }
+            if (val_i < 1) {
+                IE_THROW() << "Wrong value for property key " << ov::intel_cpu::profiling_sampling_rate.name()
+                           << ". Sampling rate must be a positive number";
+            }
+            perfCountersSamplingRate = static_cast<uint32_t>(val_i);
+        } else if (key == ov::intel_cpu::warmup_shapes.name()) {
+            warmupShapeSets = parseWarmupShapes(val);
+            warmupShapes = val;
         } else if (key == PluginConfigParams::KEY_EXCLUSIVE_ASYNC_REQUESTS) {
             if (val == PluginConfigParams::YES) exclusiveAsyncRequests = true;
             else if (val == PluginConfigParams::NO) exclusiveAsyncRequests = false;
@@ -165,6 +226,7 @@ void Config::readProperties(const std::map<std::string, std::string> &prop) {
             if (val == PluginConfigParams::YES) {
                 if (mayiuse(avx512_core)) {
                     enforceBF16 = true;
+                    enforceFP16 = false;
                 } else {
                     IE_THROW() << "Platform doesn't support BF16 format";
                 }
@@ -179,14 +241,24 @@ void Config::readProperties(const std::map<std::string, std::string> &prop) {
             if (val == "bf16") {
                 if (mayiuse(avx512_core)) {
                     enforceBF16 = true;
+                    enforceFP16 = false;
                 } else {
                     IE_THROW() << "Platform doesn't support BF16 format";
                 }
+            } else if (val == "f16") {
+                // FP16 values are converted with F16C instructions which are available on all AVX2 platforms
+                if (mayiuse(avx2)) {
+                    enforceFP16 = true;
+                    enforceBF16 = false;
+                } else {
+                    IE_THROW() << "Platform doesn't support FP16 format";
+                }
             } else if (val == "f32") {
                 enforceBF16 = false;
+                enforceFP16 = false;
             } else {
                 IE_THROW() << "Wrong value for property key " << ov::hint::inference_precision.name()
-                    << ". Supported values: bf16, f32";
+                    << ". Supported values: bf16, f16, f32";
             }
             inferencePrecisionSetExplicitly = true;
         } else if (PluginConfigInternalParams::KEY_CPU_RUNTIME_CACHE_CAPACITY == key) {
@@ -220,6 +292,95 @@ void Config::readProperties(const std::map<std::string, std::string> &prop) {
             else
                 IE_THROW() << "Wrong value for property key " << PluginConfigInternalParams::KEY_SNIPPETS_MODE
                             << ". Expected values: ENABLE/DISABLE/IGNORE_CALLBACK";
+        } else if (key == PluginConfigInternalParams::KEY_CPU_DEPTH_FIRST_TILING) {
+            if (val == PluginConfigParams::YES)
+                depthFirstTiling = true;
+            else if (val == PluginConfigParams::NO)
+                depthFirstTiling = false;
+            else
+                IE_THROW() << "Wrong value for property key " << PluginConfigInternalParams::KEY_CPU_DEPTH_FIRST_TILING
+                           << ". Expected only YES/NO";
+        } else if (key == PluginConfigInternalParams::KEY_CPU_DEPTH_FIRST_TILING_CACHE_BUDGET) {
+            int val_i = -1;
+            try {
+                val_i = std::stoi(val);
+            } catch (const std::exception&) {
+                IE_THROW() << "Wrong value for property key " << PluginConfigInternalParams::KEY_CPU_DEPTH_FIRST_TILING_CACHE_BUDGET
+                           << ". Expected only integer numbers";
+            }
+            if (val_i < 0) {
+                IE_THROW() << "Wrong value for property key " << PluginConfigInternalParams::KEY_CPU_DEPTH_FIRST_TILING_CACHE_BUDGET
+                           << ". Expected only non-negative numbers";
+            }
+            depthFirstTilingCacheBudget = static_cast<size_t>(val_i);
+        } else if (key == ov::hint::model_priority.name()) {
+            if (val == "LOW" || val == PluginConfigParams::MODEL_PRIORITY_LOW) {
+                modelPriority = ov::hint::Priority::LOW;
+            } else if (val == "MEDIUM" || val == "DEFAULT" || val == PluginConfigParams::MODEL_PRIORITY_MED) {
+                modelPriority = ov::hint::Priority::MEDIUM;
+            } else if (val == "HIGH" || val == PluginConfigParams::MODEL_PRIORITY_HIGH) {
+                modelPriority = ov::hint::Priority::HIGH;
+            } else {
+                IE_THROW() << "Wrong value for property key " << ov::hint::model_priority.name()
+                    << ". Supported values: LOW, MEDIUM, HIGH";
+            }
+            modelPrioritySetExplicitly = true;
+        } else if (key == ov::intel_cpu::huge_pages.name()) {
+            if (val == "DISABLED") {
+                hugePages = ov::intel_cpu::HugePages::DISABLED;
+            } else if (val == "TRANSPARENT_HUGE_PAGES") {
+                hugePages = ov::intel_cpu::HugePages::TRANSPARENT_HUGE_PAGES;
+            } else if (val == "EXPLICIT_HUGE_PAGES") {
+                hugePages = ov::intel_cpu::HugePages::EXPLICIT_HUGE_PAGES;
+            } else {
+                IE_THROW() << "Wrong value for property key " << ov::intel_cpu::huge_pages.name()
+                    << ". Supported values: DISABLED, TRANSPARENT_HUGE_PAGES, EXPLICIT_HUGE_PAGES";
+            }
+        } else if (key == ov::intel_cpu::numa_aware_allocation.name()) {
+            if (val == PluginConfigParams::YES)
+                numaAwareAllocation = true;
+            else if (val == PluginConfigParams::NO)
+                numaAwareAllocation = false;
+            else
+                IE_THROW() << "Wrong value for property key " << ov::intel_cpu::numa_aware_allocation.name()
+                           << ". Expected only YES/NO";
+        } else if (key == ov::intel_cpu::prefault_memory.name()) {
+            if (val == PluginConfigParams::YES)
+                prefaultMemory = true;
+            else if (val == PluginConfigParams::NO)
+                prefaultMemory = false;
+            else
+                IE_THROW() << "Wrong value for property key " << ov::intel_cpu::prefault_memory.name()
+                           << ". Expected only YES/NO";
+        } else if (key == ov::intel_cpu::lazy_compilation.name()) {
+            if (val == PluginConfigParams::YES)
+                lazyCompilation = true;
+            else if (val == PluginConfigParams::NO)
+                lazyCompilation = false;
+            else
+                IE_THROW() << "Wrong value for property key " << ov::intel_cpu::lazy_compilation.name()
+                           << ". Expected only YES/NO";
+        } else if (key == ov::intel_cpu::parallel_compilation.name()) {
+            if (val == PluginConfigParams::YES)
+                parallelCompilation = true;
+            else if (val == PluginConfigParams::NO)
+                parallelCompilation = false;
+            else
+                IE_THROW() << "Wrong value for property key " << ov::intel_cpu::parallel_compilation.name()
+                           << ". Expected only YES/NO";
+        } else if (key == ov::intel_cpu::continuous_batching.name()) {
+            int val_i = -1;
+            try {
+                val_i = std::stoi(val);
+            } catch (const std::exception&) {
+                IE_THROW() << "Wrong value for property key " << ov::intel_cpu::continuous_batching.name()
+                           << ". Expected only integer numbers";
+            }
+            if (val_i < 0) {
+                IE_THROW() << "Wrong value for property key " << ov::intel_cpu::continuous_batching.name()
+                           << ". The number of the sequences must not be negative";
+            }
+            continuousBatching = static_cast<uint32_t>(val_i);
         } else if (key == ov::hint::execution_mode.name()) {
             if (val == "PERFORMANCE") {
                 executionMode = ov::hint::ExecutionMode::PERFORMANCE;
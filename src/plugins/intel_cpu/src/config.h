@@ -11,10 +11,12 @@
 #include <openvino/util/common_util.hpp>
 #include "utils/debug_caps_config.h"
 #include "openvino/runtime/properties.hpp"
+#include "openvino/runtime/intel_cpu/properties.hpp"
 
 #include <bitset>
 #include <string>
 #include <map>
+#include <vector>
 #include <mutex>
 
 namespace ov {
@@ -41,11 +43,17 @@ struct Config {
     };
 
     bool collectPerfCounters = false;
+    uint32_t perfCountersSamplingRate = 1;
     bool exclusiveAsyncRequests = false;
     SnippetsMode snippetsMode = SnippetsMode::Enable;
+    bool depthFirstTiling = false;
+    size_t depthFirstTilingCacheBudget = 0;
     std::string dumpToDot = {};
     std::string device_id = {};
     float fcSparseWeiDecompressionRate = 1.0f;
+    // sets of the input shapes, for which the dynamic graph is prepared at compile time
+    std::string warmupShapes = {};
+    std::vector<std::map<std::string, ov::PartialShape>> warmupShapeSets;
 #if defined(OPENVINO_ARCH_X86_64)
     size_t rtCacheCapacity = 5000ul;
 #else
@@ -67,8 +75,24 @@ struct Config {
     LPTransformsMode lpTransformsMode = LPTransformsMode::Off;
     bool enforceBF16 = false;
 #endif
+    // Activations are stored in f16 between the nodes which convert them to f32 in registers
+    bool enforceFP16 = false;
     bool inferencePrecisionSetExplicitly = false;
     ov::hint::ExecutionMode executionMode = ov::hint::ExecutionMode::PERFORMANCE;
+    // the inferences of the models with the higher priority get the CPU cores first
+    ov::hint::Priority modelPriority = ov::hint::Priority::MEDIUM;
+    // only the models with the priority set are arbitrated
+    bool modelPrioritySetExplicitly = false;
+    // placement of the big buffers of the weights, the activations and the I/O tensors
+    ov::intel_cpu::HugePages hugePages = ov::intel_cpu::HugePages::DISABLED;
+    bool numaAwareAllocation = false;
+    bool prefaultMemory = false;
+    // the primitives of the nodes are created in the background after the compilation
+    bool lazyCompilation = false;
+    // the primitives of the nodes are created in parallel during the compilation
+    bool parallelCompilation = false;
+    // the maximum number of the sequences of the stateful model executed by one inference, 0 disables the batching
+    uint32_t continuousBatching = 0;
 
     DenormalsOptMode denormalsOptMode = DenormalsOptMode::DO_Keep;
 
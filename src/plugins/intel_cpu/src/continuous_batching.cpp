@@ -0,0 +1,107 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "continuous_batching.h"
+
+#include <algorithm>
+#include <memory>
+#include <sstream>
+#include <utility>
+
+namespace ov {
+namespace intel_cpu {
+
+ContinuousBatching::ContinuousBatching(size_t maxSequences,
+                                       size_t slots,
+                                       InferenceEngine::ITaskExecutor::Ptr executor,
+                                       Step step)
+    : _maxSequences(std::max<size_t>(1, maxSequences)),
+      _executor(std::move(executor)),
+      _step(std::move(step)) {
+    // the first slots are taken first
+    for (size_t slot = std::max<size_t>(1, slots); slot > 0; slot--)
+        _freeSlots.push_back(slot - 1);
+}
+
+void ContinuousBatching::enqueue(InferRequestBase* request, Completion completion) {
+    std::vector<Launch> launches;
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        _queue.push_back({request, std::move(completion)});
+        launches = schedule();
+    }
+    submit(launches);
+}
+
+std::vector<ContinuousBatching::Launch> ContinuousBatching::schedule() {
+    std::vector<Launch> launches;
+    while (!_queue.empty() && !_freeSlots.empty()) {
+        Launch launch;
+        launch.slot = _freeSlots.back();
+        _freeSlots.pop_back();
+        const size_t size = std::min(_queue.size(), _maxSequences);
+        launch.sequences.reserve(size);
+        for (size_t i = 0; i < size; i++) {
+            launch.sequences.push_back(std::move(_queue.front()));
+            _queue.pop_front();
+        }
+        _stats.steps++;
+        _stats.sequences += size;
+        if (size > 1)
+            _stats.batchedSteps++;
+        _stats.maxSequencesPerStep = std::max(_stats.maxSequencesPerStep, size);
+        launches.push_back(std::move(launch));
+    }
+    return launches;
+}
+
+// the executor is called without the lock, since it may execute the step in the current thread
+void ContinuousBatching::submit(std::vector<Launch>& launches) {
+    for (auto& launch : launches) {
+        auto step = std::make_shared<Launch>(std::move(launch));
+        _executor->run([this, step] {
+            execute(*step);
+        });
+    }
+}
+
+void ContinuousBatching::execute(Launch& step) {
+    std::vector<InferRequestBase*> requests;
+    requests.reserve(step.sequences.size());
+    for (const auto& sequence : step.sequences)
+        requests.push_back(sequence.request);
+
+    std::vector<std::exception_ptr> exceptions(requests.size());
+    try {
+        _step(requests, step.slot, exceptions);
+    } catch (...) {
+        std::fill(exceptions.begin(), exceptions.end(), std::current_exception());
+    }
+
+    std::vector<Launch> launches;
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        _freeSlots.push_back(step.slot);
+        launches = schedule();
+    }
+    submit(launches);
+    // the completed requests may release the compiled model, so this object is not used after the completions
+    for (size_t i = 0; i < step.sequences.size(); i++)
+        step.sequences[i].completion(exceptions[i]);
+}
+
+ContinuousBatching::Stats ContinuousBatching::getStats() const {
+    std::lock_guard<std::mutex> lock(_mutex);
+    return _stats;
+}
+
+std::string ContinuousBatching::Stats::toJson() const {
+    std::ostringstream os;
+    os << "{\"steps\":" << steps << ",\"sequences\":" << sequences << ",\"batched_steps\":" << batchedSteps
+       << ",\"max_sequences_per_step\":" << maxSequencesPerStep << "}";
+    return os.str();
+}
+
+}   // namespace intel_cpu
+}   // namespace ov
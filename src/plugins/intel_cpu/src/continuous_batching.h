@@ -0,0 +1,97 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <cstdint>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include <threading/ie_itask_executor.hpp>
+
+namespace ov {
+namespace intel_cpu {
+
+class InferRequestBase;
+
+/**
+ * @brief Gathers the sequences of the concurrent infer requests of a stateful model into the batched steps.
+ * Each infer request runs one sequence and keeps its states, a step executes the current inputs of several sequences
+ * as one inference of the model reshaped to the batch of the sequences, each sequence occupies its own row of the
+ * inputs, the outputs and the states. A step starts as soon as a step slot is free, the sequences, which arrive while
+ * all the slots are busy, are gathered into the next step. So the steps are never delayed to fill the batch, and the
+ * sequences don't wait for each other to finish.
+ */
+class ContinuousBatching {
+public:
+    // completes the inference of the sequence, the exception is null if the step succeeded
+    using Completion = std::function<void(std::exception_ptr)>;
+    /* executes the sequences in the step slot, the only one step is executed in a slot at a time.
+     * The step sets the exceptions of the failed sequences, the exception thrown by the step fails all of them.
+     */
+    using Step = std::function<void(const std::vector<InferRequestBase*>& sequences,
+                                    size_t slot,
+                                    std::vector<std::exception_ptr>& exceptions)>;
+
+    struct Stats {
+        uint64_t steps = 0;
+        uint64_t sequences = 0;
+        // the steps of more than one sequence
+        uint64_t batchedSteps = 0;
+        size_t maxSequencesPerStep = 0;
+
+        std::string toJson() const;
+    };
+
+    /**
+     * @param maxSequences the maximum number of the sequences of a step, i.e. the batch of the reshaped model
+     * @param slots the number of the steps executed at the same time
+     * @param executor runs the steps
+     * @param step executes the sequences
+     */
+    ContinuousBatching(size_t maxSequences,
+                       size_t slots,
+                       InferenceEngine::ITaskExecutor::Ptr executor,
+                       Step step);
+
+    // queues the sequence of the request, the completion is called on the thread of the step
+    void enqueue(InferRequestBase* request, Completion completion);
+
+    size_t maxSequences() const {
+        return _maxSequences;
+    }
+
+    Stats getStats() const;
+
+private:
+    struct Sequence {
+        InferRequestBase* request;
+        Completion completion;
+    };
+    struct Launch {
+        std::vector<Sequence> sequences;
+        size_t slot;
+    };
+
+    // takes the queued sequences into the free slots, must be called under the lock
+    std::vector<Launch> schedule();
+    void submit(std::vector<Launch>& launches);
+    void execute(Launch& step);
+
+    const size_t _maxSequences;
+    const InferenceEngine::ITaskExecutor::Ptr _executor;
+    const Step _step;
+
+    mutable std::mutex _mutex;
+    std::deque<Sequence> _queue;
+    std::vector<size_t> _freeSlots;
+    Stats _stats;
+};
+
+}   // namespace intel_cpu
+}   // namespace ov
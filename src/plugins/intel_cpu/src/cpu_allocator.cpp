@@ -0,0 +1,233 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "cpu_allocator.h"
+
+#include <algorithm>
+#include <mutex>
+#include <sstream>
+#include <unordered_map>
+#include <vector>
+
+#include <common/utils.hpp>
+#include "ie_parallel.hpp"
+
+#ifdef __linux__
+#    include <sys/mman.h>
+#    include <sys/syscall.h>
+#    include <unistd.h>
+#endif
+
+namespace ov {
+namespace intel_cpu {
+
+namespace {
+
+constexpr size_t pageSize = 4096;
+
+size_t roundUp(size_t size, size_t alignment) {
+    return (size + alignment - 1) / alignment * alignment;
+}
+
+AllocationPolicy& threadPolicy() {
+    static thread_local AllocationPolicy policy{ov::intel_cpu::HugePages::DISABLED, -1, false, nullptr};
+    return policy;
+}
+
+// The buffers mapped from the reserved huge pages, they are unmapped instead of being freed
+class HugeTlbMappings {
+public:
+    static HugeTlbMappings& get() {
+        static HugeTlbMappings mappings;
+        return mappings;
+    }
+
+    void add(void* ptr, size_t size) {
+        std::lock_guard<std::mutex> lock{m_mutex};
+        m_sizes[ptr] = size;
+        m_count = m_sizes.size();
+    }
+
+    // returns false if the buffer was not mapped
+    bool remove(void* ptr) {
+        // the mappings are rare, so the usual buffers don't take the lock
+        if (m_count == 0)
+            return false;
+        size_t size = 0;
+        {
+            std::lock_guard<std::mutex> lock{m_mutex};
+            auto found = m_sizes.find(ptr);
+            if (found == m_sizes.end())
+                return false;
+            size = found->second;
+            m_sizes.erase(found);
+            m_count = m_sizes.size();
+        }
+#ifdef __linux__
+        munmap(ptr, size);
+#endif
+        return true;
+    }
+
+private:
+    std::mutex m_mutex;
+    std::unordered_map<void*, size_t> m_sizes;
+    std::atomic<size_t> m_count{0};
+};
+
+#ifdef __linux__
+constexpr size_t gigaPageSize = 1024 * 1024 * 1024;
+
+void* mapHugeTlb(size_t size, size_t& mappedSize) {
+#    ifdef MAP_HUGETLB
+    const int flags = MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB;
+#        ifdef MAP_HUGE_1GB
+    if (size >= gigaPageSize) {
+        mappedSize = roundUp(size, gigaPageSize);
+        void* ptr = mmap(nullptr, mappedSize, PROT_READ | PROT_WRITE, flags | MAP_HUGE_1GB, -1, 0);
+        if (ptr != MAP_FAILED)
+            return ptr;
+    }
+#        endif
+    mappedSize = roundUp(size, CpuAllocator::hugePageSize);
+    void* ptr = mmap(nullptr, mappedSize, PROT_READ | PROT_WRITE, flags, -1, 0);
+    if (ptr != MAP_FAILED)
+        return ptr;
+#    endif
+    return nullptr;
+}
+
+bool bindToNumaNode(void* ptr, size_t size, int numaNodeId) {
+    // mbind is called directly to avoid the dependency on libnuma
+    constexpr int mpolPreferred = 1;
+    constexpr size_t bitsPerLong = sizeof(unsigned long) * 8;
+    std::vector<unsigned long> nodeMask(numaNodeId / bitsPerLong + 1, 0);
+    nodeMask[numaNodeId / bitsPerLong] |= 1ul << (numaNodeId % bitsPerLong);
+    return syscall(SYS_mbind, ptr, size, mpolPreferred, nodeMask.data(), nodeMask.size() * bitsPerLong + 1, 0) == 0;
+}
+#endif
+
+void prefault(void* ptr, size_t size) {
+    auto* data = static_cast<volatile char*>(ptr);
+    const size_t pages = (size + pageSize - 1) / pageSize;
+    // the threads of the stream touch the pages, the binding to the NUMA node is already applied
+    InferenceEngine::parallel_for(pages, [&](size_t page) {
+        data[page * pageSize] = 0;
+    });
+}
+
+}  // namespace
+
+std::string AllocationStats::toJson() const {
+    std::ostringstream os;
+    os << "{\"allocations\":" << allocations << ",\"allocated_bytes\":" << allocatedBytes
+       << ",\"huge_page_bytes\":" << hugePageBytes << ",\"explicit_huge_page_bytes\":" << explicitHugePageBytes
+       << ",\"huge_page_fallbacks\":" << hugePageFallbacks << ",\"numa_bound_bytes\":" << numaBoundBytes
+       << ",\"prefaulted_bytes\":" << prefaultedBytes << "}";
+    return os.str();
+}
+
+void* CpuAllocator::allocate(size_t size, size_t alignment) {
+    return allocate(size, alignment, currentPolicy());
+}
+
+void* CpuAllocator::allocate(size_t size, size_t alignment, const AllocationPolicy& policy) {
+    auto* stats = policy.stats;
+    const bool usePolicy = size >= hugePageSize && (policy.hugePages != ov::intel_cpu::HugePages::DISABLED ||
+                                                    policy.numaNodeId >= 0 || policy.prefault);
+    if (!usePolicy) {
+        void* ptr = dnnl::impl::malloc(size, static_cast<int>(alignment));
+        if (ptr && stats) {
+            stats->allocations++;
+            stats->allocatedBytes += size;
+        }
+        return ptr;
+    }
+
+    void* ptr = nullptr;
+    size_t allocatedSize = size;
+    bool isHugePage = false;
+#ifdef __linux__
+    if (policy.hugePages == ov::intel_cpu::HugePages::EXPLICIT_HUGE_PAGES) {
+        ptr = mapHugeTlb(size, allocatedSize);
+        if (ptr) {
+            HugeTlbMappings::get().add(ptr, allocatedSize);
+            isHugePage = true;
+            if (stats)
+                stats->explicitHugePageBytes += allocatedSize;
+        } else if (stats) {
+            stats->hugePageFallbacks++;
+        }
+    }
+#endif
+    if (!ptr) {
+        // the binding and the advice are applied to the whole pages
+        const size_t pageAlignment =
+            policy.hugePages != ov::intel_cpu::HugePages::DISABLED ? hugePageSize : pageSize;
+        allocatedSize = roundUp(size, pageAlignment);
+        ptr = dnnl::impl::malloc(allocatedSize, static_cast<int>(std::max(alignment, pageAlignment)));
+        if (!ptr)
+            return nullptr;
+#if defined(__linux__) && defined(MADV_HUGEPAGE)
+        if (policy.hugePages != ov::intel_cpu::HugePages::DISABLED)
+            isHugePage = madvise(ptr, allocatedSize, MADV_HUGEPAGE) == 0;
+#endif
+    }
+
+    bool isBound = false;
+#ifdef __linux__
+    if (policy.numaNodeId >= 0)
+        isBound = bindToNumaNode(ptr, allocatedSize, policy.numaNodeId);
+#endif
+    if (policy.prefault)
+        prefault(ptr, allocatedSize);
+
+    if (stats) {
+        stats->allocations++;
+        stats->allocatedBytes += allocatedSize;
+        if (isHugePage)
+            stats->hugePageBytes += allocatedSize;
+        if (isBound)
+            stats->numaBoundBytes += allocatedSize;
+        if (policy.prefault)
+            stats->prefaultedBytes += allocatedSize;
+    }
+    return ptr;
+}
+
+void CpuAllocator::free(void* ptr) {
+    if (ptr == nullptr)
+        return;
+    if (!HugeTlbMappings::get().remove(ptr))
+        dnnl::impl::free(ptr);
+}
+
+const AllocationPolicy& CpuAllocator::currentPolicy() {
+    return threadPolicy();
+}
+
+CpuAllocator::PolicyScope::PolicyScope(const AllocationPolicy& policy) : m_previous(threadPolicy()) {
+    threadPolicy() = policy;
+}
+
+CpuAllocator::PolicyScope::~PolicyScope() {
+    threadPolicy() = m_previous;
+}
+
+void* CpuBlobAllocator::alloc(size_t size) noexcept {
+    try {
+        constexpr size_t cacheLineSize = 64;
+        return CpuAllocator::allocate(size, cacheLineSize, m_policy);
+    } catch (...) {
+        return nullptr;
+    }
+}
+
+bool CpuBlobAllocator::free(void* handle) noexcept {
+    CpuAllocator::free(handle);
+    return true;
+}
+
+}  // namespace intel_cpu
+}  // namespace ov
@@ -0,0 +1,102 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+#include <ie_allocator.hpp>
+#include "openvino/runtime/intel_cpu/properties.hpp"
+
+namespace ov {
+namespace intel_cpu {
+
+/**
+ * @brief Statistics of the memory allocations of a compiled model
+ */
+struct AllocationStats {
+    std::atomic<uint64_t> allocations{0};
+    std::atomic<uint64_t> allocatedBytes{0};
+    // the buffers advised for the transparent huge pages or mapped from the reserved ones
+    std::atomic<uint64_t> hugePageBytes{0};
+    std::atomic<uint64_t> explicitHugePageBytes{0};
+    // the reserved huge pages were requested, but the transparent ones were used
+    std::atomic<uint64_t> hugePageFallbacks{0};
+    std::atomic<uint64_t> numaBoundBytes{0};
+    std::atomic<uint64_t> prefaultedBytes{0};
+
+    std::string toJson() const;
+};
+
+/**
+ * @brief Placement of the memory buffers
+ */
+struct AllocationPolicy {
+    ov::intel_cpu::HugePages hugePages;
+    // the NUMA node the pages are bound to, -1 if the pages are placed on the first touch
+    int numaNodeId;
+    // commit the pages at the allocation
+    bool prefault;
+    // may be nullptr
+    AllocationStats* stats;
+};
+
+/**
+ * @brief The allocator of the weights, the activations and the I/O tensors.
+ * The small buffers are allocated as usual, the policy is applied to the buffers of the huge page size and bigger.
+ * The policy is set for the thread, so the memory allocated by a stream during the graph creation and the inference
+ * is placed according to the policy of the compiled model and the NUMA node of the stream.
+ */
+class CpuAllocator {
+public:
+    static constexpr size_t hugePageSize = 2 * 1024 * 1024;
+
+    /**
+     * @brief Allocates the buffer according to the policy of the current thread
+     * @return nullptr if the allocation failed
+     */
+    static void* allocate(size_t size, size_t alignment);
+    static void* allocate(size_t size, size_t alignment, const AllocationPolicy& policy);
+    static void free(void* ptr);
+
+    static const AllocationPolicy& currentPolicy();
+
+    /**
+     * @brief Sets the policy of the current thread for the lifetime of the scope
+     */
+    class PolicyScope {
+    public:
+        explicit PolicyScope(const AllocationPolicy& policy);
+        ~PolicyScope();
+        PolicyScope(const PolicyScope&) = delete;
+        PolicyScope& operator=(const PolicyScope&) = delete;
+
+    private:
+        AllocationPolicy m_previous;
+    };
+};
+
+/**
+ * @brief The allocator of the I/O blobs of the infer requests
+ */
+class CpuBlobAllocator : public InferenceEngine::IAllocator {
+public:
+    explicit CpuBlobAllocator(const AllocationPolicy& policy) : m_policy(policy) {}
+
+    void* lock(void* handle, InferenceEngine::LockOp = InferenceEngine::LOCK_FOR_WRITE) noexcept override {
+        return handle;
+    }
+    void unlock(void*) noexcept override {}
+    void* alloc(size_t size) noexcept override;
+    bool free(void* handle) noexcept override;
+
+private:
+    const AllocationPolicy m_policy;
+};
+
+}  // namespace intel_cpu
+}  // namespace ov
@@ -10,6 +10,7 @@
 #include <dnnl_types.h>
 #include <common/memory_desc_wrapper.hpp>
 #include "cpu_memory.h"
+#include "cpu_allocator.h"
 #include "nodes/common/cpu_memcpy.h"
 #include "nodes/common/cpu_convert.h"
 #include "onednn/dnnl.h"
@@ -204,7 +205,7 @@ bool MemoryMngrWithReuse::resize(size_t size) {
     constexpr int cacheLineSize = 64;
     bool sizeChanged = false;
     if (size > _memUpperBound) {
-        void *ptr = dnnl::impl::malloc(size, cacheLineSize);
+        void *ptr = CpuAllocator::allocate(size, cacheLineSize);
         if (!ptr) {
             IE_THROW() << "Failed to allocate " << size << " bytes of memory";
         }
@@ -223,7 +224,57 @@ bool MemoryMngrWithReuse::hasExtBuffer() const noexcept {
 void MemoryMngrWithReuse::release(void *ptr) {}
 
 void MemoryMngrWithReuse::destroy(void *ptr) {
-    dnnl::impl::free(ptr);
+    CpuAllocator::free(ptr);
+}
+
+void* MemoryArena::getRawPtr() {
+    constexpr int pageSize = 4096;
+    if (!_data && !_allocationFailed && _size != 0) {
+        // the pages of the arena are committed by the actual shapes, so they are not prefaulted
+        auto policy = CpuAllocator::currentPolicy();
+        policy.prefault = false;
+        void *ptr = CpuAllocator::allocate(_size, pageSize, policy);
+        if (ptr) {
+            _data = decltype(_data)(ptr, destroy);
+        } else {
+            _allocationFailed = true;
+        }
+    }
+    return _data.get();
+}
+
+void MemoryArena::release(void *ptr) {}
+
+void MemoryArena::destroy(void *ptr) {
+    CpuAllocator::free(ptr);
+}
+
+void* MemoryMngrInArena::getRawPtr() const noexcept {
+    return _useFallback ? _fallback.getRawPtr() : _data;
+}
+
+void MemoryMngrInArena::setExtBuff(void *ptr, size_t size) {
+    _useFallback = true;
+    _fallback.setExtBuff(ptr, size);
+}
+
+bool MemoryMngrInArena::resize(size_t size) {
+    if (!_useFallback && size <= _size) {
+        if (_data)
+            return false;
+        if (auto arenaPtr = static_cast<uint8_t*>(_arena->getRawPtr())) {
+            _data = arenaPtr + _offset;
+            return true;
+        }
+    }
+    // the region can't hold the data, so the own buffer is used from now on
+    const bool switched = !_useFallback;
+    _useFallback = true;
+    return _fallback.resize(size) || switched;
+}
+
+bool MemoryMngrInArena::hasExtBuffer() const noexcept {
+    return _useFallback && _fallback.hasExtBuffer();
 }
 
 void* DnnlMemoryMngr::getRawPtr() const noexcept {
@@ -231,11 +282,13 @@ void* DnnlMemoryMngr::getRawPtr() const noexcept {
 }
 
 void DnnlMemoryMngr::setExtBuff(void *ptr, size_t size) {
+    std::lock_guard<std::mutex> lock(_mutex);
     _pMemMngr->setExtBuff(ptr, size);
     notifyUpdate();
 }
 
 bool DnnlMemoryMngr::resize(size_t size) {
+    std::lock_guard<std::mutex> lock(_mutex);
     bool sizeChanged = _pMemMngr->resize(size);
     if (sizeChanged) {
         notifyUpdate();
@@ -249,12 +302,14 @@ bool DnnlMemoryMngr::hasExtBuffer() const noexcept {
 
 void DnnlMemoryMngr::registerMemory(Memory* memPtr) {
     if (memPtr) {
+        std::lock_guard<std::mutex> lock(_mutex);
         _setMemPtrs.insert(memPtr);
     }
 }
 
 void DnnlMemoryMngr::unregisterMemory(Memory* memPtr) {
     if (memPtr) {
+        std::lock_guard<std::mutex> lock(_mutex);
         _setMemPtrs.erase(memPtr);
     }
 }
@@ -16,6 +16,7 @@
 #include <string>
 #include <functional>
 #include <memory>
+#include <mutex>
 #include <vector>
 #include <ie_precision.hpp>
 
@@ -89,6 +90,53 @@ private:
     static void destroy(void *ptr);
 };
 
+/**
+ * @brief A buffer shared by the edges with dynamic but bounded shapes. Each edge owns a region of the buffer,
+ * which is planned by the memory solver for the upper bounds of the shapes, so the regions of the edges
+ * with overlapping lifetimes never intersect. The buffer is allocated once on the first request and is never moved.
+ * Since the OS commits the pages of a big allocation on the first touch, the resident memory follows the actual shapes.
+ */
+class MemoryArena {
+public:
+    explicit MemoryArena(size_t size) : _size(size), _data(nullptr, release) {}
+
+    /**
+     * @brief Allocates the buffer if needed
+     * @return A pointer to the buffer or nullptr if the allocation failed
+     */
+    void* getRawPtr();
+
+private:
+    size_t _size;
+    bool _allocationFailed = false;
+    std::unique_ptr<void, void (*)(void *)> _data;
+
+    static void release(void *ptr);
+    static void destroy(void *ptr);
+};
+
+/**
+ * @brief An implementation of the mem manager which provides a fixed region of a memory arena.
+ * Falls back to the own buffer if the requested size exceeds the region or the arena can't be allocated.
+ */
+class MemoryMngrInArena : public IMemoryMngr {
+public:
+    MemoryMngrInArena(std::shared_ptr<MemoryArena> arena, size_t offset, size_t size)
+        : _arena(std::move(arena)), _offset(offset), _size(size) {}
+    void* getRawPtr() const noexcept override;
+    void setExtBuff(void* ptr, size_t size) override;
+    bool resize(size_t size) override;
+    bool hasExtBuffer() const noexcept override;
+
+private:
+    std::shared_ptr<MemoryArena> _arena;
+    size_t _offset;
+    size_t _size;
+    void* _data = nullptr;
+    bool _useFallback = false;
+    MemoryMngrWithReuse _fallback;
+};
+
 /**
  * @brief A proxy object that additionally implements observer pattern
  */
@@ -106,6 +154,8 @@ private:
     void notifyUpdate();
 
 private:
+    // the memory objects sharing the manager may be created and destroyed concurrently, e.g. the scratchpad ones
+    std::mutex _mutex;
     std::unordered_set<Memory*> _setMemPtrs;
     std::unique_ptr<IMemoryMngr> _pMemMngr;
 };
@@ -0,0 +1,172 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "cpu_resource_manager.hpp"
+
+#include <algorithm>
+#include <iomanip>
+#include <sstream>
+#include <thread>
+
+namespace ov {
+namespace intel_cpu {
+
+namespace {
+bool isHigher(ov::hint::Priority lhs, ov::hint::Priority rhs) {
+    return static_cast<int>(lhs) > static_cast<int>(rhs);
+}
+
+// the streams, which are not pinned, may run on any processor
+bool overlap(const CpuResourceManager::Cores& lhs, const CpuResourceManager::Cores& rhs) {
+    if (lhs.cpuIds.empty() || rhs.cpuIds.empty())
+        return true;
+    return std::any_of(lhs.cpuIds.begin(), lhs.cpuIds.end(), [&](int id) {
+        return std::find(rhs.cpuIds.begin(), rhs.cpuIds.end(), id) != rhs.cpuIds.end();
+    });
+}
+
+uint64_t toNs(CpuResourceManager::Clock::duration duration) {
+    return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(duration).count());
+}
+}  // namespace
+
+CpuResourceManager::Client::Client(ov::hint::Priority priority, bool arbitrated)
+    : m_priority(priority),
+      m_arbitrated(arbitrated),
+      m_registered(Clock::now()) {}
+
+std::string CpuResourceManager::Client::usageReport(int capacity) const {
+    const auto elapsedNs = toNs(Clock::now() - m_registered);
+    const auto busyCoreNs = m_busyCoreNs.load();
+    const double utilization =
+        elapsedNs > 0 && capacity > 0 ? static_cast<double>(busyCoreNs) / (static_cast<double>(elapsedNs) * capacity)
+                                      : 0.0;
+    std::ostringstream os;
+    os << std::fixed << std::setprecision(3) << "{\"priority\":\"" << m_priority << "\""
+       << ",\"inferences\":" << m_inferences << ",\"waited_inferences\":" << m_waitedInferences
+       << ",\"wait_ms\":" << m_waitNs / 1e6 << ",\"max_wait_ms\":" << m_maxWaitNs / 1e6
+       << ",\"busy_core_ms\":" << busyCoreNs / 1e6 << ",\"utilization\":" << utilization << "}";
+    return os.str();
+}
+
+CpuResourceManager::Lease::Lease(CpuResourceManager* manager, Client* client, const Cores* cores, bool reserved)
+    : m_manager(manager),
+      m_client(client),
+      m_cores(cores),
+      m_start(Clock::now()),
+      m_reserved(reserved) {}
+
+CpuResourceManager::Lease::Lease(Lease&& other) noexcept
+    : m_manager(other.m_manager),
+      m_client(other.m_client),
+      m_cores(other.m_cores),
+      m_start(other.m_start),
+      m_reserved(other.m_reserved) {
+    other.m_manager = nullptr;
+}
+
+CpuResourceManager::Lease& CpuResourceManager::Lease::operator=(Lease&& other) noexcept {
+    if (this != &other) {
+        release();
+        m_manager = other.m_manager;
+        m_client = other.m_client;
+        m_cores = other.m_cores;
+        m_start = other.m_start;
+        m_reserved = other.m_reserved;
+        other.m_manager = nullptr;
+    }
+    return *this;
+}
+
+CpuResourceManager::Lease::~Lease() {
+    release();
+}
+
+void CpuResourceManager::Lease::release() {
+    if (m_manager == nullptr)
+        return;
+    m_client->m_busyCoreNs += toNs(Clock::now() - m_start) * static_cast<uint64_t>(std::max(1, m_cores->threads));
+    if (m_reserved)
+        m_manager->release(*m_cores);
+    m_manager = nullptr;
+}
+
+CpuResourceManager::CpuResourceManager(int numCpus, int capacity)
+    : m_capacity(std::max(1, capacity)),
+      m_busyCpus(static_cast<size_t>(std::max(0, numCpus)), false) {}
+
+CpuResourceManager& CpuResourceManager::get() {
+    // the streams run as many threads as the logical processors, e.g. with the hyper-threading
+    static CpuResourceManager manager(static_cast<int>(std::thread::hardware_concurrency()),
+                                      static_cast<int>(std::thread::hardware_concurrency()));
+    return manager;
+}
+
+bool CpuResourceManager::isAvailable(const Cores& cores) const {
+    // nothing is running, so even the request exceeding the capacity is granted
+    if (m_busyThreads == 0)
+        return true;
+    if (cores.cpuIds.empty())
+        return m_busyThreads + cores.threads <= m_capacity;
+    return std::none_of(cores.cpuIds.begin(), cores.cpuIds.end(), [&](int id) {
+        return id >= 0 && static_cast<size_t>(id) < m_busyCpus.size() && m_busyCpus[id];
+    });
+}
+
+bool CpuResourceManager::isPreempted(const Request& request) const {
+    return std::any_of(m_waiting.begin(), m_waiting.end(), [&](const Request& waiting) {
+        return isHigher(waiting.priority, request.priority) && overlap(*waiting.cores, *request.cores);
+    });
+}
+
+CpuResourceManager::Lease CpuResourceManager::acquire(Client& client, const Cores& cores) {
+    client.m_inferences++;
+    // the models without the priority are not serialized by the lock and are not accounted as busy
+    if (!client.m_arbitrated)
+        return Lease(this, &client, &cores, false);
+    std::unique_lock<std::mutex> lock{m_mutex};
+    const Request request{&cores, client.m_priority};
+    if (!isAvailable(cores) || isPreempted(request)) {
+        const auto start = Clock::now();
+        auto waiting = m_waiting.insert(m_waiting.end(), request);
+        m_cv.wait(lock, [&] {
+            return isAvailable(cores) && !isPreempted(request);
+        });
+        m_waiting.erase(waiting);
+        // the lower priority requests might be preempted by this one
+        m_cv.notify_all();
+
+        const auto waitNs = toNs(Clock::now() - start);
+        client.m_waitedInferences++;
+        client.m_waitNs += waitNs;
+        auto maxWaitNs = client.m_maxWaitNs.load();
+        while (maxWaitNs < waitNs && !client.m_maxWaitNs.compare_exchange_weak(maxWaitNs, waitNs)) {
+        }
+    }
+
+    m_busyThreads += cores.threads;
+    for (const auto id : cores.cpuIds) {
+        if (id < 0)
+            continue;
+        if (static_cast<size_t>(id) >= m_busyCpus.size())
+            m_busyCpus.resize(id + 1, false);
+        m_busyCpus[id] = true;
+    }
+    return Lease(this, &client, &cores, true);
+}
+
+void CpuResourceManager::release(const Cores& cores) {
+    {
+        std::lock_guard<std::mutex> lock{m_mutex};
+        m_busyThreads -= cores.threads;
+        for (const auto id : cores.cpuIds) {
+            if (id >= 0 && static_cast<size_t>(id) < m_busyCpus.size())
+                m_busyCpus[id] = false;
+        }
+    }
+    m_cv.notify_all();
+}
+
+}  // namespace intel_cpu
+}  // namespace ov
@@ -0,0 +1,140 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+/**
+ * @brief A header file for the arbitration of the CPU cores between the compiled models
+ * @file cpu_resource_manager.hpp
+ */
+
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include "openvino/runtime/properties.hpp"
+
+namespace ov {
+namespace intel_cpu {
+
+/**
+ * Process level arbiter of the CPU cores shared by the compiled models, which set ov::hint::model_priority.
+ * Every compiled model sizes its streams as if it owns the whole CPU, so the inferences of the co-located models
+ * would oversubscribe the cores. Instead each inference of an arbitrated model leases the cores of its stream for its
+ * duration: the inference, which needs the cores busy with another arbitrated inference, waits for them.
+ * The models with the higher priority preempt the lower ones at the inference boundaries:
+ * while a higher priority inference waits for the cores, the lower priority inferences don't get them.
+ * The streams keep their threads, so an inference runs on the cores of its stream only, the idle cores of the other
+ * models are not added to it.
+ * The models, which don't set the priority, are not arbitrated, their leases only collect the usage statistics.
+ */
+class CpuResourceManager {
+public:
+    using Clock = std::chrono::steady_clock;
+
+    // The cores used by the inference of a stream
+    struct Cores {
+        // the processors the stream is pinned to, empty if the stream is not pinned
+        std::vector<int> cpuIds;
+        int threads;
+    };
+
+    // The compiled model, which accumulates the usage statistics of the model
+    class Client {
+    public:
+        /**
+         * @param arbitrated the inferences of the client are admitted by the arbitration, otherwise they are
+         *        started at once
+         */
+        Client(ov::hint::Priority priority, bool arbitrated);
+        Client(const Client&) = delete;
+        Client& operator=(const Client&) = delete;
+
+        ov::hint::Priority priority() const {
+            return m_priority;
+        }
+
+        // JSON with the number of the inferences, the time spent waiting for the cores and the utilization of the CPU
+        std::string usageReport(int capacity) const;
+
+    private:
+        friend class CpuResourceManager;
+        const ov::hint::Priority m_priority;
+        const bool m_arbitrated;
+        const Clock::time_point m_registered;
+        std::atomic<uint64_t> m_inferences{0};
+        std::atomic<uint64_t> m_waitedInferences{0};
+        std::atomic<uint64_t> m_waitNs{0};
+        std::atomic<uint64_t> m_maxWaitNs{0};
+        // sum of the inference durations multiplied by the number of the threads
+        std::atomic<uint64_t> m_busyCoreNs{0};
+    };
+
+    // The cores granted to the inference, they are returned when the lease is destroyed
+    class Lease {
+    public:
+        Lease() = default;
+        Lease(Lease&& other) noexcept;
+        Lease& operator=(Lease&& other) noexcept;
+        Lease(const Lease&) = delete;
+        Lease& operator=(const Lease&) = delete;
+        ~Lease();
+
+    private:
+        friend class CpuResourceManager;
+        Lease(CpuResourceManager* manager, Client* client, const Cores* cores, bool reserved);
+        void release();
+
+        CpuResourceManager* m_manager = nullptr;
+        Client* m_client = nullptr;
+        const Cores* m_cores = nullptr;
+        Clock::time_point m_start;
+        // the cores are accounted as busy, i.e. the lease was granted by the arbitration
+        bool m_reserved = false;
+    };
+
+    /**
+     * @param numCpus number of the processors, the pinned streams are arbitrated by the processor ids
+     * @param capacity number of the threads, which can be run at once by the streams, which are not pinned,
+     *        i.e. the number of the logical processors
+     */
+    CpuResourceManager(int numCpus, int capacity);
+
+    static CpuResourceManager& get();
+
+    /**
+     * @brief Blocks until the cores are available for the client, doesn't block if the client isn't arbitrated
+     * @param cores must outlive the lease
+     */
+    Lease acquire(Client& client, const Cores& cores);
+
+    int capacity() const {
+        return m_capacity;
+    }
+
+private:
+    struct Request {
+        const Cores* cores;
+        ov::hint::Priority priority;
+    };
+
+    bool isAvailable(const Cores& cores) const;
+    bool isPreempted(const Request& request) const;
+    void release(const Cores& cores);
+
+    const int m_capacity;
+    std::mutex m_mutex;
+    std::condition_variable m_cv;
+    std::vector<bool> m_busyCpus;
+    int m_busyThreads = 0;
+    std::list<Request> m_waiting;
+};
+
+}  // namespace intel_cpu
+}  // namespace ov
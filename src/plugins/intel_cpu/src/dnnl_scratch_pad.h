@@ -5,6 +5,7 @@
 #pragma once
 
 #include <memory>
+#include <mutex>
 
 #include "common/memory.hpp"
 #include "cpu_memory.h"
@@ -16,6 +17,10 @@ namespace intel_cpu {
 class DnnlScratchPad {
     DnnlMemoryMngrPtr mgrPtr;
     dnnl::engine eng;
+    // The nodes may create their primitives in parallel. A resize of the shared manager rebinds the oneDNN memories
+    // of all the scratchpads, so the scratchpad memories are created, bound and destroyed under the lock.
+    // The lock is shared with the deleters, since a memory may outlive the scratchpad.
+    std::shared_ptr<std::mutex> mutex = std::make_shared<std::mutex>();
 
 public:
     DnnlScratchPad(dnnl::engine eng) : eng(eng) {
@@ -23,8 +28,17 @@ public:
     }
 
     MemoryPtr createScratchPadMem(const MemoryDescPtr& md) {
-        auto mem = std::make_shared<Memory>(eng);
+        auto lockPtr = mutex;
+        MemoryPtr mem(new Memory(eng), [lockPtr](Memory* memPtr) {
+            std::lock_guard<std::mutex> lock(*lockPtr);
+            delete memPtr;
+        });
+        // released before the memory if the creation fails
+        std::lock_guard<std::mutex> lock(*mutex);
         mem->Create(md, mgrPtr);
+        // the oneDNN memory reads the buffer pointer when it is created, so it is created here rather than by the
+        // node, which may run while another node resizes the buffer
+        mem->GetPrimitive();
         return mem;
     }
 };
@@ -146,6 +146,9 @@ void jit_load_emitter::emit_isa(const Xbyak::Reg64 &reg_src, const int out_vec_i
             case Precision::BF16:
                 load_words_to_dword_extension<Vmm>(Vmm(out_vec_idx), reg_src, offset, true, false, load_size_);
                 break;
+            case Precision::FP16:
+                load_halfs_to_dword_extension<Vmm>(Vmm(out_vec_idx), reg_src, offset, load_size_);
+                break;
             default:
                 IE_THROW() << "Load emitter in " << name_ << " has unsupported src precision to load.";
         }
@@ -155,11 +158,11 @@ void jit_load_emitter::emit_isa(const Xbyak::Reg64 &reg_src, const int out_vec_i
     if (src_prc_ != dst_prc_) {
         switch (dst_prc_) {
             case Precision::FP32:
-                if ((src_prc_ != Precision::FP32) && (src_prc_ != Precision::BF16))
+                if (!one_of(src_prc_, Precision::FP32, Precision::BF16, Precision::FP16))
                     h->uni_vcvtdq2ps(Vmm(out_vec_idx), Vmm(out_vec_idx));
                 break;
             case Precision::I32:
-                if ((src_prc_ == Precision::FP32) || (src_prc_ == Precision::BF16)) {
+                if (one_of(src_prc_, Precision::FP32, Precision::BF16, Precision::FP16)) {
                     h->uni_vcvtps2dq(Vmm(out_vec_idx), Vmm(out_vec_idx));
                 }
                 break;
@@ -542,6 +545,34 @@ void jit_load_emitter::load_words_to_dword_extension(const Vmm &vmm, const Xbyak
     }
 }
 
+/**
+* load_halfs_to_dword_extension is the utility function to facilitate
+* loading of load_size (0 <= load_size <= 32) many contiguous bytes of FP16 values
+* into the Ymm/Zmm register from the memory referenced by ptr[reg + offset] address
+* and converting them to FP32 with the F16C instruction.
+*
+* The values are loaded into the lower half of the register first, so the
+* function shares the partial load logic of load_bytes.
+*/
+template <typename Vmm>
+void jit_load_emitter::load_halfs_to_dword_extension(const Vmm &vmm, const Xbyak::Reg64 &reg, int offset, int load_size) const {
+    constexpr bool is_xmm = std::is_same<Vmm, Xbyak::Xmm>::value;
+    constexpr bool is_zmm = std::is_same<Vmm, Xbyak::Zmm>::value;
+
+    if (is_xmm)
+        IE_THROW() << "Load emitter in " << name_ << " doesn't support FP16 precision on sse41.";
+    if (load_size < 0 || load_size > (is_zmm ? 32 : 16))
+        IE_THROW() << "Load emitter in " << name_ << " has unexpected number of values to load in load_halfs_to_dword_extension.";
+
+    if (is_zmm) {
+        load_bytes<Xbyak::Ymm>(Xbyak::Ymm(vmm.getIdx()), reg, offset, load_size);
+        h->vcvtph2ps(Xbyak::Zmm(vmm.getIdx()), Xbyak::Ymm(vmm.getIdx()));
+    } else {
+        load_bytes<Xbyak::Xmm>(Xbyak::Xmm(vmm.getIdx()), reg, offset, load_size);
+        h->vcvtph2ps(vmm, Xbyak::Xmm(vmm.getIdx()));
+    }
+}
+
 template <typename Vmm>
 void jit_load_emitter::fill_with_default(const Vmm &vmm, std::string fill_value, const int &load_num) const {
     constexpr bool is_xmm = std::is_same<Vmm, Xbyak::Xmm>::value;
@@ -665,7 +696,7 @@ void jit_store_emitter::emit_isa(const int in_vec_idx, const Xbyak::Reg64 &reg_d
     if (src_prc_ != dst_prc_) {
         switch (src_prc_) {
             case Precision::FP32:
-                if ((dst_prc_ != Precision::FP32) && (dst_prc_ != Precision::BF16)) {
+                if (!one_of(dst_prc_, Precision::FP32, Precision::BF16, Precision::FP16)) {
                     if (is_saturation()) {
                         h->uni_vcvtps2dq(Vmm(aux_src_idx), Vmm(data_idx));
                     } else {
@@ -676,7 +707,7 @@ void jit_store_emitter::emit_isa(const int in_vec_idx, const Xbyak::Reg64 &reg_d
                 }
                 break;
             case Precision::I32:
-                if ((dst_prc_ == Precision::FP32) || (dst_prc_ == Precision::BF16)) {
+                if (one_of(dst_prc_, Precision::FP32, Precision::BF16, Precision::FP16)) {
                     h->uni_vcvtdq2ps(Vmm(aux_src_idx), Vmm(data_idx));
                     data_idx = aux_src_idx;
                     data_reg_updated = true;
@@ -710,6 +741,9 @@ void jit_store_emitter::emit_isa(const int in_vec_idx, const Xbyak::Reg64 &reg_d
             case Precision::BF16:
                 store_dword_to_word_extension<Vmm>(reg_dst, offset, true, false, store_num_);
                 break;
+            case Precision::FP16:
+                store_dword_to_half_extension<Vmm>(reg_dst, offset, store_num_);
+                break;
             default:
                 IE_THROW() << "Store emitter in " << name_ << " has unsupported dst precision to store.";
         }
@@ -1213,6 +1247,35 @@ void jit_store_emitter::store_dword_to_word_extension(const Xbyak::Reg64 &reg,
     }
 }
 
+/**
+* store_dword_to_half_extension is the utility function to
+* 1. convert store_num (0 <= store_num <= 16) FP32 values in the Ymm/Zmm to FP16 with the F16C instruction.
+* 2. store the packed halfs into the memory referenced by ptr[reg + offset] address.
+*/
+template <typename Vmm>
+void jit_store_emitter::store_dword_to_half_extension(const Xbyak::Reg64 &reg, int offset, int store_num) const {
+    constexpr bool is_xmm = std::is_same<Vmm, Xbyak::Xmm>::value;
+    constexpr bool is_zmm = std::is_same<Vmm, Xbyak::Zmm>::value;
+
+    if (is_xmm)
+        IE_THROW() << "Store emitter in " << name_ << " doesn't support FP16 precision on sse41.";
+    if (store_num < 0 || store_num > (is_zmm ? 16 : 8))
+        IE_THROW() << "Store emitter in " << name_ << " has unexpected number of values to store in store_dword_to_half_extension.";
+
+    // round to nearest even, the result is written to the auxiliary register to keep the source unchanged
+    if (is_zmm) {
+        h->vcvtps2ph(Xbyak::Ymm(aux_src_idx), Xbyak::Zmm(data_idx), 0x4);
+        data_idx = aux_src_idx;
+        data_reg_updated = true;
+        store_bytes<Xbyak::Ymm>(reg, offset, store_num * 2);
+    } else {
+        h->vcvtps2ph(Xbyak::Xmm(aux_src_idx), Xbyak::Ymm(data_idx), 0x4);
+        data_idx = aux_src_idx;
+        data_reg_updated = true;
+        store_bytes<Xbyak::Xmm>(reg, offset, store_num * 2);
+    }
+}
+
 void jit_store_emitter::register_table_entries() {
     if (is_truncation_emulation()) {
         push_arg_entry_of("mask_truncation_byte", 0x000000ff, true);
@@ -84,6 +84,9 @@ private:
     template <typename Vmm>
     void load_words_to_dword_extension(const Vmm &vmm, const Xbyak::Reg64 &reg, int offset, bool is_bf16, bool is_signed, int load_size) const;
 
+    template <typename Vmm>
+    void load_halfs_to_dword_extension(const Vmm &vmm, const Xbyak::Reg64 &reg, int offset, int load_size) const;
+
     template <typename Vmm>
     void fill_with_default(const Vmm &vmm, std::string fill_value, const int &load_num) const;
 
@@ -147,6 +150,9 @@ private:
     template <typename Vmm>
     void store_dword_to_word_extension(const Xbyak::Reg64 &reg, int offset, bool is_bf16, bool is_signed, int store_size) const;
 
+    template <typename Vmm>
+    void store_dword_to_half_extension(const Xbyak::Reg64 &reg, int offset, int store_size) const;
+
     void register_table_entries() override;
 
     size_t aux_gprs_count() const override;
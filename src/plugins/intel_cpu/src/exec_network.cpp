@@ -13,6 +13,7 @@
 #include "itt.h"
 #include "openvino/runtime/intel_cpu/properties.hpp"
 #include "serialize.h"
+#include "cpu_streams_calculation.hpp"
 #include "ngraph/type/element_type.hpp"
 #include "nodes/memory.hpp"
 #include <threading/ie_executor_manager.hpp>
@@ -21,6 +22,7 @@
 #include <threading/ie_tbb_streams_executor.hpp>
 #endif
 #include <threading/ie_cpu_streams_executor.hpp>
+#include <threading/ie_cpu_streams_info.hpp>
 #include <ie_system_conf.h>
 #include <ngraph/opsets/opset1.hpp>
 #include <transformations/utils/utils.hpp>
@@ -31,6 +33,10 @@
 #include "openvino/util/common_util.hpp"
 
 #include <algorithm>
+#include <condition_variable>
+#include <iomanip>
+#include <sstream>
+#include <thread>
 #include <unordered_set>
 #include <utility>
 #include <cstring>
@@ -63,15 +69,135 @@ struct ImmediateSerialExecutor : public ITaskExecutor {
     std::mutex _mutex;
 };
 
+class ExecNetwork::ReconfigurableStreamsExecutor : public InferenceEngine::IStreamsExecutor {
+public:
+    explicit ReconfigurableStreamsExecutor(IStreamsExecutor::Ptr executor) : _state{std::make_shared<State>()} {
+        _state->executor = std::move(executor);
+    }
+
+    void run(InferenceEngine::Task task) override {
+        std::unique_lock<std::mutex> lock{_state->mutex};
+        if (_state->paused) {
+            _state->pending.push_back(std::move(task));
+            return;
+        }
+        auto executor = _state->executor;
+        _state->inFlight++;
+        lock.unlock();
+        submit(_state, executor, std::move(task));
+    }
+
+    void Execute(InferenceEngine::Task task) override {
+        std::unique_lock<std::mutex> lock{_state->mutex};
+        _state->cv.wait(lock, [&] {
+            return !_state->paused;
+        });
+        auto executor = _state->executor;
+        _state->inFlight++;
+        lock.unlock();
+        InFlightTask inFlightTask{_state};
+        executor->Execute(std::move(task));
+    }
+
+    int GetStreamId() override {
+        return current()->GetStreamId();
+    }
+
+    int GetNumaNodeId() override {
+        return current()->GetNumaNodeId();
+    }
+
+    IStreamsExecutor::Ptr current() const {
+        std::lock_guard<std::mutex> lock{_state->mutex};
+        return _state->executor;
+    }
+
+    // queues the new tasks and waits for the in-flight ones
+    void pause() {
+        std::unique_lock<std::mutex> lock{_state->mutex};
+        // the task executed by the current thread would wait for itself
+        if (_state->threads.count(std::this_thread::get_id())) {
+            IE_THROW() << "The streams can not be changed from a task executed by the streams of the same model";
+        }
+        _state->cv.wait(lock, [&] {
+            return !_state->paused;
+        });
+        _state->paused = true;
+        _state->cv.wait(lock, [&] {
+            return _state->inFlight == 0;
+        });
+    }
+
+    void replace(IStreamsExecutor::Ptr executor) {
+        std::lock_guard<std::mutex> lock{_state->mutex};
+        _state->executor = std::move(executor);
+    }
+
+    // submits the queued tasks to the current executor
+    void resume() {
+        std::vector<InferenceEngine::Task> pending;
+        IStreamsExecutor::Ptr executor;
+        {
+            std::lock_guard<std::mutex> lock{_state->mutex};
+            _state->paused = false;
+            pending.swap(_state->pending);
+            executor = _state->executor;
+            _state->inFlight += pending.size();
+        }
+        _state->cv.notify_all();
+        for (auto&& task : pending)
+            submit(_state, executor, std::move(task));
+    }
+
+private:
+    // shared with the submitted tasks, which may outlive the executor
+    struct State {
+        std::mutex mutex;
+        std::condition_variable cv;
+        IStreamsExecutor::Ptr executor;
+        std::vector<InferenceEngine::Task> pending;
+        // the threads executing the in-flight tasks
+        std::unordered_multiset<std::thread::id> threads;
+        size_t inFlight = 0;
+        bool paused = false;
+    };
+
+    struct InFlightTask {
+        explicit InFlightTask(std::shared_ptr<State> inFlightState) : state(std::move(inFlightState)) {
+            std::lock_guard<std::mutex> lock{state->mutex};
+            state->threads.insert(std::this_thread::get_id());
+        }
+        ~InFlightTask() {
+            std::lock_guard<std::mutex> lock{state->mutex};
+            state->threads.erase(state->threads.find(std::this_thread::get_id()));
+            if (--state->inFlight == 0)
+                state->cv.notify_all();
+        }
+        std::shared_ptr<State> state;
+    };
+
+    // the executor is called without the lock, since it may execute the task in the current thread
+    static void submit(const std::shared_ptr<State>& state, const IStreamsExecutor::Ptr& executor, InferenceEngine::Task task) {
+        executor->run([state, task] {
+            InFlightTask inFlightTask{state};
+            task();
+        });
+    }
+
+    std::shared_ptr<State> _state;
+};
+
 ExecNetwork::ExecNetwork(const InferenceEngine::CNNNetwork &network,
                          const Config &cfg,
                          const ExtensionManager::Ptr& extMgr,
-                         const std::shared_ptr<InferenceEngine::IInferencePlugin>& plugin) :
+                         const std::shared_ptr<InferenceEngine::IInferencePlugin>& plugin,
+                         const InferenceEngine::CNNNetwork &batchedNetwork) :
     InferenceEngine::ExecutableNetworkThreadSafeDefault{nullptr, nullptr},
     extensionManager(extMgr),
     _network(network),
     _cfg{cfg},
-    _name{network.getName()} {
+    _name{network.getName()},
+    _batchedNetwork(batchedNetwork) {
     SetPointerToPlugin(plugin);
     auto function = network.getFunction();
     if (function == nullptr) {
@@ -81,10 +207,22 @@ ExecNetwork::ExecNetwork(const InferenceEngine::CNNNetwork &network,
 
     _cfg.isNewApi = !isLegacyAPI();
     _mutex = std::make_shared<std::mutex>();
+    _resourceClient = std::make_shared<CpuResourceManager::Client>(_cfg.modelPriority, _cfg.modelPrioritySetExplicitly);
+    _allocationStats = std::make_shared<AllocationStats>();
+    _numNumaNodes = static_cast<int>(getAvailableNUMANodes().size());
+    // the infer requests are not bound to the streams, so the I/O blobs are placed on the first touch
+    _ioAllocator = std::make_shared<CpuBlobAllocator>(
+        AllocationPolicy{_cfg.hugePages, -1, _cfg.prefaultMemory, _allocationStats.get()});
+    if (_cfg.lazyCompilation) {
+        // the threads of the executor aren't limited, so the kernels sized by the number of threads fit any stream
+        _lazyCompilationExecutor = _plugin->executorManager()->getIdleCPUStreamsExecutor(
+            IStreamsExecutor::Config{"CPULazyCompilation", 1, 0, IStreamsExecutor::ThreadBindingType::NONE});
+    }
 
     if (cfg.exclusiveAsyncRequests) {
         // special case when all InferRequests are muxed into a single queue
         _taskExecutor = _plugin->executorManager()->getExecutor("CPU");
+        InitStreamCores(_cfg.streamExecutorConfig);
     } else {
         auto streamsExecutorConfig =
             is_cpu_map_available()
@@ -93,10 +231,13 @@ ExecNetwork::ExecNetwork(const InferenceEngine::CNNNetwork &network,
                                                                                       isFloatModel);
         streamsExecutorConfig._name = "CPUStreamsExecutor";
         _cfg.streamExecutorConfig._threads = streamsExecutorConfig._threads;
+        InitStreamCores(streamsExecutorConfig);
 #if FIX_62820 && (IE_THREAD == IE_THREAD_TBB || IE_THREAD == IE_THREAD_TBB_AUTO)
         _taskExecutor = std::make_shared<TBBStreamsExecutor>(streamsExecutorConfig);
 #else
-        _taskExecutor = _plugin->executorManager()->getIdleCPUStreamsExecutor(streamsExecutorConfig);
+        _streamsExecutor = std::make_shared<ReconfigurableStreamsExecutor>(
+            _plugin->executorManager()->getIdleCPUStreamsExecutor(streamsExecutorConfig));
+        _taskExecutor = _streamsExecutor;
 #endif
     }
     if (0 != cfg.streamExecutorConfig._streams) {
@@ -111,24 +252,24 @@ ExecNetwork::ExecNetwork(const InferenceEngine::CNNNetwork &network,
         _callbackExecutor = _taskExecutor;
     }
     int streams = std::max(1, _cfg.streamExecutorConfig._streams);
-    std::vector<Task> tasks; tasks.resize(streams);
     _graphs.resize(streams);
-    if (_cfg.streamExecutorConfig._streams != 0) {
-        auto all_graphs_ready = [&] {
-            return std::all_of(_graphs.begin(), _graphs.end(), [&] (Graph& graph) {
-                return graph.IsReady();
+    _numActiveGraphs = static_cast<size_t>(streams);
+    if (_batchedNetwork.getFunction()) {
+        // a step is executed by each stream, so the batched graphs are created for all of them
+        _batchedGraphs.resize(streams);
+        _batchedRequests.resize(streams);
+        _continuousBatching = std::make_shared<ContinuousBatching>(
+            _cfg.continuousBatching, static_cast<size_t>(streams), _taskExecutor,
+            [this](const std::vector<InferRequestBase*>& sequences, size_t slot, std::vector<std::exception_ptr>& exceptions) {
+                InferSequences(sequences, slot, exceptions);
             });
-        };
-        do {
-            for (auto&& task : tasks) {
-                task = [this] {
-                    ExecNetwork::GetGraph();
-                };
-            }
-            _taskExecutor->runAndWait(tasks);
-        } while (!all_graphs_ready());
+    }
+    if (_cfg.streamExecutorConfig._streams != 0) {
+        CreateGraphs(_taskExecutor);
     } else {
         ExecNetwork::GetGraph();
+        if (!_batchedGraphs.empty())
+            GetBatchedGraph();
     }
 
     // Save all MemoryLayer data tensors. Will use insight about mechanics
@@ -156,32 +297,52 @@ ExecNetwork::ExecNetwork(const InferenceEngine::CNNNetwork &network,
 }
 
 ExecNetwork::GraphGuard::Lock ExecNetwork::GetGraph() const {
+    return GetGraph(_graphs, _network);
+}
+
+ExecNetwork::GraphGuard::Lock ExecNetwork::GetBatchedGraph() const {
+    return GetGraph(_batchedGraphs, _batchedNetwork);
+}
+
+ExecNetwork::GraphGuard::Lock ExecNetwork::GetGraph(std::deque<GraphGuard>& graphs,
+                                                    const InferenceEngine::CNNNetwork& network) const {
     int streamId = 0;
     int numaNodeId = 0;
-    auto streamsExecutor = dynamic_cast<InferenceEngine::IStreamsExecutor*>(_taskExecutor.get());
+    // the current executor is used directly, so the graph is created even if the new tasks are paused
+    auto streamsExecutor = _streamsExecutor ? _streamsExecutor->current()
+                                            : std::dynamic_pointer_cast<InferenceEngine::IStreamsExecutor>(_taskExecutor);
     if (nullptr != streamsExecutor) {
         streamId = streamsExecutor->GetStreamId();
         numaNodeId = streamsExecutor->GetNumaNodeId();
     }
-    auto graphLock = GraphGuard::Lock(_graphs[streamId % _graphs.size()]);
+    // the streams are not reconfigured with the batched graphs, so there are as many of them as the active streams
+    auto graphLock = GraphGuard::Lock(graphs[streamId % std::min(graphs.size(), _numActiveGraphs.load())]);
     if (!graphLock._graph.IsReady()) {
         std::exception_ptr exception;
         auto makeGraph = [&] {
             try {
+                // the weights and the workspace are allocated on the stream thread, so they are placed with it
+                CpuAllocator::PolicyScope allocationScope(GetAllocationPolicy());
                 GraphContext::Ptr ctx;
                 {
                     std::lock_guard<std::mutex> lock{*_mutex.get()};
                     // disable weights caching if graph was created only once
-                    auto weightsCache =
-                        _cfg.streamExecutorConfig._streams != 1 ? _numaNodesWeights[numaNodeId] : nullptr;
+                    auto weightsCache = _cfg.streamExecutorConfig._streams != 1 || _graphs.size() != 1 ||
+                                        !_batchedGraphs.empty()
+                                            ? _numaNodesWeights[numaNodeId]
+                                            : nullptr;
 
                     auto isQuantizedFlag =
                         (_cfg.lpTransformsMode == Config::On) &&
-                        ngraph::pass::low_precision::LowPrecision::isFunctionQuantized(_network.getFunction());
+                        ngraph::pass::low_precision::LowPrecision::isFunctionQuantized(network.getFunction());
 
                     ctx = std::make_shared<GraphContext>(_cfg, extensionManager, weightsCache, isQuantizedFlag);
                 }
-                graphLock._graph.CreateGraph(_network, ctx);
+                if (_lazyCompilationExecutor)
+                    graphLock._graph.EnableLazyCompilation(_lazyCompilationExecutor);
+                graphLock._graph.CreateGraph(network, ctx);
+                // executed on the stream of the graph, so the kernels are prepared with the same threading
+                graphLock._graph.Warmup(_cfg.warmupShapeSets);
             } catch (...) {
                 exception = std::current_exception();
             }
@@ -198,8 +359,231 @@ ExecNetwork::GraphGuard::Lock ExecNetwork::GetGraph() const {
     return graphLock;
 }
 
+void ExecNetwork::CreateGraphs(const InferenceEngine::ITaskExecutor::Ptr& executor) const {
+    const size_t streams = _numActiveGraphs;
+    auto all_graphs_ready = [&] {
+        return std::all_of(_graphs.begin(), _graphs.begin() + static_cast<std::ptrdiff_t>(streams), [&] (Graph& graph) {
+            return graph.IsReady();
+        }) && std::all_of(_batchedGraphs.begin(), _batchedGraphs.end(), [&] (Graph& graph) {
+            return graph.IsReady();
+        });
+    };
+    std::vector<Task> tasks(streams);
+    do {
+        for (auto&& task : tasks) {
+            task = [this] {
+                ExecNetwork::GetGraph();
+                if (!_batchedGraphs.empty())
+                    GetBatchedGraph();
+            };
+        }
+        executor->runAndWait(tasks);
+    } while (!all_graphs_ready());
+}
+
+void ExecNetwork::SetConfig(const std::map<std::string, Parameter>& config) {
+    for (const auto& entry : config) {
+        if (entry.first != ov::num_streams.name() && entry.first != ov::inference_num_threads.name()) {
+            IE_THROW() << "Unsupported ExecutableNetwork property: " << entry.first << ". Only "
+                       << ov::num_streams.name() << " and " << ov::inference_num_threads.name() << " can be changed";
+        }
+    }
+    if (config.empty())
+        return;
+    if (!_streamsExecutor || _cfg.streamExecutorConfig._streams == 0) {
+        IE_THROW() << "The streams can not be changed if the model is compiled without streams "
+                   << "or with exclusive async requests";
+    }
+    if (_continuousBatching) {
+        // the batched graphs and the step slots are created for the streams of the compilation
+        IE_THROW() << "The streams can not be changed if the model is compiled with "
+                   << ov::intel_cpu::continuous_batching.name();
+    }
+    {
+        // the states are kept by the graphs, so they would be lost
+        auto graphLock = GetGraph();
+        const auto& nodes = graphLock._graph.GetNodes();
+        if (std::any_of(nodes.begin(), nodes.end(), [](const NodePtr& node) {
+                return node->getType() == Type::MemoryInput;
+            })) {
+            IE_THROW() << "The streams of the stateful model can not be changed";
+        }
+    }
+    ReconfigureStreams(config);
+}
+
+void ExecNetwork::ReconfigureStreams(const std::map<std::string, Parameter>& config) {
+    // the new inferences are queued from here, so the graphs are not used by the streams
+    _streamsExecutor->pause();
+    try {
+        std::unique_lock<std::mutex> lock{*_mutex.get()};
+        Config cfg = _cfg;
+        lock.unlock();
+        auto& streamsConfig = cfg.streamExecutorConfig;
+        for (const auto& entry : config)
+            streamsConfig.set_property(entry.first, entry.second);
+        if (streamsConfig._streams < 1) {
+            IE_THROW() << "Wrong value for property key " << ov::num_streams.name()
+                       << ". Expected only positive numbers (#streams)";
+        }
+
+        // the same as the plugin does on the compilation
+        auto streamsExecutorConfig = streamsConfig;
+        if (is_cpu_map_available()) {
+            get_num_streams(streamsConfig._streams, std::const_pointer_cast<ngraph::Function>(_network.getFunction()), cfg);
+            streamsExecutorConfig = streamsConfig;
+        } else {
+            const bool isFloatModel =
+                !ov::op::util::has_op_with_type<ngraph::op::FakeQuantize>(_network.getFunction());
+            streamsExecutorConfig =
+                InferenceEngine::IStreamsExecutor::Config::MakeDefaultMultiThreaded(streamsConfig, isFloatModel);
+            streamsConfig._threads = streamsExecutorConfig._threads;
+        }
+        streamsExecutorConfig._name = "CPUStreamsExecutor";
+        cfg._config[CONFIG_KEY(CPU_THROUGHPUT_STREAMS)] = std::to_string(streamsConfig._streams);
+        cfg._config[CONFIG_KEY(CPU_THREADS_NUM)] = std::to_string(streamsConfig._threads);
+        auto executor = _plugin->executorManager()->getIdleCPUStreamsExecutor(streamsExecutorConfig);
+
+        const auto streams = static_cast<size_t>(streamsConfig._streams);
+        lock.lock();
+        _cfg = cfg;
+        while (_graphs.size() < streams)
+            _graphs.emplace_back();
+        lock.unlock();
+        // the graphs of the inactive streams are kept for the infer requests created on them,
+        // such requests switch to the active graphs on the next inference
+        for (size_t i = 0; i < streams; i++) {
+            GraphGuard::Lock graphLock{_graphs[i]};
+            graphLock._graph.Reset();
+        }
+        _numActiveGraphs = streams;
+        InitStreamCores(streamsExecutorConfig);
+        _streamsExecutor->replace(executor);
+        // the weights are taken from the cache filled by the previous graphs
+        CreateGraphs(executor);
+    } catch (...) {
+        _streamsExecutor->resume();
+        throw;
+    }
+    _streamsExecutor->resume();
+}
+
+void ExecNetwork::InitStreamCores(const InferenceEngine::IStreamsExecutor::Config& config) {
+    const int streams = std::max(1, config._streams);
+    // the same pinning as the streams executor does
+    const bool pinned = config._cpu_pinning && static_cast<int>(config._stream_core_ids.size()) == config._streams;
+    _streamCores.assign(streams, {});
+    for (int i = 0; i < streams; i++) {
+        auto& cores = _streamCores[i];
+        if (!config._streams_info_table.empty() && static_cast<size_t>(i) < config._stream_ids.size()) {
+            cores.threads = config._streams_info_table[config._stream_ids[i]][THREADS_PER_STREAM];
+        } else {
+            cores.threads = config._threadsPerStream > 0 ? config._threadsPerStream : config._threads / streams;
+        }
+        if (cores.threads <= 0)
+            cores.threads = CpuResourceManager::get().capacity();
+        if (pinned)
+            cores.cpuIds = config._stream_core_ids[i];
+    }
+}
+
+CpuResourceManager::Lease ExecNetwork::AcquireCores() const {
+    int streamId = 0;
+    auto streamsExecutor = _streamsExecutor ? _streamsExecutor->current()
+                                            : std::dynamic_pointer_cast<InferenceEngine::IStreamsExecutor>(_taskExecutor);
+    if (nullptr != streamsExecutor)
+        streamId = streamsExecutor->GetStreamId();
+    // the external streams run on the cores of the last stream
+    const auto& cores = _streamCores[std::min(static_cast<size_t>(streamId), _streamCores.size() - 1)];
+    return CpuResourceManager::get().acquire(*_resourceClient, cores);
+}
+
+AllocationPolicy ExecNetwork::GetAllocationPolicy() const {
+    int numaNodeId = -1;
+    auto streamsExecutor = _streamsExecutor ? _streamsExecutor->current()
+                                            : std::dynamic_pointer_cast<InferenceEngine::IStreamsExecutor>(_taskExecutor);
+    // the pages are bound only if each stream runs on a single NUMA node
+    if (_cfg.numaAwareAllocation && _numNumaNodes > 1 && _cfg.streamExecutorConfig._streams >= _numNumaNodes &&
+        nullptr != streamsExecutor) {
+        numaNodeId = streamsExecutor->GetNumaNodeId();
+    }
+    return AllocationPolicy{_cfg.hugePages, numaNodeId, _cfg.prefaultMemory, _allocationStats.get()};
+}
+
 InferenceEngine::IInferRequestInternal::Ptr ExecNetwork::CreateInferRequest() {
-    return CreateAsyncInferRequestFromSync<AsyncInferRequest>();
+    auto asyncRequest = CreateAsyncInferRequestFromSync<AsyncInferRequest>();
+    if (_continuousBatching)
+        std::static_pointer_cast<AsyncInferRequest>(asyncRequest)->EnableContinuousBatching(_continuousBatching);
+    return asyncRequest;
+}
+
+void ExecNetwork::InferSequences(const std::vector<InferRequestBase*>& sequences,
+                                 size_t slot,
+                                 std::vector<std::exception_ptr>& exceptions) {
+    std::vector<InferRequestBase*> batchable;
+    std::vector<size_t> batchableIds;
+    for (size_t i = 0; i < sequences.size(); i++) {
+        if (sequences[i]->IsBatchable()) {
+            batchable.push_back(sequences[i]);
+            batchableIds.push_back(i);
+            continue;
+        }
+        // e.g. the tensors set by the user have the strides, such sequences are executed by their own requests
+        try {
+            sequences[i]->InferImpl();
+        } catch (...) {
+            exceptions[i] = std::current_exception();
+        }
+    }
+    // the batch-1 graph is faster for the only sequence
+    if (batchable.size() == 1) {
+        try {
+            batchable.front()->InferImpl();
+        } catch (...) {
+            exceptions[batchableIds.front()] = std::current_exception();
+        }
+        return;
+    }
+    if (batchable.empty())
+        return;
+
+    try {
+        auto& request = _batchedRequests[slot];
+        if (!request) {
+            // the same inputs and outputs as the ones of the model, but with the batch of the sequences
+            const auto batch = static_cast<int64_t>(_continuousBatching->maxSequences());
+            auto batchedShape = [batch](ov::PartialShape shape) {
+                shape[0] = batch;
+                return shape;
+            };
+            std::vector<std::shared_ptr<const ov::Node>> parameters, results;
+            for (const auto& parameter : _parameters) {
+                auto input = std::make_shared<ov::op::v0::Parameter>(parameter->get_output_element_type(0),
+                                                                    batchedShape(parameter->get_output_partial_shape(0)));
+                input->set_friendly_name(parameter->get_friendly_name());
+                input->output(0).get_tensor().set_names(parameter->output(0).get_names());
+                parameters.emplace_back(input);
+            }
+            for (const auto& result : _results) {
+                auto fakeParameter = std::make_shared<ov::op::v0::Parameter>(result->get_output_element_type(0),
+                                                                            batchedShape(result->get_output_partial_shape(0)));
+                fakeParameter->set_friendly_name(result->get_input_node_ptr(0)->get_friendly_name());
+                fakeParameter->output(0).get_tensor().set_names(result->input_value(0).get_names());
+                auto output = std::make_shared<ov::op::v0::Result>(fakeParameter);
+                output->set_friendly_name(result->get_friendly_name());
+                results.emplace_back(output);
+            }
+            // the request is owned by this network, so it doesn't keep the network alive
+            request = std::make_shared<InferRequest>(parameters,
+                                                     results,
+                                                     ExecNetwork::Ptr(ExecNetwork::Ptr(), this),
+                                                     true);
+        }
+        request->InferSequences(batchable);
+    } catch (...) {
+        for (auto id : batchableIds)
+            exceptions[id] = std::current_exception();
+    }
 }
 
 std::shared_ptr<ngraph::Function> ExecNetwork::GetExecGraphInfo() {
@@ -233,7 +617,7 @@ Parameter ExecNetwork::GetConfigLegacy(const std::string &name) const {
 
 /**
  * Only legacy parameters are supported.
- * No RW peroperties supported for new API.
+ * The RW properties of new API (streams and threads) are covered with GetMetric() method as well.
  * All the RO properties are covered with GetMetric() method and
  * GetConfig() is not expected to be called by new API with params from new configuration API.
  */
@@ -274,6 +658,23 @@ InferenceEngine::Parameter ExecNetwork::GetMetricLegacy(const std::string &name,
 InferenceEngine::Parameter ExecNetwork::GetMetric(const std::string &name) const {
     if (_graphs.empty())
         IE_THROW() << "No graph was found";
+
+    if (name == ov::intel_cpu::profiling_report) {
+        return decltype(ov::intel_cpu::profiling_report)::value_type(GetProfilingReport());
+    } else if (name == ov::intel_cpu::profiling_trace) {
+        return decltype(ov::intel_cpu::profiling_trace)::value_type(GetProfilingTrace());
+    } else if (name == ov::intel_cpu::resource_usage) {
+        return decltype(ov::intel_cpu::resource_usage)::value_type(
+            _resourceClient->usageReport(CpuResourceManager::get().capacity()));
+    } else if (name == ov::intel_cpu::allocation_stats) {
+        return decltype(ov::intel_cpu::allocation_stats)::value_type(_allocationStats->toJson());
+    } else if (name == ov::intel_cpu::continuous_batching) {
+        return decltype(ov::intel_cpu::continuous_batching)::value_type(
+            _continuousBatching ? _continuousBatching->maxSequences() : 0);
+    } else if (name == ov::intel_cpu::continuous_batching_stats) {
+        return decltype(ov::intel_cpu::continuous_batching_stats)::value_type(
+            _continuousBatching ? _continuousBatching->getStats().toJson() : ContinuousBatching::Stats().toJson());
+    }
     // @todo Can't we just use local copy (_cfg) instead?
     auto graphLock = GetGraph();
     const auto& graph = graphLock._graph;
@@ -286,19 +687,23 @@ InferenceEngine::Parameter ExecNetwork::GetMetric(const std::string &name) const
     auto RO_property = [](const std::string& propertyName) {
         return ov::PropertyName(propertyName, ov::PropertyMutability::RO);
     };
+    auto RW_property = [](const std::string& propertyName) {
+        return ov::PropertyName(propertyName, ov::PropertyMutability::RW);
+    };
 
     if (name == ov::supported_properties) {
         return std::vector<ov::PropertyName> {
             RO_property(ov::supported_properties.name()),
             RO_property(ov::model_name.name()),
             RO_property(ov::optimal_number_of_infer_requests.name()),
-            RO_property(ov::num_streams.name()),
+            RW_property(ov::num_streams.name()),
             RO_property(ov::affinity.name()),
-            RO_property(ov::inference_num_threads.name()),
+            RW_property(ov::inference_num_threads.name()),
             RO_property(ov::enable_profiling.name()),
             RO_property(ov::hint::inference_precision.name()),
             RO_property(ov::hint::performance_mode.name()),
             RO_property(ov::hint::execution_mode.name()),
+            RO_property(ov::hint::model_priority.name()),
             RO_property(ov::hint::num_requests.name()),
             RO_property(ov::hint::enable_cpu_pinning.name()),
             RO_property(ov::hint::scheduling_core_type.name()),
@@ -306,6 +711,19 @@ InferenceEngine::Parameter ExecNetwork::GetMetric(const std::string &name) const
             RO_property(ov::execution_devices.name()),
             RO_property(ov::intel_cpu::denormals_optimization.name()),
             RO_property(ov::intel_cpu::sparse_weights_decompression_rate.name()),
+            RO_property(ov::intel_cpu::profiling_sampling_rate.name()),
+            RO_property(ov::intel_cpu::warmup_shapes.name()),
+            RO_property(ov::intel_cpu::profiling_report.name()),
+            RO_property(ov::intel_cpu::profiling_trace.name()),
+            RO_property(ov::intel_cpu::resource_usage.name()),
+            RO_property(ov::intel_cpu::huge_pages.name()),
+            RO_property(ov::intel_cpu::numa_aware_allocation.name()),
+            RO_property(ov::intel_cpu::prefault_memory.name()),
+            RO_property(ov::intel_cpu::allocation_stats.name()),
+            RO_property(ov::intel_cpu::lazy_compilation.name()),
+            RO_property(ov::intel_cpu::parallel_compilation.name()),
+            RO_property(ov::intel_cpu::continuous_batching.name()),
+            RO_property(ov::intel_cpu::continuous_batching_stats.name()),
         };
     }
 
@@ -340,7 +758,8 @@ InferenceEngine::Parameter ExecNetwork::GetMetric(const std::string &name) const
         return decltype(ov::enable_profiling)::value_type(perfCount);
     } else if (name == ov::hint::inference_precision) {
         const auto enforceBF16 = config.enforceBF16;
-        const auto inference_precision = enforceBF16 ? ov::element::bf16 : ov::element::f32;
+        const auto enforceFP16 = config.enforceFP16;
+        const auto inference_precision = enforceBF16 ? ov::element::bf16 : enforceFP16 ? ov::element::f16 : ov::element::f32;
         return decltype(ov::hint::inference_precision)::value_type(inference_precision);
     } else if (name == ov::hint::performance_mode) {
         const auto perfHint = ov::util::from_string(config.perfHintsConfig.ovPerfHint, ov::hint::performance_mode);
@@ -356,6 +775,8 @@ InferenceEngine::Parameter ExecNetwork::GetMetric(const std::string &name) const
         return decltype(ov::hint::enable_hyper_threading)::value_type(use_ht);
     } else if (name == ov::hint::execution_mode) {
         return config.executionMode;
+    } else if (name == ov::hint::model_priority) {
+        return config.modelPriority;
     } else if (name == ov::hint::num_requests) {
         const auto perfHintNumRequests = config.perfHintsConfig.ovPerfHintNumRequests;
         return decltype(ov::hint::num_requests)::value_type(perfHintNumRequests);
@@ -365,12 +786,94 @@ InferenceEngine::Parameter ExecNetwork::GetMetric(const std::string &name) const
         return decltype(ov::intel_cpu::denormals_optimization)::value_type(config.denormalsOptMode == Config::DenormalsOptMode::DO_On);
     } else if (name == ov::intel_cpu::sparse_weights_decompression_rate) {
         return decltype(ov::intel_cpu::sparse_weights_decompression_rate)::value_type(config.fcSparseWeiDecompressionRate);
+    } else if (name == ov::intel_cpu::profiling_sampling_rate) {
+        return decltype(ov::intel_cpu::profiling_sampling_rate)::value_type(config.perfCountersSamplingRate);
+    } else if (name == ov::intel_cpu::warmup_shapes) {
+        return decltype(ov::intel_cpu::warmup_shapes)::value_type(config.warmupShapes);
+    } else if (name == ov::intel_cpu::huge_pages) {
+        return config.hugePages;
+    } else if (name == ov::intel_cpu::numa_aware_allocation) {
+        return decltype(ov::intel_cpu::numa_aware_allocation)::value_type(config.numaAwareAllocation);
+    } else if (name == ov::intel_cpu::prefault_memory) {
+        return decltype(ov::intel_cpu::prefault_memory)::value_type(config.prefaultMemory);
+    } else if (name == ov::intel_cpu::lazy_compilation) {
+        return decltype(ov::intel_cpu::lazy_compilation)::value_type(config.lazyCompilation);
+    } else if (name == ov::intel_cpu::parallel_compilation) {
+        return decltype(ov::intel_cpu::parallel_compilation)::value_type(config.parallelCompilation);
     }
     /* Internally legacy parameters are used with new API as part of migration procedure.
      * This fallback can be removed as soon as migration completed */
     return GetMetricLegacy(name, graph);
 }
 
+namespace {
+std::string toJsonString(const std::string& str) {
+    std::ostringstream os;
+    os << '"';
+    for (const char c : str) {
+        if (c == '"' || c == '\\') {
+            os << '\\' << c;
+        } else if (static_cast<unsigned char>(c) < 0x20) {
+            os << "\\u" << std::hex << std::setw(4) << std::setfill('0') << static_cast<int>(c) << std::dec;
+        } else {
+            os << c;
+        }
+    }
+    os << '"';
+    return os.str();
+}
+}   // namespace
+
+std::string ExecNetwork::GetProfilingReport() const {
+    std::map<std::string, std::pair<std::string, LatencyHistogram>> histograms;
+    for (auto& graph : _graphs) {
+        GraphGuard::Lock graphLock{graph};
+        if (graph.IsReady())
+            graph.GetLatencyHistograms(histograms);
+    }
+
+    std::ostringstream os;
+    os << std::fixed << std::setprecision(3) << "{\"nodes\":[";
+    bool first = true;
+    for (const auto& entry : histograms) {
+        const auto& histogram = entry.second.second;
+        os << (first ? "" : ",") << "{\"name\":" << toJsonString(entry.first)
+           << ",\"type\":" << toJsonString(entry.second.first)
+           << ",\"count\":" << histogram.count()
+           << ",\"p50_us\":" << histogram.percentile(50.0) / 1000.0
+           << ",\"p99_us\":" << histogram.percentile(99.0) / 1000.0 << "}";
+        first = false;
+    }
+    os << "]}";
+    return os.str();
+}
+
+std::string ExecNetwork::GetProfilingTrace() const {
+    using namespace std::chrono;
+    std::ostringstream os;
+    os << std::fixed << std::setprecision(3) << "{\"displayTimeUnit\":\"ns\",\"traceEvents\":[";
+    bool first = true;
+    for (size_t stream = 0; stream < _graphs.size(); stream++) {
+        auto& graph = _graphs[stream];
+        GraphGuard::Lock graphLock{graph};
+        if (!graph.IsReady())
+            continue;
+        os << (first ? "" : ",") << "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":0,\"tid\":" << stream
+           << ",\"args\":{\"name\":\"stream " << stream << "\"}}";
+        first = false;
+        // all the streams use the same clock, so the events are aligned on the timeline
+        graph.GetPerfTrace().forEach([&](const PerfTrace::Event& event) {
+            os << ",{\"name\":" << toJsonString(event.node->getName())
+               << ",\"cat\":" << toJsonString(event.node->getTypeStr())
+               << ",\"ph\":\"X\",\"pid\":0,\"tid\":" << stream
+               << ",\"ts\":" << duration<double, std::micro>(event.start.time_since_epoch()).count()
+               << ",\"dur\":" << duration<double, std::micro>(event.duration).count() << "}";
+        });
+    }
+    os << "]}";
+    return os.str();
+}
+
 void ExecNetwork::Export(std::ostream& modelStream) {
     CNNNetworkSerializer serializer(modelStream, extensionManager);
     serializer <<_network;
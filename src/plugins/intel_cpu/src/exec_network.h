@@ -10,6 +10,9 @@
 #include "graph.h"
 #include "extension_mngr.h"
 #include "graph_context.h"
+#include "cpu_resource_manager.hpp"
+#include "cpu_allocator.h"
+#include "continuous_batching.h"
 #include <threading/ie_thread_local.hpp>
 
 #include <vector>
@@ -35,9 +38,20 @@ public:
 
     InferenceEngine::IInferRequestInternal::Ptr CreateInferRequest() override;
 
+    /**
+     * @param batchedNetwork the stateful network reshaped to the batch of the continuous batching,
+     *        the batching is disabled if the network is empty
+     */
     ExecNetwork(const InferenceEngine::CNNNetwork &network, const Config &cfg,
                 const ExtensionManager::Ptr &extMgr,
-                const std::shared_ptr<InferenceEngine::IInferencePlugin>& plugin);
+                const std::shared_ptr<InferenceEngine::IInferencePlugin>& plugin,
+                const InferenceEngine::CNNNetwork &batchedNetwork = {});
+
+    /* Only the number of streams and the number of threads can be changed after the compilation.
+     * The new inferences are queued until the in-flight ones are finished, then the executor and the graphs
+     * of the streams are recreated, the weights are shared with the graphs created before.
+     */
+    void SetConfig(const std::map<std::string, InferenceEngine::Parameter>& config) override;
 
     InferenceEngine::Parameter GetConfig(const std::string &name) const override;
 
@@ -60,27 +74,86 @@ protected:
     std::string                                 _name;
     struct GraphGuard : public Graph {
         std::mutex  _mutex;
+        // drops the graph, so it is created again on the next access
+        void Reset() {
+            ForgetGraphData();
+        }
         struct Lock : public std::unique_lock<std::mutex> {
             explicit Lock(GraphGuard& graph) : std::unique_lock<std::mutex>(graph._mutex), _graph(graph) {}
             GraphGuard& _graph;
         };
     };
 
+    // Forwards the tasks to the streams executor, which can be replaced when the streams are reconfigured
+    class ReconfigurableStreamsExecutor;
+
+    // the graphs allocate the memory with the stats, including the background primitive creation,
+    // so the stats are destroyed after the graphs
+    std::shared_ptr<AllocationStats>            _allocationStats;
     // WARNING: Do not use _graphs directly.
+    // The graphs are never removed, since the infer requests keep the pointers to them.
+    // Only the first _numActiveGraphs graphs are used by the streams, the rest ones are left after the reconfiguration
     mutable std::deque<GraphGuard>              _graphs;
+    // the graphs of the batched network of the continuous batching, one per stream
+    const InferenceEngine::CNNNetwork           _batchedNetwork;
+    mutable std::deque<GraphGuard>              _batchedGraphs;
+    std::atomic<size_t>                         _numActiveGraphs = {0};
     mutable NumaNodesWeights                    _numaNodesWeights;
+    std::shared_ptr<ReconfigurableStreamsExecutor> _streamsExecutor;
+    std::shared_ptr<CpuResourceManager::Client> _resourceClient;
+    // the cores used by the inferences of each stream
+    std::vector<CpuResourceManager::Cores>      _streamCores;
+    // allocates the I/O blobs of the infer requests
+    std::shared_ptr<CpuBlobAllocator>           _ioAllocator;
+    int                                         _numNumaNodes = 1;
+    // creates the primitives of the graphs in the background in the lazy compilation mode, nullptr otherwise
+    InferenceEngine::ITaskExecutor::Ptr         _lazyCompilationExecutor;
+    // gathers the sequences of the infer requests into the steps of the batched graphs, nullptr if disabled
+    std::shared_ptr<ContinuousBatching>         _continuousBatching;
+    // the requests executing the steps on the batched graphs, one per step slot, created on the first batched step
+    std::vector<std::shared_ptr<InferRequestBase>> _batchedRequests;
 
     /* WARNING: Use GetGraph() function to get access to graph in current stream.
      * NOTE: Main thread is interpreted as master thread of external stream so use this function to get access to graphs
      *       even from main thread
      */
     GraphGuard::Lock GetGraph() const;
+    // the same for the batched graph of the continuous batching
+    GraphGuard::Lock GetBatchedGraph() const;
+    GraphGuard::Lock GetGraph(std::deque<GraphGuard>& graphs, const InferenceEngine::CNNNetwork& network) const;
+
+    // creates the graphs of all the active streams using the threads of the executor
+    void CreateGraphs(const InferenceEngine::ITaskExecutor::Ptr& executor) const;
+
+    // replaces the streams executor and recreates the graphs, the inferences started meanwhile are queued.
+    // It can be called from the infer callbacks, since they are executed by the callback executor, but throws
+    // if it's called from a task executed by the streams of the model, which would wait for itself
+    void ReconfigureStreams(const std::map<std::string, InferenceEngine::Parameter>& config);
+
+    void InitStreamCores(const InferenceEngine::IStreamsExecutor::Config& config);
+
+    // blocks until the cores of the current stream are granted by the process level resource manager
+    CpuResourceManager::Lease AcquireCores() const;
+
+    // the placement of the memory allocated by the graph of the current stream
+    AllocationPolicy GetAllocationPolicy() const;
 
     bool isLegacyAPI() const;
 
+    // executes the step of the continuous batching
+    void InferSequences(const std::vector<InferRequestBase*>& sequences,
+                        size_t slot,
+                        std::vector<std::exception_ptr>& exceptions);
+
     InferenceEngine::Parameter GetConfigLegacy(const std::string &name) const;
 
     InferenceEngine::Parameter GetMetricLegacy(const std::string &name, const GraphGuard& graph) const;
+
+    /* Both functions lock the graphs of all the streams one by one to collect the profiling data,
+     * so they must not be called while the graph of the current stream is locked
+     */
+    std::string GetProfilingReport() const;
+    std::string GetProfilingTrace() const;
 };
 
 }   // namespace intel_cpu
@@ -3,6 +3,7 @@
 //
 
 #include <algorithm>
+#include <cstring>
 #include <string>
 #include <map>
 #include <vector>
@@ -13,6 +14,7 @@
 #include <unordered_map>
 #include <memory>
 #include <utility>
+#include <exception>
 
 #include "graph.h"
 #include "graph_dumper.h"
@@ -20,6 +22,7 @@
 #include "dnnl_extension_utils.h"
 #include "extension_mngr.h"
 #include "memory_solver.hpp"
+#include "cpu_allocator.h"
 #include "itt.h"
 #include "infer_request.h"
 #include "nodes/input.h"
@@ -67,6 +70,7 @@ typedef std::unordered_set<EdgePtr> edge_cluster_t;
 typedef std::vector<edge_cluster_t> edge_clusters_t;
 
 Graph::~Graph() {
+    StopLazyCompilation();
     CPU_DEBUG_CAP_ENABLE(summary_perf(*this));
 }
 
@@ -194,6 +198,8 @@ void Graph::Replicate(const std::shared_ptr<const ov::Model> &subgraph) {
 
     if (getConfig().enforceBF16)
         EnforceBF16();
+    else if (getConfig().enforceFP16)
+        EnforceFP16Storage();
 }
 
 void Graph::Replicate(const CNNNetwork &network) {
@@ -293,6 +299,8 @@ void Graph::Replicate(const CNNNetwork &network) {
 
     if (getConfig().enforceBF16)
         EnforceBF16();
+    else if (getConfig().enforceFP16)
+        EnforceFP16Storage();
 
     auto hasSubgraphConsumers = [] (const NodePtr& node) -> bool {
         const auto & childEdges = node->getChildEdges();
@@ -356,6 +364,8 @@ void Graph::InitGraph() {
 
     InitDescriptors();
 
+    PlanLayouts();
+
     InitOptimalPrimitiveDescriptors();
 
     InitEdges();
@@ -393,14 +403,111 @@ void Graph::InitGraph() {
     CreatePrimitivesAndExecConstants();
 
 #ifndef CPU_DEBUG_CAPS
+    std::unordered_set<Node*> lazyNodes;
+    if (lazyPrimitives) {
+        for (const auto& node : lazyPrimitives->nodes)
+            lazyNodes.insert(node.get());
+    }
     for (auto &graphNode : graphNodes) {
-        graphNode->cleanup();
+        // the nodes are cleaned up after the lazy creation of their primitives
+        if (!lazyNodes.count(graphNode.get()))
+            graphNode->cleanup();
     }
 #endif
 
     ExtractExecutableNodes();
 
     status = haveDynNodes ? Status::ReadyDynamic : Status::ReadyStatic;
+
+    if (lazyPrimitives && !lazyPrimitives->nodes.empty()) {
+        lazyPrimitives->created.assign(lazyPrimitives->nodes.size(), false);
+        lazyPrimitives->pending = true;
+        auto lazy = lazyPrimitives;
+        // the primitives and the scratchpads are allocated the same way as the graph created on the stream
+        const auto allocationPolicy = CpuAllocator::currentPolicy();
+        lazyExecutor->run([lazy, allocationPolicy] {
+            CpuAllocator::PolicyScope allocationScope(allocationPolicy);
+            std::lock_guard<std::mutex> lock(lazy->mutex);
+            lazy->createRemaining(true);
+        });
+    }
+}
+
+void Graph::LazyPrimitives::createRemaining(bool background) {
+    if (!pending)
+        return;
+    // the allocation policy is set for the calling thread only
+    const auto policy = CpuAllocator::currentPolicy();
+    std::vector<std::exception_ptr> errors(nodes.size());
+    auto create = [&](size_t i) {
+        const auto& node = nodes[i];
+        try {
+            OV_ITT_SCOPE(FIRST_INFERENCE, itt::domains::intel_cpu_LT, node->profiling.createPrimitive);
+            DEBUG_LOG(*node);
+            node->createPrimitive();
+        } catch (...) {
+            errors[i] = std::current_exception();
+            return;
+        }
+#ifndef CPU_DEBUG_CAPS
+        node->cleanup();
+#endif
+        created[i] = true;
+    };
+    auto hasBodyGraphs = [](const NodePtr& node) {
+        return one_of(node->getType(), Type::TensorIterator, Type::If);
+    };
+
+    // the creation time differs a lot from node to node, so the threads take the nodes one by one
+    std::atomic<size_t> next{0};
+    parallel_nt(0, [&](const int, const int) {
+        CpuAllocator::PolicyScope allocationScope(policy);
+        for (size_t i = next++; i < nodes.size(); i = next++) {
+            if (background && interrupted)
+                return;
+            if (!created[i] && !hasBodyGraphs(nodes[i]))
+                create(i);
+        }
+    });
+    // the nodes with the body graphs create the primitives of their bodies, so they are created in order
+    for (size_t i = 0; i < nodes.size(); i++) {
+        if (background && interrupted)
+            return;
+        if (!created[i] && hasBodyGraphs(nodes[i]))
+            create(i);
+    }
+
+    // the error of the first node in the execution order is reported
+    for (const auto& error : errors) {
+        if (error) {
+            if (background)
+                return;
+            std::rethrow_exception(error);
+        }
+    }
+    pending = false;
+}
+
+void Graph::CreatePendingPrimitives() {
+    OV_ITT_SCOPE(FIRST_INFERENCE, itt::domains::intel_cpu_LT, "Graph::CreatePendingPrimitives");
+    // the nodes in progress are finished by the background task, the rest are created by the threads of the stream
+    lazyPrimitives->interrupted = true;
+    std::lock_guard<std::mutex> lock(lazyPrimitives->mutex);
+    lazyPrimitives->createRemaining(false);
+}
+
+void Graph::StopLazyCompilation() {
+    if (!lazyPrimitives)
+        return;
+    lazyPrimitives->interrupted = true;
+    {
+        // waits for the primitives being created in the background, the rest ones are dropped with the graph
+        std::lock_guard<std::mutex> lock(lazyPrimitives->mutex);
+        lazyPrimitives->nodes.clear();
+        lazyPrimitives->created.clear();
+        lazyPrimitives->pending = false;
+    }
+    lazyPrimitives.reset();
 }
 
 void Graph::InitNodes() {
@@ -455,6 +562,251 @@ void Graph::InitDescriptors() {
     }
 }
 
+// Number of elements a reorder on the edge has to move, used as the reorder cost estimation.
+// Dynamic dimensions are taken by their upper bound, unbounded ones by a fixed guess.
+static double estimateElementsCount(const Shape& shape) {
+    if (shape.isStatic())
+        return static_cast<double>(shape.getElementsCount());
+
+    constexpr size_t unboundedDimGuess = 64;
+    double count = 1;
+    for (const auto dim : shape.getMaxDims()) {
+        count *= dim == Shape::UNDEFINED_DIM ? unboundedDimGuess : dim;
+    }
+    return count;
+}
+
+void Graph::PlanLayouts() {
+    OV_ITT_SCOPE(FIRST_INFERENCE, itt::domains::intel_cpu_LT, "Graph::PlanLayouts");
+#ifdef CPU_DEBUG_CAPS
+    if (getConfig().debugCaps.disable.layoutPlanning)
+        return;
+#endif
+    // Greedy selection of primitive descriptors looks only at the parents of the node, so a node may select
+    // a layout which is cheap for its input, but requires reorders for all its consumers. Here the selection
+    // is refined for the whole graph: the summary cost of reorders on the edges plus the estimated kernel cost
+    // of the selected layouts is minimized. Only descriptors with the implementation type selected by the greedy
+    // pass are considered, so the planning changes layouts, but never downgrades the kernels. The nodes with
+    // specific selection logic (in-place Concat and Split, graph inputs and outputs) keep their selection.
+    //
+    // The problem is solved by block coordinate descent: the graph is split into chains of nodes connected by
+    // single edges, each chain is solved exactly by dynamic programming with the layouts of its neighbours fixed,
+    // sweeps over chains are repeated until the cost stops decreasing.
+
+    // Layout order in the supported descriptors list reflects the node preferences (the greedy pass takes
+    // the first one in case of a tie), a small penalty per position keeps that preference.
+    constexpr double layoutRankPenalty = 0.05;
+    constexpr size_t maxSweeps = 5;
+
+    struct PlanningNode {
+        NodePtr node;
+        std::vector<int> candidates;
+        std::vector<double> kernelCosts;
+        bool fixed = true;
+        int next = -1;
+        int prev = -1;
+    };
+
+    std::vector<PlanningNode> planningNodes(graphNodes.size());
+    std::unordered_map<Node*, int> nodeIdx;
+    std::vector<int> choice(graphNodes.size());
+
+    for (size_t i = 0; i < graphNodes.size(); i++) {
+        const auto& node = graphNodes[i];
+        auto& pn = planningNodes[i];
+        pn.node = node;
+        nodeIdx[node.get()] = static_cast<int>(i);
+        choice[i] = node->selectedPrimitiveDescriptorIndex;
+
+        const auto* selected = node->getSelectedPrimitiveDescriptor();
+        if (!selected || node->isConstant() ||
+            one_of(node->getType(), Type::Input, Type::Output, Type::Reorder, Type::Concatenation, Type::Split,
+                   Type::MemoryInput, Type::MemoryOutput))
+            continue;
+
+        const auto& spds = node->getSupportedPrimitiveDescriptors();
+        const double outElements = node->outputShapes.empty() ? 0. : estimateElementsCount(node->outputShapes[0]);
+        for (size_t j = 0; j < spds.size(); j++) {
+            if (spds[j].getImplementationType() != selected->getImplementationType() ||
+                spds[j].getConfig().inConfs.size() != selected->getConfig().inConfs.size() ||
+                spds[j].getConfig().outConfs.size() != selected->getConfig().outConfs.size())
+                continue;
+            pn.kernelCosts.push_back(layoutRankPenalty * pn.candidates.size() * outElements);
+            pn.candidates.push_back(static_cast<int>(j));
+        }
+        pn.fixed = pn.candidates.size() < 2;
+    }
+
+    auto edgeCost = [&](const EdgePtr& edge, int parentPd, int childPd) -> double {
+        const auto parent = edge->getParent();
+        const auto child = edge->getChild();
+        // Reorders on constant paths are executed once on the compilation stage
+        if (parentPd < 0 || childPd < 0 || parent->isConstant())
+            return 0.;
+
+        const auto& parentConfig = parent->getSupportedPrimitiveDescriptors()[parentPd].getConfig();
+        const auto& childConfig = child->getSupportedPrimitiveDescriptors()[childPd].getConfig();
+        int inNum = edge->getInputNum();
+        const int outNum = edge->getOutputNum();
+        if (parentConfig.outConfs.empty() || outNum < 0 || outNum >= static_cast<int>(childConfig.inConfs.size()))
+            return 0.;
+        if (inNum < 0 || inNum >= static_cast<int>(parentConfig.outConfs.size()))
+            inNum = 0;
+
+        const auto& parentDesc = parentConfig.outConfs[inNum].getMemDesc();
+        const auto& childDesc = childConfig.inConfs[outNum].getMemDesc();
+        if (childDesc->isCompatible(*parentDesc))
+            return 0.;
+        return estimateElementsCount(parent->getOutputShapeAtPort(inNum));
+    };
+
+    auto currentEdgeCost = [&](const EdgePtr& edge) {
+        return edgeCost(edge, choice[nodeIdx.at(edge->getParent().get())], choice[nodeIdx.at(edge->getChild().get())]);
+    };
+
+    // Link nodes into chains: a node continues the chain of its parent if it is the only consumer of the parent
+    // and the parent is its only non-constant producer.
+    for (size_t i = 0; i < planningNodes.size(); i++) {
+        auto& pn = planningNodes[i];
+        if (pn.fixed || pn.node->getChildEdges().size() != 1)
+            continue;
+        const auto child = pn.node->getChildEdgeAt(0)->getChild();
+        const int childIdx = nodeIdx.at(child.get());
+        if (planningNodes[childIdx].fixed)
+            continue;
+        size_t nonConstParents = 0;
+        for (size_t j = 0; j < child->getParentEdges().size(); j++) {
+            if (!child->getParentEdgeAt(j)->getParent()->isConstant())
+                nonConstParents++;
+        }
+        if (nonConstParents == 1) {
+            pn.next = childIdx;
+            planningNodes[childIdx].prev = static_cast<int>(i);
+        }
+    }
+
+    std::vector<std::vector<int>> chains;
+    for (size_t i = 0; i < planningNodes.size(); i++) {
+        if (planningNodes[i].fixed || planningNodes[i].prev >= 0)
+            continue;
+        std::vector<int> chain;
+        for (int idx = static_cast<int>(i); idx >= 0; idx = planningNodes[idx].next) {
+            chain.push_back(idx);
+        }
+        chains.push_back(std::move(chain));
+    }
+
+    // Cost of the chain node layout, which does not depend on the other nodes of the same chain
+    auto unaryCost = [&](const std::vector<int>& chain, size_t pos, size_t candidate) {
+        const auto& pn = planningNodes[chain[pos]];
+        const int pd = pn.candidates[candidate];
+        double cost = pn.kernelCosts[candidate];
+        for (size_t j = 0; j < pn.node->getParentEdges().size(); j++) {
+            const auto edge = pn.node->getParentEdgeAt(j);
+            const int parentIdx = nodeIdx.at(edge->getParent().get());
+            if (pos > 0 && parentIdx == chain[pos - 1])
+                continue;
+            cost += edgeCost(edge, choice[parentIdx], pd);
+        }
+        for (size_t j = 0; j < pn.node->getChildEdges().size(); j++) {
+            const auto edge = pn.node->getChildEdgeAt(j);
+            const int childIdx = nodeIdx.at(edge->getChild().get());
+            if (pos + 1 < chain.size() && childIdx == chain[pos + 1])
+                continue;
+            cost += edgeCost(edge, pd, choice[childIdx]);
+        }
+        return cost;
+    };
+
+    auto solveChain = [&](const std::vector<int>& chain) {
+        // Viterbi over the chain: best[pos][k] is the minimal cost of the prefix with candidate k at pos
+        std::vector<std::vector<double>> best(chain.size());
+        std::vector<std::vector<size_t>> from(chain.size());
+        double currentCost = 0.;
+        for (size_t pos = 0; pos < chain.size(); pos++) {
+            const auto& pn = planningNodes[chain[pos]];
+            const auto numCandidates = pn.candidates.size();
+            best[pos].resize(numCandidates);
+            from[pos].resize(numCandidates, 0);
+            EdgePtr linkEdge = nullptr;
+            if (pos > 0) {
+                for (size_t j = 0; j < pn.node->getParentEdges().size(); j++) {
+                    const auto edge = pn.node->getParentEdgeAt(j);
+                    if (nodeIdx.at(edge->getParent().get()) == chain[pos - 1])
+                        linkEdge = edge;
+                }
+            }
+            for (size_t k = 0; k < numCandidates; k++) {
+                const double unary = unaryCost(chain, pos, k);
+                if (pn.candidates[k] == choice[chain[pos]]) {
+                    currentCost += unary;
+                    if (linkEdge)
+                        currentCost += currentEdgeCost(linkEdge);
+                }
+                if (pos == 0) {
+                    best[pos][k] = unary;
+                    continue;
+                }
+                const auto& prev = planningNodes[chain[pos - 1]];
+                best[pos][k] = std::numeric_limits<double>::max();
+                for (size_t p = 0; p < prev.candidates.size(); p++) {
+                    const double cost = best[pos - 1][p] + edgeCost(linkEdge, prev.candidates[p], pn.candidates[k]);
+                    if (cost < best[pos][k]) {
+                        best[pos][k] = cost;
+                        from[pos][k] = p;
+                    }
+                }
+                best[pos][k] += unary;
+            }
+        }
+
+        const auto& last = best.back();
+        size_t k = std::distance(last.begin(), std::min_element(last.begin(), last.end()));
+        // Keep the current selection unless the improvement is noticeable, that guarantees convergence
+        if (last[k] >= currentCost - 1.)
+            return false;
+        for (size_t pos = chain.size(); pos-- > 0;) {
+            choice[chain[pos]] = planningNodes[chain[pos]].candidates[k];
+            k = from[pos][k];
+        }
+        return true;
+    };
+
+#ifdef CPU_DEBUG_CAPS
+    auto totalCost = [&]() {
+        double cost = 0.;
+        for (const auto& edge : graphEdges) {
+            cost += currentEdgeCost(edge);
+        }
+        for (size_t i = 0; i < planningNodes.size(); i++) {
+            const auto& pn = planningNodes[i];
+            if (pn.fixed)
+                continue;
+            const auto it = std::find(pn.candidates.begin(), pn.candidates.end(), choice[i]);
+            cost += pn.kernelCosts[std::distance(pn.candidates.begin(), it)];
+        }
+        return cost;
+    };
+    const double initialCost = totalCost();
+#endif
+    size_t sweeps = 0;
+    for (bool improved = true; improved && sweeps < maxSweeps; sweeps++) {
+        improved = false;
+        for (const auto& chain : chains) {
+            improved |= solveChain(chain);
+        }
+    }
+
+    for (size_t i = 0; i < graphNodes.size(); i++) {
+        if (choice[i] != graphNodes[i]->selectedPrimitiveDescriptorIndex) {
+            DEBUG_LOG("Layout planning changes primitive descriptor of ", graphNodes[i]->getName(), ": ",
+                      graphNodes[i]->selectedPrimitiveDescriptorIndex, " -> ", choice[i]);
+            graphNodes[i]->selectPrimitiveDescriptorByIndex(choice[i]);
+        }
+    }
+    DEBUG_LOG("Layout planning: ", chains.size(), " chains, ", sweeps, " sweeps, estimated cost ", initialCost, " -> ", totalCost());
+}
+
 void Graph::InitOptimalPrimitiveDescriptors() {
     OV_ITT_SCOPED_TASK(itt::domains::intel_cpu, "Graph::InitOptimalPrimitiveDescriptors");
     for (auto &node : graphNodes) {
@@ -484,7 +836,7 @@ void Graph::ExtractExecutableNodes() {
     }
 }
 
-void Graph::CreatePrimitivesAndExecConstants() const {
+void Graph::CreatePrimitivesAndExecConstants() {
     OV_ITT_SCOPE(FIRST_INFERENCE, itt::domains::intel_cpu_LT, "Graph::CreatePrimitivesAndExecConstants");
     dnnl::stream stream(getEngine());
 
@@ -512,7 +864,24 @@ void Graph::CreatePrimitivesAndExecConstants() const {
         return std::make_tuple(hasExternalInvalidEdges, hasLocalAllocatedEdges, outputs);
     };
 
+    if (lazyExecutor)
+        lazyPrimitives = std::make_shared<LazyPrimitives>();
+
+    // the primitives of the constants may be created from the weights computed by the previous constants, so the
+    // constants are created and executed in order, the rest of the nodes are created in parallel after them
+    std::vector<NodePtr> parallelNodes;
     for (const auto &node : graphNodes) {
+        // the constants are executed right away, the dynamic nodes prepare their primitives on the execution
+        if (lazyPrimitives && !node->isConstant() && !node->isDynamicNode() && node->isExecutable()) {
+            lazyPrimitives->nodes.push_back(node);
+            continue;
+        }
+        // the nodes with the body graphs create the primitives of their bodies, so they are created in order
+        if (getConfig().parallelCompilation && !node->isConstant() &&
+            !one_of(node->getType(), Type::TensorIterator, Type::If)) {
+            parallelNodes.push_back(node);
+            continue;
+        }
         {
             OV_ITT_SCOPE(FIRST_INFERENCE, itt::domains::intel_cpu_LT, node->profiling.createPrimitive);
             DEBUG_LOG(*node);
@@ -536,6 +905,37 @@ void Graph::CreatePrimitivesAndExecConstants() const {
             ExecuteNode(node, stream);
         }
     }
+
+    CreatePrimitivesInParallel(parallelNodes);
+}
+
+void Graph::CreatePrimitivesInParallel(const std::vector<NodePtr>& nodes) const {
+    if (nodes.empty())
+        return;
+    OV_ITT_SCOPE(FIRST_INFERENCE, itt::domains::intel_cpu_LT, "Graph::CreatePrimitivesInParallel");
+    // the allocation policy is set for the thread of the stream only
+    const auto policy = CpuAllocator::currentPolicy();
+    std::vector<std::exception_ptr> errors(nodes.size());
+    // the creation time differs a lot from node to node, so the threads take the nodes one by one
+    std::atomic<size_t> next{0};
+    parallel_nt(0, [&](const int, const int) {
+        CpuAllocator::PolicyScope allocationScope(policy);
+        for (size_t i = next++; i < nodes.size(); i = next++) {
+            const auto& node = nodes[i];
+            try {
+                OV_ITT_SCOPE(FIRST_INFERENCE, itt::domains::intel_cpu_LT, node->profiling.createPrimitive);
+                DEBUG_LOG(*node);
+                node->createPrimitive();
+            } catch (...) {
+                errors[i] = std::current_exception();
+            }
+        }
+    });
+    // the error of the first node in the execution order is reported
+    for (const auto& error : errors) {
+        if (error)
+            std::rethrow_exception(error);
+    }
 }
 
 static bool isReorderAvailable(const MemoryDescPtr& parentDesc, const MemoryDescPtr& childDesc, const dnnl::engine& eng) {
@@ -567,6 +967,7 @@ void Graph::InitEdges() {
         uniqueLayerNames.insert(node->getName());
     }
 
+    CPU_DEBUG_CAP_ENABLE(size_t numberOfReorders = 0);
     auto insertReorder = [&](EdgePtr& edge, bool isOptimized) {
         std::string basicLayerName = edge->getParent()->getName() + "_" +
                                      node::Reorder::getReorderArgs(edge->getInputDesc(), edge->getOutputDesc()) + "_" +
@@ -581,6 +982,7 @@ void Graph::InitEdges() {
 
         // optimized flag indicate that just desc update w/o actual physical memory movement.
         InsertReorder(edge, layerName, edge->getInputDesc(), edge->getOutputDesc(), isOptimized);
+        CPU_DEBUG_CAP_ENABLE(numberOfReorders += isOptimized ? 0 : 1);
     };
 
     auto updateEdge = [&](ptrdiff_t& i) {
@@ -626,6 +1028,7 @@ void Graph::InitEdges() {
             updateEdge(i);
         }
     }
+    DEBUG_LOG("Number of inserted reorders: ", numberOfReorders);
 }
 
 static inline bool isConstOutput(EdgePtr edge) {
@@ -711,10 +1114,13 @@ void Graph::AllocateWithReuse() {
     const int64_t alignment = 32;  // 32 bytes
 
     std::vector<MemorySolver::Box> definedBoxes;
+    // dynamic shapes with the upper bounds, which are placed to the arena
+    std::vector<MemorySolver::Box> boundedBoxes;
     std::vector<MemorySolver::Box> undefinedBoxes;
     for (size_t i = 0; i < edge_clusters.size(); i++) {
         MemorySolver::Box box = {std::numeric_limits<int>::max(), 0, 0, static_cast<int64_t>(i)};
         int64_t boxSize = 0;
+        int64_t boxMaxSize = 0;
         for (auto &edge : edge_clusters[i]) {
             int e_start = edge->getParent()->execIndex;
             int e_finish = edge->getChild()->execIndex;
@@ -726,6 +1132,12 @@ void Graph::AllocateWithReuse() {
                 boxSize = -1;
             }
 
+            if (boxMaxSize != -1 && edge->hasDefinedMaxSize()) {
+                boxMaxSize = std::max(static_cast<int64_t>(edge->getDesc().getMaxMemSize()), boxMaxSize);
+            } else {
+                boxMaxSize = -1;
+            }
+
             box.start = std::min(e_start, box.start);
             box.finish = std::max(e_finish, box.finish);
         }
@@ -753,6 +1165,9 @@ void Graph::AllocateWithReuse() {
         if (boxSize != -1) {
             box.size = div_up(boxSize, alignment);
             definedBoxes.push_back(box);
+        } else if (boxMaxSize != -1) {
+            box.size = div_up(boxMaxSize, alignment);
+            boundedBoxes.push_back(box);
         } else {
             box.size = boxSize;
             undefinedBoxes.push_back(box);
@@ -791,6 +1206,27 @@ void Graph::AllocateWithReuse() {
         IE_ASSERT(count == 1);
     }
 
+    if (!boundedBoxes.empty()) {
+        /* The edges with dynamic shapes limited by the upper bounds (the intervals of the model PartialShapes)
+         * are planned for the upper bounds the same way as the static ones. The regions of the arena are never
+         * moved on the shape changes, so their lifetimes don't need to be extended around the sync points
+         * and the edges of different lifetimes share the memory. */
+        MemorySolver boundedMemSolver(boundedBoxes);
+        const size_t arenaSize = static_cast<size_t>(boundedMemSolver.solve()) * alignment;
+        auto arena = std::make_shared<MemoryArena>(arenaSize);
+        for (auto& box : boundedBoxes) {
+            const size_t offset = static_cast<size_t>(boundedMemSolver.getOffset(box.id)) * alignment;
+            auto memMngr = std::make_shared<DnnlMemoryMngr>(
+                std::unique_ptr<MemoryMngrInArena>(new MemoryMngrInArena(arena, offset, box.size * alignment)));
+            for (auto& edge : edge_clusters[box.id]) {
+                if (edge->getStatus() == Edge::Status::NeedAllocation) {
+                    edge->allocate(memMngr);
+                }
+            }
+        }
+        DEBUG_LOG("Arena of ", arenaSize, " bytes is planned for ", boundedBoxes.size(), " dynamic edge clusters");
+    }
+
     if (!undefinedBoxes.empty()) {
         if (!syncNodesInds.empty()) {
             //We have to extend the lifespan of thensors that are crossing a sync point border in order to save
@@ -989,12 +1425,12 @@ void Graph::PullOutputData(BlobMap &out) {
     }
 }
 
-void Graph::InferStatic(InferRequestBase* request) {
+void Graph::InferStatic(InferRequestBase* request, bool collectPerfCounters) {
     dnnl::stream stream(getEngine());
 
     for (const auto& node : executableGraphNodes) {
         VERBOSE(node, getConfig().debugCaps.verbose);
-        PERF(node, getConfig().collectPerfCounters);
+        PERF(node, collectPerfCounters);
 
         if (request)
             request->ThrowIfCanceled();
@@ -1198,7 +1634,7 @@ public:
 } // namespace
 
 
-void Graph::InferDynamic(InferRequestBase* request) {
+void Graph::InferDynamic(InferRequestBase* request, bool collectPerfCounters) {
     dnnl::stream stream(getEngine());
 
     std::set<size_t> syncIndsWorkSet;
@@ -1223,7 +1659,7 @@ void Graph::InferDynamic(InferRequestBase* request) {
         for (; inferCounter < stopIndx; ++inferCounter) {
             auto& node = executableGraphNodes[inferCounter];
             VERBOSE(node, getConfig().debugCaps.verbose);
-            PERF(node, getConfig().collectPerfCounters);
+            PERF(node, collectPerfCounters);
 
             if (request)
                 request->ThrowIfCanceled();
@@ -1250,10 +1686,18 @@ void Graph::Infer(InferRequestBase* request) {
         IE_THROW() << "Wrong state of the ov::intel_cpu::Graph. Topology is not ready.";
     }
 
+    // with sampling only each N-th inference is profiled to keep the overhead low on production traffic
+    const bool collectPerfCounters = getConfig().collectPerfCounters &&
+                                     perfSampleCount++ % getConfig().perfCountersSamplingRate == 0;
+
+    // the primitives, which are not created in the background yet, are created by the first inference
+    if (lazyPrimitives && lazyPrimitives->pending)
+        CreatePendingPrimitives();
+
     if (Status::ReadyDynamic == status) {
-        InferDynamic(request);
+        InferDynamic(request, collectPerfCounters);
     } else if (Status::ReadyStatic == status) {
-        InferStatic(request);
+        InferStatic(request, collectPerfCounters);
     } else {
         IE_THROW() << "Unknown ov::intel_cpu::Graph state: " << static_cast<size_t>(status);
     }
@@ -1261,6 +1705,68 @@ void Graph::Infer(InferRequestBase* request) {
     if (infer_count != -1) infer_count++;
 }
 
+void Graph::Warmup(const std::vector<std::map<std::string, ov::PartialShape>>& shapeSets) {
+    if (Status::ReadyDynamic != status || shapeSets.empty())
+        return;
+
+    // the warmup inferences would overwrite the initial values of the states
+    if (std::any_of(graphNodes.begin(), graphNodes.end(), [](const NodePtr& node) {
+            return node->getType() == Type::MemoryInput;
+        })) {
+        DEBUG_LOG("Warmup is skipped for the graph with states");
+        return;
+    }
+
+    OV_ITT_SCOPE(FIRST_INFERENCE, itt::domains::intel_cpu_LT, "Graph::Warmup");
+
+    // the warmup executes the nodes, so their primitives must not be created in the background meanwhile
+    if (lazyPrimitives && lazyPrimitives->pending)
+        CreatePendingPrimitives();
+
+    for (const auto& shapes : shapeSets) {
+        for (const bool upperBound : {false, true}) {
+            bool hasRanges = false;
+            for (const auto& input : inputNodesMap) {
+                auto shape = shapes.find(input.first);
+                if (shape == shapes.end() && shapes.size() == 1 && inputNodesMap.size() == 1)
+                    shape = shapes.find("");
+                if (shape == shapes.end()) {
+                    if (input.second->isDynamicNode())
+                        IE_THROW() << "Warmup shapes don't contain the shape of the dynamic input " << input.first;
+                    continue;
+                }
+
+                VectorDims dims;
+                for (const auto& dim : shape->second) {
+                    dims.push_back(static_cast<size_t>(upperBound ? dim.get_max_length() : dim.get_min_length()));
+                    hasRanges = hasRanges || dim.is_dynamic();
+                }
+                const auto& node = input.second;
+                if (!node->getOutputShapeAtPort(0).isCompatible(dims)) {
+                    IE_THROW() << "Warmup shape " << shape->second << " is not compatible with the shape "
+                               << node->getOutputShapeAtPort(0).toString() << " of the input " << input.first;
+                }
+                if (node->isDynamicNode())
+                    node->redefineOutputMemory({dims});
+                if (!node->getChildEdges().empty()) {
+                    auto& memory = node->getChildEdgeAt(0)->getMemory();
+                    std::memset(memory.GetData(), 0, memory.GetSize());
+                }
+            }
+
+            // zero inputs may be invalid for the data dependent nodes, such graphs are prepared partially
+            try {
+                InferDynamic(nullptr, false);
+            } catch (const std::exception& e) {
+                DEBUG_LOG("Warmup inference has failed: ", e.what());
+            }
+
+            if (!hasRanges)
+                break;
+        }
+    }
+}
+
 void Graph::VisitNode(NodePtr node, std::vector<NodePtr>& sortedNodes) {
     if (node->temporary) {
         return;
@@ -1380,6 +1886,17 @@ void Graph::GetPerfData(std::map<std::string, InferenceEngine::InferenceEnginePr
     }
 }
 
+void Graph::GetLatencyHistograms(std::map<std::string, std::pair<std::string, LatencyHistogram>> &histograms) const {
+    // fused nodes are executed as a part of the node they are fused into, so only the executable nodes are measured
+    for (const auto& node : executableGraphNodes) {
+        if (node->PerfCounter().count() == 0)
+            continue;
+        auto& entry = histograms[node->getName()];
+        entry.first = node->getTypeStr();
+        entry.second += node->PerfCounter().latency();
+    }
+}
+
 void Graph::RemoveEdge(EdgePtr& edge) {
     for (auto it = graphEdges.begin(); it != graphEdges.end(); it++) {
         if ((*it) == edge) {
@@ -1573,6 +2090,10 @@ bool Graph::InsertNode(NodePtr parent, NodePtr child, NodePtr node, int parentPo
 }
 
 // Set all non const data paths precision to BF16
+static bool isEmbeddingBag(const NodePtr& node) {
+    return one_of(node->getType(), Type::EmbeddingBagOffsetsSum, Type::EmbeddingBagPackedSum, Type::EmbeddingSegmentsSum);
+}
+
 void Graph::EnforceBF16() {
     std::function<void(const NodePtr&, std::unordered_set<NodePtr>& skipNodes)> searchForNodesToSkip;
     searchForNodesToSkip = [&](const NodePtr& node, std::unordered_set<NodePtr>& skipNodes) -> void {
@@ -1624,7 +2145,9 @@ void Graph::EnforceBF16() {
                  * and if activation is BF16 */
                 if (!(parent->getType() == Type::Input && parent->isConstant() &&
                     // Concatenation node is exception because it doesn't change an accuracy for BF16 activation
-                      node->getType() != Type::Concatenation) &&
+                      node->getType() != Type::Concatenation &&
+                    // embedding table is gathered in BF16 to halve the memory traffic
+                      !(isEmbeddingBag(node) && i == 0)) &&
                     // exclude Eltwise after Input since it supports conversion to BF16
                     !(parent->getType() == Type::Input && (node->getType() == Type::Eltwise || node->getType() == Type::Subgraph)) &&
                     node->getOriginalInputPrecisionAtPort(i) == Precision::FP32)
@@ -1639,6 +2162,85 @@ void Graph::EnforceBF16() {
     }
 }
 
+void Graph::EnforceFP16Storage() {
+    /* Nodes which load FP16 data and store results in FP16 converting the values in registers (F16C), the computations
+     * are performed in FP32. Convert goes through cpu_convert, which has the F16C conversions too.
+     * Convolution, FullyConnected and Pooling have no FP16 kernels in oneDNN on AVX2 / AVX-512 hosts, so FP16 is used
+     * only on the edges between the listed nodes and no additional Reorders appear in the graph */
+    auto isConverting = [](const NodePtr& node) {
+        return one_of(node->getType(), Type::Eltwise, Type::MVN, Type::Convert);
+    };
+    // data movement nodes which keep the input precision on the output
+    auto isPassThrough = [](const NodePtr& node) {
+        return one_of(node->getType(), Type::Reshape, Type::Concatenation, Type::Split, Type::Transpose);
+    };
+    auto dataInputsNum = [](const NodePtr& node) {
+        return one_of(node->getType(), Type::Concatenation, Type::Eltwise) ? node->getOriginalInputsNumber() : size_t(1);
+    };
+
+    std::unordered_set<NodePtr> candidates;
+    for (const auto& node : graphNodes) {
+        if (!(isConverting(node) || isPassThrough(node)) || node->isConstant())
+            continue;
+        // Convert to an integer type may still load FP16
+        if (node->getOriginalOutputPrecisionAtPort(0) == Precision::FP32 ||
+            (node->getType() == Type::Convert && node->getOriginalInputPrecisionAtPort(0) == Precision::FP32))
+            candidates.insert(node);
+    }
+
+    auto storesFP16 = [&](const NodePtr& node) {
+        if (!candidates.count(node) || node->getOriginalOutputPrecisionAtPort(0) != Precision::FP32)
+            return false;
+        const auto& childEdges = node->getChildEdges();
+        return std::all_of(childEdges.begin(), childEdges.end(), [&](const EdgeWeakPtr& edge) {
+            return candidates.count(edge.lock()->getChild()) != 0;
+        });
+    };
+
+    // Data movement nodes can't convert the precision, so they are excluded until both sides of them are FP16.
+    // Converting nodes which may be fused into a producer without FP16 support (e.g. Convolution) are excluded too.
+    bool changed = true;
+    while (changed) {
+        changed = false;
+        for (auto it = candidates.begin(); it != candidates.end();) {
+            const auto& node = *it;
+            bool keep = !isPassThrough(node) || storesFP16(node);
+            for (size_t i = 0; keep && i < dataInputsNum(node); i++) {
+                const auto parent = node->getParentEdgesAtPort(i)[0]->getParent();
+                keep = isPassThrough(node) ? storesFP16(parent) : parent->getType() == Type::Input || candidates.count(parent);
+            }
+            if (keep) {
+                ++it;
+            } else {
+                it = candidates.erase(it);
+                changed = true;
+            }
+        }
+    }
+
+    for (const auto& node : graphNodes) {
+        // constant embedding tables are gathered in FP16, the rows are converted to FP32 in the kernel
+        if (isEmbeddingBag(node) && node->getParentEdgesAtPort(0)[0]->getParent()->isConstant() &&
+            node->getOriginalInputPrecisionAtPort(0) == Precision::FP32) {
+            node->setOriginalInputPrecisionAtPort(0, Precision::FP16);
+        }
+        if (!candidates.count(node))
+            continue;
+        for (size_t i = 0; i < dataInputsNum(node); i++) {
+            if (node->getOriginalInputPrecisionAtPort(i) == Precision::FP32 &&
+                storesFP16(node->getParentEdgesAtPort(i)[0]->getParent()))
+                node->setOriginalInputPrecisionAtPort(i, Precision::FP16);
+        }
+        if (storesFP16(node)) {
+            DEBUG_LOG("#", node->getExecIndex(), " ", node->getName(), " stores FP16 activations\n");
+            for (size_t i = 0; i < node->getOriginalOutputsNumber(); i++) {
+                if (node->getOriginalOutputPrecisionAtPort(i) == Precision::FP32)
+                    node->setOriginalOutputPrecisionAtPort(i, Precision::FP16);
+            }
+        }
+    }
+}
+
 std::shared_ptr<ngraph::Function> Graph::dump() const {
     return dump_graph_as_ie_ngraph_net(*this);
 }
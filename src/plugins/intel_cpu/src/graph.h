@@ -13,10 +13,12 @@
 #include "cache/multi_cache.h"
 #include "dnnl_scratch_pad.h"
 #include "graph_context.h"
+#include "threading/ie_itask_executor.hpp"
 #include <map>
 #include <string>
 #include <vector>
 #include <memory>
+#include <mutex>
 #include <atomic>
 
 namespace ov {
@@ -49,6 +51,15 @@ public:
     template<typename NET>
     void CreateGraph(NET &network, const GraphContext::CPtr ctx);
 
+    /**
+     * Defers the creation of the primitives of the executable nodes, so the graph is ready as soon as its topology is.
+     * The primitives are created by a task of the executor in the execution order, the inference creates the remaining
+     * ones before the execution. Applies to the next CreateGraph call.
+     */
+    void EnableLazyCompilation(const InferenceEngine::ITaskExecutor::Ptr& executor) {
+        lazyExecutor = executor;
+    }
+
     void CreateGraph(const std::vector<NodePtr> &graphNodes,
                      const std::vector<EdgePtr> &graphEdges,
                      const GraphContext::CPtr ctx,
@@ -63,6 +74,13 @@ public:
 
     void Infer(InferRequestBase* request = nullptr);
 
+    /**
+     * Runs the dynamic graph on zero filled inputs once for each set of the input shapes, so the shape inference
+     * results and the executors of the nodes are created and cached before the first inference with these shapes.
+     * The ranges of the dimensions are prepared for both bounds.
+     */
+    void Warmup(const std::vector<std::map<std::string, ov::PartialShape>>& shapeSets);
+
     const std::vector<NodePtr>& GetNodes() const {
         return graphNodes;
     }
@@ -115,6 +133,16 @@ public:
 
     void GetPerfData(std::map<std::string, InferenceEngine::InferenceEngineProfileInfo> &perfMap) const;
 
+    /**
+     * @brief Accumulates latency histograms and types of the executed nodes by the node names,
+     * so the statistics of the graphs of different streams can be merged
+     */
+    void GetLatencyHistograms(std::map<std::string, std::pair<std::string, LatencyHistogram>> &histograms) const;
+
+    const PerfTrace& GetPerfTrace() const {
+        return perfTrace;
+    }
+
     void RemoveDroppedNodes();
     void RemoveDroppedEdges();
     void RemoveEdge(EdgePtr& edge);
@@ -194,6 +222,7 @@ protected:
     void VisitNode(NodePtr node, std::vector<NodePtr>& sortedNodes);
 
     void ForgetGraphData() {
+        StopLazyCompilation();
         status = Status::NotReady;
 
         inputNodesMap.clear();
@@ -202,6 +231,7 @@ protected:
         graphEdges.clear();
         _normalizePreprocMap.clear();
         syncNodesInds.clear();
+        perfTrace.clear();
     }
     Status status { Status::NotReady };
 
@@ -209,6 +239,10 @@ protected:
     // values mean increment it within each Infer() call
     int infer_count = -1;
 
+    // Number of Infer() calls, used to profile only each N-th inference with sampling enabled
+    uint64_t perfSampleCount = 0;
+    PerfTrace perfTrace;
+
     bool reuse_io_tensors = true;
 
     MemoryPtr memWorkspace;
@@ -226,15 +260,19 @@ protected:
     void InitGraph();
     void InitNodes();
     void InitDescriptors();
+    void PlanLayouts();
     void InitOptimalPrimitiveDescriptors();
     void InitEdges();
     void Allocate();
     void AllocateWithReuse();
     void ExtractExecutableNodes();
     void ExecuteNode(const NodePtr& node, const dnnl::stream& stream) const;
-    void CreatePrimitivesAndExecConstants() const;
-    void InferStatic(InferRequestBase* request);
-    void InferDynamic(InferRequestBase* request);
+    void CreatePrimitivesAndExecConstants();
+    void CreatePrimitivesInParallel(const std::vector<NodePtr>& nodes) const;
+    void CreatePendingPrimitives();
+    void StopLazyCompilation();
+    void InferStatic(InferRequestBase* request, bool collectPerfCounters);
+    void InferDynamic(InferRequestBase* request, bool collectPerfCounters);
 
     friend class LegacyInferRequest;
     friend class intel_cpu::InferRequest;
@@ -255,7 +293,27 @@ private:
 
     GraphContext::CPtr context;
 
+    // The nodes, which primitives are created lazily. The state is shared with the background task,
+    // since the task may start after the graph is destroyed.
+    struct LazyPrimitives {
+        // held by the background task or by the inference, while they create the primitives
+        std::mutex mutex;
+        // in the execution order
+        std::vector<NodePtr> nodes;
+        std::vector<char> created;
+        std::atomic<bool> pending{false};
+        // the inference takes over the creation, so the background task stops after the nodes in progress
+        std::atomic<bool> interrupted{false};
+
+        // creates the primitives, which are not created yet, with the threads of the caller's arena, the background
+        // creation leaves the failed nodes to the inference, which reports the error
+        void createRemaining(bool background);
+    };
+    std::shared_ptr<LazyPrimitives> lazyPrimitives;
+    InferenceEngine::ITaskExecutor::Ptr lazyExecutor;
+
     void EnforceBF16();
+    void EnforceFP16Storage();
 };
 
 }   // namespace intel_cpu
@@ -21,6 +21,7 @@
 #include "nodes/reduce.h"
 #include "nodes/input.h"
 #include "nodes/rnn.h"
+#include "nodes/embedding_bag_sum.h"
 #include "nodes/common/cpu_convert.h"
 
 #include "onednn/dnnl.h"
@@ -66,6 +67,9 @@ void GraphOptimizer::ApplyCommonGraphOptimizations(Graph &graph) {
     FuseConvMatmulFCDeconvAndDQScales(graph);
     graph.RemoveDroppedNodes();
 
+    FuseEmbeddingBagAndTableDecompression(graph);
+    graph.RemoveDroppedNodes();
+
     OV_ITT_SCOPE_CHAIN(FIRST_INFERENCE, taskChain, itt::domains::intel_cpu_LT, "ApplyCommonGraphOptimizations", "FuseConvolutionAndBias");
     FuseConvolutionMatMulDeconvAndBias(graph);
     graph.RemoveDroppedNodes();
@@ -297,6 +301,83 @@ void GraphOptimizer::FuseConvMatmulFCDeconvAndDQScales(Graph &graph) {
     }
 }
 
+void GraphOptimizer::FuseEmbeddingBagAndTableDecompression(Graph &graph) {
+    if (!EmbeddingBagSum::isJitKernelSupported())
+        return;
+
+    auto& graphNodes = graph.GetNodes();
+
+    // Returns the constant with per-row FP32 values of the dequantization operation
+    auto getDecompressionConstant = [](const NodePtr& eltwise, Algorithm algorithm, const Shape& tableShape) -> NodePtr {
+        if (eltwise->getType() != Type::Eltwise || eltwise->getAlgorithm() != algorithm ||
+            eltwise->getParentEdges().size() != 2 || eltwise->getChildEdges().size() != 1 ||
+            !eltwise->getFusedWith().empty())
+            return nullptr;
+        const auto constant = eltwise->getParentEdgesAtPort(1)[0]->getParent();
+        if (constant->getType() != Type::Input || !constant->isConstant() ||
+            constant->getOriginalOutputPrecisionAtPort(0) != Precision::FP32)
+            return nullptr;
+        const auto& shape = constant->getOutputShapeAtPort(0);
+        const bool perRow = shape.getRank() == tableShape.getRank() && shape.getDims()[0] == tableShape.getDims()[0] &&
+                            shape.getElementsCount() == tableShape.getDims()[0];
+        return perRow ? constant : nullptr;
+    };
+
+    auto getConstantData = [](const NodePtr& constant) {
+        auto input = std::dynamic_pointer_cast<node::Input>(constant);
+        if (input == nullptr)
+            IE_THROW() << "Cannot cast " << constant->getName() << " to Input node";
+        return static_cast<const float*>(input->getMemoryPtr()->GetPtr());
+    };
+
+    for (const auto& node : graphNodes) {
+        const auto embeddingBag = std::dynamic_pointer_cast<EmbeddingBagSum>(node);
+        if (!embeddingBag || !node->getInputShapeAtPort(0).isStatic())
+            continue;
+        const auto& tableShape = node->getInputShapeAtPort(0);
+
+        // Const[U8/I8] -> Convert -> [Subtract(zero point)] -> Multiply(scale) -> EmbeddingBag
+        const auto multiply = node->getParentEdgesAtPort(0)[0]->getParent();
+        const auto scales = getDecompressionConstant(multiply, Algorithm::EltwiseMultiply, tableShape);
+        if (!scales)
+            continue;
+        auto convert = multiply->getParentEdgesAtPort(0)[0]->getParent();
+        NodePtr subtract, zeroPoints;
+        if (convert->getType() == Type::Eltwise) {
+            subtract = convert;
+            zeroPoints = getDecompressionConstant(subtract, Algorithm::EltwiseSubtract, tableShape);
+            if (!zeroPoints)
+                continue;
+            convert = subtract->getParentEdgesAtPort(0)[0]->getParent();
+        }
+        if (convert->getType() != Type::Convert || convert->getChildEdges().size() != 1)
+            continue;
+        const auto table = convert->getParentEdgesAtPort(0)[0]->getParent();
+        const auto tablePrecision = table->getOriginalOutputPrecisionAtPort(0);
+        if (table->getType() != Type::Input || !table->isConstant() ||
+            !one_of(tablePrecision, Precision::U8, Precision::I8))
+            continue;
+
+        CPU_GRAPH_OPTIMIZER_SCOPE(FuseEmbeddingBagAndTableDecompression);
+
+        embeddingBag->fuseTableDecompression(getConstantData(scales),
+                                             zeroPoints ? getConstantData(zeroPoints) : nullptr,
+                                             tableShape.getDims()[0]);
+        node->setOriginalInputPrecisionAtPort(0, tablePrecision);
+
+        for (const auto& eltwise : {multiply, subtract}) {
+            if (!eltwise)
+                continue;
+            node->addOriginalLayer(eltwise->getOriginalLayers());
+            auto constEdge = eltwise->getParentEdgesAtPort(1)[0];
+            graph.RemoveEdge(constEdge);
+            graph.DropNode(eltwise);
+        }
+        node->addOriginalLayer(convert->getOriginalLayers());
+        graph.DropNode(convert);
+    }
+}
+
 void GraphOptimizer::FuseConvolutionMatMulDeconvAndBias(Graph &graph) {
     auto& graphNodes = graph.GetNodes();
 
@@ -7,6 +7,7 @@
 #include <vector>
 #include <string>
 #include <map>
+#include <cstring>
 #include <blob_factory.hpp>
 #include "nodes/concat.h"
 #include "nodes/split.h"
@@ -35,7 +36,7 @@ void InferRequestBase::CreateInferRequest() {
 
     if (execNetwork->_graphs.size() == 0)
         IE_THROW() << "No graph was found";
-    graph = &(execNetwork->GetGraph()._graph);
+    graph = &((batchedGraph ? execNetwork->GetBatchedGraph() : execNetwork->GetGraph())._graph);
 
     initBlobs();
 
@@ -92,6 +93,10 @@ void InferRequestBase::pushInput(const std::string& inputName, InferenceEngine::
     graph->PushInputData(inputName, needConvert ? iconv : inputBlob);
 }
 
+InferenceEngine::Blob::Ptr InferRequestBase::makeBlob(const InferenceEngine::TensorDesc& desc) const {
+    return make_blob_with_precision(desc, execNetwork->_ioAllocator);
+}
+
 void InferRequestBase::PushStates() {
     for (auto &node : graph->GetNodes()) {
         if (node->getType() == Type::MemoryInput) {
@@ -152,7 +157,14 @@ void InferRequestBase::redefineMemoryForInputNodes() {
 void InferRequestBase::InferImpl() {
     using namespace openvino::itt;
     OV_ITT_SCOPED_TASK(itt::domains::intel_cpu, profilingTask);
-    auto graphLock = execNetwork->GetGraph();
+    // the cores are shared with the other compiled models, so the inference waits for them before the graph is locked
+    auto coresLease = execNetwork->AcquireCores();
+    // the buffers of the dynamic shapes are reallocated during the inference, they are not prefaulted
+    // since committing the whole buffer would add its page faults to the latency of the request
+    auto allocationPolicy = execNetwork->GetAllocationPolicy();
+    allocationPolicy.prefault = false;
+    CpuAllocator::PolicyScope allocationScope(allocationPolicy);
+    auto graphLock = batchedGraph ? execNetwork->GetBatchedGraph() : execNetwork->GetGraph();
     graph = &(graphLock._graph);
 
     ThrowIfCanceled();
@@ -185,6 +197,100 @@ void InferRequestBase::InferImpl() {
     graph->PullOutputData(_outputs);
 }
 
+namespace {
+// the batch is the outermost dimension of the plain layouts, so the row of a sequence is a contiguous block
+void copyRow(const InferenceEngine::Blob::Ptr& batched, const InferenceEngine::Blob::Ptr& row, size_t index, bool toBatch) {
+    const auto& batchedDesc = batched->getTensorDesc();
+    const size_t rowSize = row->byteSize();
+    if (batchedDesc.getPrecision() != row->getTensorDesc().getPrecision() || batchedDesc.getDims().empty() ||
+        rowSize * batchedDesc.getDims()[0] != batched->byteSize() || index >= batchedDesc.getDims()[0]) {
+        IE_THROW() << "The blob of the sequence doesn't match the row of the batch";
+    }
+    auto batchedData = batched->buffer().as<uint8_t*>() + rowSize * index;
+    auto rowData = row->buffer().as<uint8_t*>();
+    if (toBatch) {
+        cpu_memcpy(batchedData, rowData, rowSize);
+    } else {
+        cpu_memcpy(rowData, batchedData, rowSize);
+    }
+}
+
+// the rows of the batch starting from the index are not used by the sequences of the step
+void zeroRows(const InferenceEngine::Blob::Ptr& batched, size_t index) {
+    const auto& dims = batched->getTensorDesc().getDims();
+    if (dims.empty() || index >= dims[0])
+        return;
+    const size_t rowSize = batched->byteSize() / dims[0];
+    std::memset(batched->buffer().as<uint8_t*>() + rowSize * index, 0, rowSize * (dims[0] - index));
+}
+
+InferenceEngine::Blob::Ptr findBlob(const InferenceEngine::BlobMap& blobs, const std::string& name) {
+    auto blob = blobs.find(name);
+    if (blob == blobs.end())
+        IE_THROW() << "The sequence has no blob with name: " << name;
+    return blob->second;
+}
+
+InferenceEngine::Blob::Ptr findState(const std::vector<InferenceEngine::IVariableStateInternal::Ptr>& states,
+                                     const std::string& name) {
+    for (const auto& state : states) {
+        if (state->GetName() == name)
+            return std::const_pointer_cast<InferenceEngine::Blob>(state->GetState());
+    }
+    IE_THROW() << "The sequence has no state with name: " << name;
+}
+}   // namespace
+
+void InferRequestBase::InferSequences(const std::vector<InferRequestBase*>& sequences) {
+    for (size_t i = 0; i < sequences.size(); i++) {
+        for (const auto& input : _inputs)
+            copyRow(input.second, findBlob(sequences[i]->_inputs, input.first), i, true);
+        for (const auto& state : memoryStates) {
+            copyRow(std::const_pointer_cast<InferenceEngine::Blob>(state->GetState()),
+                    findState(sequences[i]->memoryStates, state->GetName()), i, true);
+        }
+    }
+
+    // the data of the previous steps is not left in the rows, which are not used by the sequences
+    for (const auto& input : _inputs)
+        zeroRows(input.second, sequences.size());
+    for (const auto& state : memoryStates)
+        zeroRows(std::const_pointer_cast<InferenceEngine::Blob>(state->GetState()), sequences.size());
+
+    InferImpl();
+
+    for (size_t i = 0; i < sequences.size(); i++) {
+        for (const auto& output : _outputs)
+            copyRow(output.second, findBlob(sequences[i]->_outputs, output.first), i, false);
+        for (const auto& state : memoryStates) {
+            copyRow(std::const_pointer_cast<InferenceEngine::Blob>(state->GetState()),
+                    findState(sequences[i]->memoryStates, state->GetName()), i, false);
+        }
+    }
+}
+
+bool InferRequestBase::IsBatchable() const {
+    if (!_batched_inputs.empty())
+        return false;
+    auto isPlain = [](const InferenceEngine::Blob::Ptr& blob) -> bool {
+        if (!blob || blob->is<InferenceEngine::CompoundBlob>())
+            return false;
+        const auto& desc = blob->getTensorDesc();
+        const auto& dims = desc.getDims();
+        return !dims.empty() &&
+               desc.getBlockingDesc() ==
+                   InferenceEngine::TensorDesc(desc.getPrecision(), dims, InferenceEngine::TensorDesc::getLayoutByRank(dims.size()))
+                       .getBlockingDesc();
+    };
+    for (const auto& blobs : {&_inputs, &_outputs}) {
+        for (const auto& blob : *blobs) {
+            if (!isPlain(blob.second))
+                return false;
+        }
+    }
+    return true;
+}
+
 std::map<std::string, InferenceEngine::InferenceEngineProfileInfo> InferRequestBase::GetPerformanceCounts() const {
     if (!graph || !graph->IsReady())
         IE_THROW() << "Graph is not ready!";
@@ -510,7 +616,7 @@ InferenceEngine::Blob::Ptr LegacyInferRequest::GetBlob(const std::string& name)
                 desc = InferenceEngine::TensorDesc(p, dims, l);
             }
 
-            _inputs[name] = make_blob_with_precision(desc);
+            _inputs[name] = makeBlob(desc);
             _inputs[name]->allocate();
             if (pBlob->getTensorDesc() == desc &&
                 graph->_normalizePreprocMap.find(name) == graph->_normalizePreprocMap.end()) {
@@ -552,7 +658,7 @@ InferenceEngine::Blob::Ptr LegacyInferRequest::GetBlob(const std::string& name)
                 auto currBlockDesc = InferenceEngine::BlockingDesc(desc.getBlockingDesc().getBlockDims(), desc.getBlockingDesc().getOrder());
                 desc = InferenceEngine::TensorDesc(desc.getPrecision(), desc.getDims(), currBlockDesc);
 
-                data = make_blob_with_precision(desc);
+                data = makeBlob(desc);
                 data->allocate();
             } else {
                 const auto& expectedTensorDesc = pBlobDesc;
@@ -609,8 +715,9 @@ void LegacyInferRequest::PushInputData() {
 /* ========================================== InferRequest ========================================== */
 InferRequest::InferRequest(const std::vector<std::shared_ptr<const ov::Node>>& inputs,
                            const std::vector<std::shared_ptr<const ov::Node>>& outputs,
-                           ExecNetwork::Ptr execNetwork)
-: InferRequestBase(inputs, outputs, execNetwork) {
+                           ExecNetwork::Ptr execNetwork,
+                           bool batchedGraph)
+: InferRequestBase(inputs, outputs, execNetwork, batchedGraph) {
     for (const std::shared_ptr<const ov::Node>& in : inputs) {
         modelInputsMap[ov::op::util::get_ie_output_name(ngraph::Output<const ngraph::Node>(in))] = in;
     }
@@ -767,7 +874,7 @@ InferenceEngine::Blob::Ptr InferRequest::GetBlob(const std::string& name) {
                 InferenceEngine::TensorDesc desc(InferenceEngine::details::convertPrecision(inputNode->second->get_output_element_type(0)),
                                                  dims, InferenceEngine::TensorDesc::getLayoutByRank(dims.size()));
 
-                _inputs[name] = make_blob_with_precision(desc);
+                _inputs[name] = makeBlob(desc);
                 _inputs[name]->allocate();
 
                 if (!isDynamic &&
@@ -802,7 +909,7 @@ InferenceEngine::Blob::Ptr InferRequest::GetBlob(const std::string& name) {
                     InferenceEngine::TensorDesc desc(InferenceEngine::details::convertPrecision(outputNode->second->get_input_element_type(0)),
                                                      dims, InferenceEngine::TensorDesc::getLayoutByRank(dims.size()));
 
-                    data = make_blob_with_precision(desc);
+                    data = makeBlob(desc);
                     data->allocate();
                 } else {
                     const auto& blobDims = data->getTensorDesc().getDims();
@@ -37,6 +37,15 @@ public:
      */
     void ThrowIfCanceled() const;
 
+    /**
+     * @brief Executes the current inputs and states of the requests of the sequences as one inference of this request,
+     * which must be created on the batched graph. Each sequence occupies the row of the batch with its index.
+     */
+    void InferSequences(const std::vector<InferRequestBase*>& sequences);
+
+    // the I/O blobs of the request are dense and plain, so they can be copied into a row of the batch
+    bool IsBatchable() const;
+
 protected:
     InferRequestBase(InferenceEngine::InputsDataMap networkInputs,
                      InferenceEngine::OutputsDataMap networkOutputs,
@@ -45,12 +54,15 @@ protected:
 
     InferRequestBase(const std::vector<std::shared_ptr<const ov::Node>>& inputs,
                      const std::vector<std::shared_ptr<const ov::Node>>& outputs,
-                     std::shared_ptr<ExecNetwork> execNetwork_)
-    : IInferRequestInternal(inputs, outputs), execNetwork(execNetwork_) {}
+                     std::shared_ptr<ExecNetwork> execNetwork_,
+                     bool batchedGraph_ = false)
+    : IInferRequestInternal(inputs, outputs), execNetwork(execNetwork_), batchedGraph(batchedGraph_) {}
 
     void CreateInferRequest();
     InferenceEngine::Precision normToInputSupportedPrec(const std::pair<const std::string, InferenceEngine::Blob::Ptr>& input) const;
     void pushInput(const std::string& inputName, InferenceEngine::Blob::Ptr& inputBlob, InferenceEngine::Precision dataType);
+    // creates the I/O blob placed according to the memory properties of the compiled model
+    InferenceEngine::Blob::Ptr makeBlob(const InferenceEngine::TensorDesc& desc) const;
 
     virtual void initBlobs() = 0;
     virtual void PushInputData() = 0;
@@ -64,6 +76,8 @@ private:
     void redefineMemoryForInputNodes();
 
     std::shared_ptr<ExecNetwork>        execNetwork;
+    // the request executes the batched graph of the continuous batching
+    const bool                          batchedGraph = false;
     openvino::itt::handle_t             profilingTask;
     std::vector<std::shared_ptr<InferenceEngine::IVariableStateInternal>> memoryStates;
     AsyncInferRequest*                  _asyncRequest = nullptr;
@@ -91,7 +105,8 @@ class InferRequest : public InferRequestBase {
 public:
     InferRequest(const std::vector<std::shared_ptr<const ov::Node>>& inputs,
                  const std::vector<std::shared_ptr<const ov::Node>>& outputs,
-                 std::shared_ptr<ExecNetwork> execNetwork);
+                 std::shared_ptr<ExecNetwork> execNetwork,
+                 bool batchedGraph = false);
 
     void SetBlob(const std::string& name, const InferenceEngine::Blob::Ptr &data) override;
     void SetBlobsImpl(const std::string& name, const InferenceEngine::BatchedBlob::Ptr& batched_blob) override;
@@ -10,6 +10,7 @@
 #include <dnnl_extension_utils.h>
 #include "cpu_memcpy.h"
 #include "utils/bfloat16.hpp"
+#include "cache/jit_kernel_registry.h"
 
 #include "cpu/x64/jit_generator.hpp"
 #include <common/primitive_hashing_utils.hpp>
@@ -261,18 +262,24 @@ void PermuteKernel::prepareParams() {
     jcp.ndims = sorted_order.size();
     jcp.data_size = params.data_size;
 
+    auto builder = [](const jit_permute_config_params& jcp) -> std::shared_ptr<jit_uni_permute_kernel> {
+        std::shared_ptr<jit_uni_permute_kernel> kernel;
 #if defined(OPENVINO_ARCH_X86_64)
-    if (mayiuse(cpu::x64::avx512_core)) {
-        permute_kernel.reset(new jit_uni_permute_kernel_f32<cpu::x64::avx512_core>(jcp));
-    } else if (mayiuse(cpu::x64::avx2)) {
-        permute_kernel.reset(new jit_uni_permute_kernel_f32<cpu::x64::avx2>(jcp));
-    } else if (mayiuse(cpu::x64::sse41)) {
-        permute_kernel.reset(new jit_uni_permute_kernel_f32<cpu::x64::sse41>(jcp));
-    }
+        if (mayiuse(cpu::x64::avx512_core)) {
+            kernel.reset(new jit_uni_permute_kernel_f32<cpu::x64::avx512_core>(jcp));
+        } else if (mayiuse(cpu::x64::avx2)) {
+            kernel.reset(new jit_uni_permute_kernel_f32<cpu::x64::avx2>(jcp));
+        } else if (mayiuse(cpu::x64::sse41)) {
+            kernel.reset(new jit_uni_permute_kernel_f32<cpu::x64::sse41>(jcp));
+        }
 #endif // OPENVINO_ARCH_X86_64
 
-    if (permute_kernel)
-        permute_kernel->create_ker();
+        if (kernel)
+            kernel->create_ker();
+        return kernel;
+    };
+    // the identical kernels of the nodes, the graphs and the streams are generated once
+    permute_kernel = JitKernelRegistry::instance().getOrCreate<jit_uni_permute_kernel>(jcp, builder);
 }
 
 void PermuteKernel::execute(const uint8_t* src_data, uint8_t* dst_data, const int mb) {
@@ -419,5 +426,29 @@ bool PermuteParams::operator==(const PermuteParams& rhs) const {
            (data_size == rhs.data_size);
 }
 
+size_t jit_permute_config_params::hash() const {
+    using namespace dnnl::impl;
+    using namespace dnnl::impl::primitive_hashing;
+
+    size_t seed = 0;
+    seed = hash_combine(seed, ndims);
+    seed = get_vector_hash(seed, dst_block_dims);
+    seed = get_vector_hash(seed, src_strides);
+    seed = get_vector_hash(seed, dst_strides);
+    seed = hash_combine(seed, n);
+    seed = hash_combine(seed, data_size);
+    seed = hash_combine(seed, supported_dynamic_batch);
+    return seed;
+}
+
+bool jit_permute_config_params::operator==(const jit_permute_config_params& rhs) const {
+    return (ndims == rhs.ndims) &&
+           (dst_block_dims == rhs.dst_block_dims) &&
+           (src_strides == rhs.src_strides) &&
+           (dst_strides == rhs.dst_strides) &&
+           (n == rhs.n) && (data_size == rhs.data_size) &&
+           (supported_dynamic_batch == rhs.supported_dynamic_batch);
+}
+
 }   // namespace intel_cpu
 }   // namespace ov
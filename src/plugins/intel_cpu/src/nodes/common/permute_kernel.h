@@ -32,6 +32,9 @@ struct jit_permute_config_params {
     int data_size;
 
     bool supported_dynamic_batch = false;
+
+    size_t hash() const;
+    bool operator==(const jit_permute_config_params& rhs) const;
 };
 
 struct jit_args_permute {
@@ -30,6 +30,7 @@
 #include <selective_build.h>
 #include "utils/general_utils.h"
 #include "utils/cpu_utils.hpp"
+#include "cache/jit_kernel_registry.h"
 #include <common/primitive_hashing_utils.hpp>
 
 #include "ngraph/ngraph.hpp"
@@ -697,6 +698,9 @@ private:
                     vpmovzxwd(vmm_src, op);
                     uni_vpslld(vmm_src, vmm_src, 16);
                     break;
+                case Precision::FP16:
+                    vcvtph2ps(vmm_src, op);
+                    break;
                 case Precision::U16:
                     uni_vpmovzxwd(vmm_src, op);
                     break;
@@ -715,11 +719,11 @@ private:
 
             switch (dst_prc) {
                 case Precision::FP32:
-                    if (src_prc != Precision::FP32 && src_prc != Precision::BF16)
+                    if (!one_of(src_prc, Precision::FP32, Precision::BF16, Precision::FP16))
                         uni_vcvtdq2ps(vmm_src, vmm_src);
                     break;
                 case Precision::I32:
-                    if (src_prc == Precision::FP32 || src_prc == Precision::BF16)
+                    if (one_of(src_prc, Precision::FP32, Precision::BF16, Precision::FP16))
                         uni_vcvtps2dq(vmm_src, vmm_src);
                     break;
                 default:
@@ -738,6 +742,10 @@ private:
                 uni_vpinsrw(xmm_src, xmm_src, op, 0);
                 uni_vpslld(xmm_src, xmm_src, 16);
                 break;
+            case Precision::FP16:
+                uni_vpinsrw(xmm_src, xmm_src, op, 0);
+                vcvtph2ps(xmm_src, xmm_src);
+                break;
             case Precision::I16:
                 uni_vpinsrw(xmm_src, xmm_src, op, 0);
                 uni_vpmovsxwd(xmm_src, op);
@@ -760,11 +768,11 @@ private:
 
         switch (dst_prc) {
             case Precision::FP32:
-                if (src_prc != Precision::FP32 && src_prc != Precision::BF16)
+                if (!one_of(src_prc, Precision::FP32, Precision::BF16, Precision::FP16))
                     uni_vcvtdq2ps(xmm_src, xmm_src);
                 break;
             case Precision::I32:
-                if (src_prc == Precision::FP32 || src_prc == Precision::BF16)
+                if (one_of(src_prc, Precision::FP32, Precision::BF16, Precision::FP16))
                     uni_vcvtps2dq(xmm_src, xmm_src);
                 break;
             default:
@@ -778,11 +786,11 @@ private:
 
         switch (src_prc) {
             case Precision::FP32:
-                if (dst_prc != Precision::FP32 && dst_prc != Precision::BF16)
+                if (!one_of(dst_prc, Precision::FP32, Precision::BF16, Precision::FP16))
                     uni_vcvtps2dq(vmm_dst, vmm_dst);
                 break;
             case Precision::I32:
-                if (dst_prc == Precision::FP32 || dst_prc == Precision::BF16)
+                if (one_of(dst_prc, Precision::FP32, Precision::BF16, Precision::FP16))
                     uni_vcvtdq2ps(vmm_dst, vmm_dst);
                 break;
             default:
@@ -798,6 +806,9 @@ private:
                 uni_vcvtneps2bf16->emit_code({static_cast<size_t>(vmm_dst.getIdx())}, {static_cast<size_t>(ymm_dst.getIdx())});
                 vmovdqu16(op, ymm_dst);
                 break;
+            case Precision::FP16:
+                vcvtps2ph(op, vmm_dst, 0x4);
+                break;
             case Precision::I16:
                 if (isa == x64::avx512_core) {
                     vpmovsdw(op, vmm_dst);
@@ -862,11 +873,11 @@ private:
     inline void store_scalar(const Xbyak::Address &op, Xmm xmm_dst, Precision src_prc, Precision dst_prc) {
         switch (src_prc) {
             case Precision::FP32:
-                if (dst_prc != Precision::FP32 && dst_prc != Precision::BF16)
+                if (!one_of(dst_prc, Precision::FP32, Precision::BF16, Precision::FP16))
                     uni_vcvtps2dq(xmm_dst, xmm_dst);
                 break;
             case Precision::I32:
-                if (dst_prc == Precision::FP32 || dst_prc == Precision::BF16)
+                if (one_of(dst_prc, Precision::FP32, Precision::BF16, Precision::FP16))
                     uni_vcvtdq2ps(xmm_dst, xmm_dst);
                 break;
             default:
@@ -882,6 +893,10 @@ private:
                 uni_vpsrld(xmm_dst, xmm_dst, 16);
                 uni_vpextrw(op, xmm_dst, 0x0);
                 break;
+            case Precision::FP16:
+                vcvtps2ph(xmm_dst, xmm_dst, 0x4);
+                uni_vpextrw(op, xmm_dst, 0x0);
+                break;
             case Precision::I16:
                 uni_vpackssdw(xmm_dst, xmm_dst, xmm_dst);
                 movq(reg_tmp_64, xmm_dst);
@@ -1285,6 +1300,68 @@ struct EltwiseKey {
     }
 };
 
+// the configuration the code of the jit eltwise kernel is generated for
+struct EltwiseKernelKey {
+    jit_eltwise_params jep;
+    std::vector<Eltwise::EltwiseData> eltwise_data;
+    std::vector<Type> ops_list;
+    dnnl::post_ops postOps;
+
+    size_t hash() const {
+        using namespace dnnl::impl;
+        using namespace dnnl::impl::primitive_hashing;
+        size_t seed = 0;
+        seed = hash_combine(seed, jep.inputs_number);
+        seed = hash_combine(seed, jep.input_size);
+        for (size_t i = 0; i < jep.inputs_number; i++) {
+            seed = hash_combine(seed, jep.src_prc[i].getPrecVal());
+            seed = get_vector_hash(seed, jep.src_offsets[i]);
+            seed = hash_combine(seed, jep.src_size[i]);
+        }
+        seed = hash_combine(seed, jep.dst_prc.getPrecVal());
+        seed = get_vector_hash(seed, jep.dims);
+        seed = get_vector_hash(seed, jep.dst_offsets);
+        seed = get_vector_hash(seed, jep.oc_offsets);
+        seed = hash_combine(seed, jep.dst_size);
+        seed = hash_combine(seed, jep.oc_size);
+        seed = hash_combine(seed, jep.work_amount);
+        seed = hash_combine(seed, jep.use_runtime_ptrs);
+        for (const auto& item : eltwise_data) {
+            seed = hash_combine(seed, item.algo);
+            seed = hash_combine(seed, item.onednnAlgorithm);
+            seed = hash_combine(seed, item.alpha);
+            seed = hash_combine(seed, item.beta);
+            seed = hash_combine(seed, item.gamma);
+        }
+        seed = get_vector_hash(seed, ops_list);
+        seed = get_post_op_hash(seed, *postOps.get());
+        return seed;
+    }
+
+    bool operator==(const EltwiseKernelKey& rhs) const {
+        if (jep.inputs_number != rhs.jep.inputs_number)
+            return false;
+        for (size_t i = 0; i < jep.inputs_number; i++) {
+            if (jep.src_prc[i] != rhs.jep.src_prc[i] ||
+                jep.src_offsets[i] != rhs.jep.src_offsets[i] ||
+                jep.src_size[i] != rhs.jep.src_size[i])
+                return false;
+        }
+        return jep.input_size == rhs.jep.input_size &&
+               jep.dst_prc == rhs.jep.dst_prc &&
+               jep.dims == rhs.jep.dims &&
+               jep.dst_offsets == rhs.jep.dst_offsets &&
+               jep.oc_offsets == rhs.jep.oc_offsets &&
+               jep.dst_size == rhs.jep.dst_size &&
+               jep.oc_size == rhs.jep.oc_size &&
+               jep.work_amount == rhs.jep.work_amount &&
+               jep.use_runtime_ptrs == rhs.jep.use_runtime_ptrs &&
+               eltwise_data == rhs.eltwise_data &&
+               ops_list == rhs.ops_list &&
+               *postOps.get() == *rhs.postOps.get();
+    }
+};
+
 class EltwiseJitExecutor : public Eltwise::IEltwiseExecutor {
 public:
     static void offset_out_calc(VectorDims& offset, const VectorDims& dims) {
@@ -1499,19 +1576,26 @@ public:
         std::transform(jep.oc_offsets.begin(), jep.oc_offsets.end(), jep.oc_offsets.begin(),
                        [](size_t& offset) { return offset * sizeof(float);});
 
+        auto builder = [](const EltwiseKernelKey& key) -> std::shared_ptr<jit_uni_eltwise_kernel> {
+            std::shared_ptr<jit_uni_eltwise_kernel> kernel;
 #if defined(OPENVINO_ARCH_X86_64)
-        if (mayiuse(x64::avx512_core)) {
-            _pKernel.reset(new jit_uni_eltwise_generic<x64::avx512_core>(jep, eltwise_data, ops_list, post_ops));
-        } else if (mayiuse(x64::avx2)) {
-            _pKernel.reset(new jit_uni_eltwise_generic<x64::avx2>(jep, eltwise_data, ops_list, post_ops));
-        } else if (mayiuse(x64::sse41)) {
-            _pKernel.reset(new jit_uni_eltwise_generic<x64::sse41>(jep, eltwise_data, ops_list, post_ops));
-        } else {
-            IE_THROW() << "Can't create jit eltwise kernel";
-        }
+            if (mayiuse(x64::avx512_core)) {
+                kernel.reset(new jit_uni_eltwise_generic<x64::avx512_core>(key.jep, key.eltwise_data, key.ops_list, key.postOps));
+            } else if (mayiuse(x64::avx2)) {
+                kernel.reset(new jit_uni_eltwise_generic<x64::avx2>(key.jep, key.eltwise_data, key.ops_list, key.postOps));
+            } else if (mayiuse(x64::sse41)) {
+                kernel.reset(new jit_uni_eltwise_generic<x64::sse41>(key.jep, key.eltwise_data, key.ops_list, key.postOps));
+            } else {
+                IE_THROW() << "Can't create jit eltwise kernel";
+            }
 #endif // OPENVINO_ARCH_X86_64
-        if (_pKernel)
-            _pKernel->create_ker();
+            if (kernel)
+                kernel->create_ker();
+            return kernel;
+        };
+        // the identical kernels of the nodes, the graphs and the streams are generated once
+        _pKernel = JitKernelRegistry::instance().getOrCreate<jit_uni_eltwise_kernel>(
+            EltwiseKernelKey{jep, eltwise_data, ops_list, post_ops}, builder);
     }
 
     void exec(const jit_eltwise_call_args_ptrs &args_ptrs, const VectorDims &dims_out) override {
@@ -1571,7 +1655,7 @@ public:
     }
 
 private:
-    std::unique_ptr<jit_uni_eltwise_kernel> _pKernel;
+    std::shared_ptr<jit_uni_eltwise_kernel> _pKernel;
     size_t _schedulerWorkAmount = 0;
     size_t _batchDimIdx = 0;
 
@@ -1901,6 +1985,9 @@ void Eltwise::initSupportedPrimitiveDescriptors() {
             Precision::BF16,
             Precision::I32
     };
+    // FP16 values are converted to FP32 in registers with F16C instructions
+    if (mayiuse(x64::avx2))
+        supportedPrecisions.push_back(Precision::FP16);
 
     if (!supportedPrimitiveDescriptors.empty())
         return;
@@ -1973,6 +2060,8 @@ void Eltwise::initSupportedPrimitiveDescriptors() {
         } else if (std::find(supportedPrecisions.begin(), supportedPrecisions.end(), prc) == supportedPrecisions.end()) {
             if (prc == Precision::U32 || prc == Precision::I64 || prc == Precision::U64) {
                 return Precision(Precision::I32);
+            } else if (prc == Precision::FP16) {
+                return Precision(Precision::FP32);
             } else {
                 IE_THROW() << "Eltwise node with name `" << getName() << "` doesn't support " << prc << " precision.";
             }
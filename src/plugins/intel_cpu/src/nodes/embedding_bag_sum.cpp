@@ -10,8 +10,10 @@
 #include "embedding_bag_sum.h"
 #include <ngraph/opsets/opset1.hpp>
 #include "common/cpu_memcpy.h"
+#include "utils/general_utils.h"
 
 using namespace InferenceEngine;
+using namespace dnnl::impl::cpu;
 
 namespace ov {
 namespace intel_cpu {
@@ -39,11 +41,73 @@ EmbeddingBagSum::EmbeddingBagSum(
     }
 }
 
-void EmbeddingBagSum::prepareParams(const VectorDims& indexStaticShape) {
+bool EmbeddingBagSum::isJitKernelSupported() {
+#if defined(OPENVINO_ARCH_X86_64)
+    return x64::mayiuse(x64::avx2);
+#else
+    return false;
+#endif
+}
+
+void EmbeddingBagSum::fuseTableDecompression(const float* scales, const float* zeroPoints, size_t rowsNum) {
+    // (x - zp) * scale is computed as x * scale + bias to keep a single FMA per element in the kernel
+    _decompressionScales.assign(scales, scales + rowsNum);
+    _decompressionBiases.resize(rowsNum, 0.f);
+    for (size_t i = 0lu; zeroPoints && i < rowsNum; i++) {
+        _decompressionBiases[i] = -zeroPoints[i] * scales[i];
+    }
+}
+
+Precision EmbeddingBagSum::getTablePrecision(Precision originalPrecision) const {
+    if (one_of(originalPrecision, Precision::BF16, Precision::FP16) && !isJitKernelSupported())
+        return Precision::FP32;
+    return originalPrecision;
+}
+
+Precision EmbeddingBagSum::getOutputPrecision(Precision tablePrecision) const {
+    if (withTableDecompression() || one_of(tablePrecision, Precision::BF16, Precision::FP16))
+        return Precision::FP32;
+    return tablePrecision;
+}
+
+bool EmbeddingBagSum::useJitKernel(Precision tablePrecision) const {
+    return isJitKernelSupported() &&
+           (withTableDecompression() || one_of(tablePrecision, Precision::FP32, Precision::BF16, Precision::FP16));
+}
+
+impl_desc_type EmbeddingBagSum::getImplType(Precision tablePrecision) const {
+    if (!useJitKernel(tablePrecision))
+        return impl_desc_type::ref_any;
+#if defined(OPENVINO_ARCH_X86_64)
+    return x64::mayiuse(x64::avx512_core) ? impl_desc_type::jit_avx512 : impl_desc_type::jit_avx2;
+#else
+    return impl_desc_type::ref_any;
+#endif
+}
+
+void EmbeddingBagSum::prepareParams(const VectorDims& indexStaticShape, Precision tablePrecision) {
     _embDepth = 1lu;
     for (size_t i = 1lu; i < indexStaticShape.size(); i++) {
         _embDepth *= indexStaticShape[i];
     }
+
+#if defined(OPENVINO_ARCH_X86_64)
+    if (!useJitKernel(tablePrecision) ||
+        (_kernel && _kernel->jcp_.embDepth == _embDepth && _kernel->jcp_.tablePrc == tablePrecision))
+        return;
+
+    jit_emb_bag_config_params jcp;
+    jcp.tablePrc = tablePrecision;
+    jcp.embDepth = _embDepth;
+    jcp.withWeights = _withWeights;
+    jcp.withDecompression = withTableDecompression();
+    if (x64::mayiuse(x64::avx512_core)) {
+        _kernel.reset(new jit_uni_emb_bag_kernel_f32<x64::avx512_core>(jcp));
+    } else {
+        _kernel.reset(new jit_uni_emb_bag_kernel_f32<x64::avx2>(jcp));
+    }
+    _kernel->create_ker();
+#endif
 }
 
 template<typename T>
@@ -76,7 +140,7 @@ void EmbeddingBagSum::processData(const T* srcData, const T* weightsData,
 
                 size_t inIdx = 0lu;
                 if (static_cast<size_t>(indices[inIdx]) >= inDataDims[0]) {
-                    IE_THROW() << msgPrefix + "' has invalid embedding bag index: " + std::to_string(indices[inIdx]);
+                    IE_THROW() << msgPrefix << "has invalid embedding bag index: " << indices[inIdx];
                 }
                 size_t srcIndex = indices[inIdx] * _embDepth;
 
@@ -93,7 +157,7 @@ void EmbeddingBagSum::processData(const T* srcData, const T* weightsData,
 
                 for (inIdx = 1lu; inIdx < indicesSize; inIdx++) {
                     if (static_cast<size_t>(indices[inIdx]) >= inDataDims[0]) {
-                        IE_THROW() << msgPrefix + "' has invalid embedding bag index: " + std::to_string(indices[inIdx]);
+                        IE_THROW() << msgPrefix << "has invalid embedding bag index: " << indices[inIdx];
                     }
                     size_t srcIndex = indices[inIdx] * _embDepth;
 
@@ -119,8 +183,63 @@ void EmbeddingBagSum::processData(const T* srcData, const T* weightsData,
     parallel_nt(0, threadBody);
 }
 
+void EmbeddingBagSum::processDataJit(const uint8_t* srcData, const float* weightsData,
+                                     const InferenceEngine::SizeVector& inDataDims, const MemoryPtr& outMemory) {
+    std::string msgPrefix = std::string("Node EmbeddingBagSum with name '") + _layerName + "' ";
+
+    initFromInputs();
+
+    const size_t outputBagsNum = outMemory->GetShape().getStaticDims()[0];
+    auto *dstData = reinterpret_cast<float *>(outMemory->GetPtr());
+
+    auto threadBody = [&](const int ithr, const int nthr) {
+        size_t start(0lu), end(0lu);
+        splitter(outputBagsNum, nthr, ithr, start, end);
+        if (start >= end)
+            return;
+
+        size_t indicesSize = 0lu;
+        const int* indices = nullptr;
+        int weightsIdx = 0lu;
+        bool withWeights = _withWeights;
+
+        jit_emb_bag_call_args args;
+        args.table = srcData;
+        args.scales = _decompressionScales.data();
+        args.biases = _decompressionBiases.data();
+
+        for (size_t obi = start; obi < end; obi++) {
+            float* dst = dstData + obi * _embDepth;
+            getIndices(obi, indices, indicesSize, weightsIdx, withWeights);
+
+            if (indices == nullptr) {
+                std::fill(dst, dst + _embDepth, 0.f);
+                continue;
+            }
+            // the kernel doesn't check the indices, so they are validated before the gathers
+            for (size_t inIdx = 0lu; inIdx < indicesSize; inIdx++) {
+                if (static_cast<size_t>(indices[inIdx]) >= inDataDims[0]) {
+                    IE_THROW() << msgPrefix << "has invalid embedding bag index: " << indices[inIdx];
+                }
+            }
+
+            args.indices = indices;
+            args.indicesNum = indicesSize;
+            args.weights = withWeights && _withWeights ? weightsData + weightsIdx : nullptr;
+            args.dst = dst;
+            (*_kernel)(&args);
+        }
+    };
+
+    parallel_nt(0, threadBody);
+}
+
 void EmbeddingBagSum::execute(const uint8_t* srcData, const uint8_t* weightsData, const InferenceEngine::Precision &srcPrc,
                               const InferenceEngine::SizeVector& inDims, const MemoryPtr& outMemory) {
+    if (_kernel) {
+        return processDataJit(srcData, reinterpret_cast<const float*>(weightsData), inDims, outMemory);
+    }
+
     switch (srcPrc) {
         case Precision::FP32: {
             return processData<PrecisionTrait<Precision::FP32>::value_type>(reinterpret_cast<const float*>(srcData),
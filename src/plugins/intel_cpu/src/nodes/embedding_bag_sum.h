@@ -9,6 +9,7 @@
 #include <string>
 #include <memory>
 #include <vector>
+#include "kernels/x64/embedding_bag_kernel.hpp"
 
 namespace ov {
 namespace intel_cpu {
@@ -28,6 +29,14 @@ public:
 
     ~EmbeddingBagSum() = default;
 
+    /**
+     * Keeps the U8 / I8 table in the low precision and dequantizes the rows in the kernel:
+     * value = (table[row][i] - zeroPoints[row]) * scales[row].
+     */
+    void fuseTableDecompression(const float* scales, const float* zeroPoints, size_t rowsNum);
+    bool withTableDecompression() const { return !_decompressionScales.empty(); }
+    static bool isJitKernelSupported();
+
 protected:
     virtual void initFromInputs() = 0;
     virtual void getIndices(
@@ -37,11 +46,19 @@ protected:
             int& weightsIdx,
             bool& withWeights) = 0;
 
-    void prepareParams(const VectorDims& indexStaticShape);
+    // BF16, FP16 and decompressed tables are processed by the JIT kernel only, which produces FP32
+    InferenceEngine::Precision getTablePrecision(InferenceEngine::Precision originalPrecision) const;
+    InferenceEngine::Precision getOutputPrecision(InferenceEngine::Precision tablePrecision) const;
+    bool useJitKernel(InferenceEngine::Precision tablePrecision) const;
+    impl_desc_type getImplType(InferenceEngine::Precision tablePrecision) const;
+
+    void prepareParams(const VectorDims& indexStaticShape, InferenceEngine::Precision tablePrecision);
 
     template<typename T>
     void processData(const T* srcData, const T* weightsData,
                      const InferenceEngine::SizeVector& inDataDims, const MemoryPtr& outMemory);
+    void processDataJit(const uint8_t* srcData, const float* weightsData,
+                        const InferenceEngine::SizeVector& inDataDims, const MemoryPtr& outMemory);
 
     const size_t EMB_TABLE_IDX = 0lu;
     const size_t INDICES_IDX;
@@ -51,6 +68,10 @@ protected:
     bool _withWeights = false;
     size_t _embDepth = 0;
     std::string _layerName;
+
+    std::shared_ptr<jit_uni_emb_bag_kernel> _kernel;
+    std::vector<float> _decompressionScales;
+    std::vector<float> _decompressionBiases;
 };
 
 }   // namespace node
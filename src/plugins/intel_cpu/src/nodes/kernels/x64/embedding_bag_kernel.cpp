@@ -0,0 +1,244 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "embedding_bag_kernel.hpp"
+
+#include <algorithm>
+
+using namespace InferenceEngine;
+using namespace dnnl::impl;
+using namespace dnnl::impl::cpu::x64;
+
+#define GET_OFF(field) offsetof(jit_emb_bag_call_args, field)
+
+namespace ov {
+namespace intel_cpu {
+
+template <cpu::x64::cpu_isa_t isa>
+jit_uni_emb_bag_kernel_f32<isa>::jit_uni_emb_bag_kernel_f32(const jit_emb_bag_config_params& jcp)
+    : jit_uni_emb_bag_kernel(jcp), jit_generator(jit_name()) {
+    tableTypeSize = jcp.tablePrc.size();
+}
+
+template <cpu::x64::cpu_isa_t isa>
+void jit_uni_emb_bag_kernel_f32<isa>::create_ker() {
+    jit_generator::create_kernel();
+    ker_ = (decltype(ker_))jit_ker();
+}
+
+template <cpu::x64::cpu_isa_t isa>
+void jit_uni_emb_bag_kernel_f32<isa>::generate() {
+    this->preamble();
+
+    mov(reg_table, ptr[reg_params + GET_OFF(table)]);
+    mov(reg_indices, ptr[reg_params + GET_OFF(indices)]);
+    mov(reg_weights, ptr[reg_params + GET_OFF(weights)]);
+    mov(reg_dst, ptr[reg_params + GET_OFF(dst)]);
+    if (jcp_.withDecompression) {
+        mov(reg_scales, ptr[reg_params + GET_OFF(scales)]);
+        mov(reg_biases, ptr[reg_params + GET_OFF(biases)]);
+    }
+
+    // the accumulators of a chunk are kept in registers during the whole pass over the indices of the bag
+    const size_t vecsNum = jcp_.embDepth / simdW;
+    const size_t tailNum = jcp_.embDepth % simdW;
+    size_t vec = 0lu;
+    do {
+        const size_t chunkVecs = std::min(maxAccumulators, vecsNum - vec);
+        const bool isLastChunk = vec + chunkVecs == vecsNum;
+        process_chunk(vec * simdW, chunkVecs, isLastChunk ? tailNum : 0lu);
+        vec += chunkVecs;
+    } while (vec < vecsNum);
+
+    this->postamble();
+}
+
+template <cpu::x64::cpu_isa_t isa>
+void jit_uni_emb_bag_kernel_f32<isa>::process_chunk(size_t offset, size_t vecsNum, size_t tailNum) {
+    const size_t tailOffset = offset + vecsNum * simdW;
+
+    for (size_t i = 0; i < vecsNum; i++) {
+        const Vmm vmm_acc = Vmm(firstAccumulatorIdx + i);
+        uni_vpxor(vmm_acc, vmm_acc, vmm_acc);
+    }
+    // the tail is accumulated in the destination memory
+    uni_vpxor(xmm_tmp, xmm_tmp, xmm_tmp);
+    for (size_t i = 0; i < tailNum; i++) {
+        uni_vmovss(ptr[reg_dst + (tailOffset + i) * sizeof(float)], xmm_tmp);
+    }
+    if (jcp_.withDecompression)
+        uni_vpxor(xmm_bias_sum, xmm_bias_sum, xmm_bias_sum);
+
+    if (jcp_.withWeights) {
+        Xbyak::Label no_weights_label;
+        Xbyak::Label end_label;
+
+        test(reg_weights, reg_weights);
+        jz(no_weights_label, T_NEAR);
+        indices_loop(offset, vecsNum, tailNum, true);
+        jmp(end_label, T_NEAR);
+        L(no_weights_label);
+        indices_loop(offset, vecsNum, tailNum, false);
+        L(end_label);
+    } else {
+        indices_loop(offset, vecsNum, tailNum, false);
+    }
+
+    if (jcp_.withDecompression) {
+        // sum of the weighted per-row biases is the same for all the elements of the bag
+        uni_vbroadcastss(vmm_bias, xmm_bias_sum);
+        for (size_t i = 0; i < vecsNum; i++) {
+            const Vmm vmm_acc = Vmm(firstAccumulatorIdx + i);
+            uni_vaddps(vmm_acc, vmm_acc, vmm_bias);
+        }
+        for (size_t i = 0; i < tailNum; i++) {
+            const auto dstAddr = ptr[reg_dst + (tailOffset + i) * sizeof(float)];
+            uni_vaddss(xmm_val, xmm_bias_sum, dstAddr);
+            uni_vmovss(dstAddr, xmm_val);
+        }
+    }
+
+    for (size_t i = 0; i < vecsNum; i++) {
+        uni_vmovups(ptr[reg_dst + (offset + i * simdW) * sizeof(float)], Vmm(firstAccumulatorIdx + i));
+    }
+}
+
+template <cpu::x64::cpu_isa_t isa>
+void jit_uni_emb_bag_kernel_f32<isa>::indices_loop(size_t offset, size_t vecsNum, size_t tailNum, bool withWeights) {
+    const size_t rowSize = jcp_.embDepth * tableTypeSize;
+    const size_t chunkOffset = offset * tableTypeSize;
+    const size_t chunkSize = (vecsNum * simdW + tailNum) * tableTypeSize;
+    const size_t tailOffset = offset + vecsNum * simdW;
+    const bool isScaled = withWeights || jcp_.withDecompression;
+
+    Xbyak::Label loop_label;
+    Xbyak::Label loop_end_label;
+
+    mov(reg_idx_ptr, reg_indices);
+    if (withWeights)
+        mov(reg_weight_ptr, reg_weights);
+    mov(reg_work_amount, ptr[reg_params + GET_OFF(indicesNum)]);
+
+    L(loop_label);
+    {
+        cmp(reg_work_amount, 0);
+        je(loop_end_label, T_NEAR);
+
+        Xbyak::Label prefetch_end_label;
+        cmp(reg_work_amount, prefetchDistance);
+        jbe(prefetch_end_label, T_NEAR);
+        movsxd(reg_prefetch, dword[reg_idx_ptr + prefetchDistance * sizeof(int)]);
+        imul(reg_prefetch, reg_prefetch, static_cast<int>(rowSize));
+        add(reg_prefetch, reg_table);
+        for (size_t line = 0; line < chunkSize; line += 64) {
+            prefetcht0(ptr[reg_prefetch + chunkOffset + line]);
+        }
+        // the row may be not aligned by the cache line
+        prefetcht0(ptr[reg_prefetch + chunkOffset + chunkSize - 1]);
+        L(prefetch_end_label);
+
+        movsxd(reg_idx, dword[reg_idx_ptr]);
+        if (jcp_.withDecompression) {
+            uni_vmovss(xmm_scale, ptr[reg_scales + reg_idx * sizeof(float)]);
+            uni_vmovss(xmm_tmp, ptr[reg_biases + reg_idx * sizeof(float)]);
+            if (withWeights) {
+                uni_vmulss(xmm_scale, xmm_scale, ptr[reg_weight_ptr]);
+                uni_vmulss(xmm_tmp, xmm_tmp, ptr[reg_weight_ptr]);
+            }
+            uni_vaddss(xmm_bias_sum, xmm_bias_sum, xmm_tmp);
+            uni_vbroadcastss(vmm_scale, xmm_scale);
+        } else if (withWeights) {
+            uni_vbroadcastss(vmm_scale, ptr[reg_weight_ptr]);
+        }
+
+        imul(reg_row, reg_idx, static_cast<int>(rowSize));
+        add(reg_row, reg_table);
+
+        for (size_t i = 0; i < vecsNum; i++) {
+            const Vmm vmm_acc = Vmm(firstAccumulatorIdx + i);
+            load_vector(vmm_val, reg_row, (offset + i * simdW) * tableTypeSize);
+            if (isScaled)
+                uni_vfmadd231ps(vmm_acc, vmm_val, vmm_scale);
+            else
+                uni_vaddps(vmm_acc, vmm_acc, vmm_val);
+        }
+        for (size_t i = 0; i < tailNum; i++) {
+            const auto dstAddr = ptr[reg_dst + (tailOffset + i) * sizeof(float)];
+            load_scalar(xmm_val, reg_row, (tailOffset + i) * tableTypeSize);
+            if (isScaled)
+                uni_vmulss(xmm_val, xmm_val, xmm_scale);
+            uni_vaddss(xmm_val, xmm_val, dstAddr);
+            uni_vmovss(dstAddr, xmm_val);
+        }
+
+        add(reg_idx_ptr, sizeof(int));
+        if (withWeights)
+            add(reg_weight_ptr, sizeof(float));
+        dec(reg_work_amount);
+        jmp(loop_label, T_NEAR);
+    }
+    L(loop_end_label);
+}
+
+template <cpu::x64::cpu_isa_t isa>
+void jit_uni_emb_bag_kernel_f32<isa>::load_vector(const Vmm& vmm, const Xbyak::Reg64& reg, size_t offset) {
+    const auto addr = ptr[reg + offset];
+    switch (jcp_.tablePrc) {
+        case Precision::FP32:
+            uni_vmovups(vmm, addr);
+            break;
+        case Precision::BF16:
+            vpmovzxwd(vmm, addr);
+            uni_vpslld(vmm, vmm, 16);
+            break;
+        case Precision::FP16:
+            vcvtph2ps(vmm, addr);
+            break;
+        case Precision::U8:
+            uni_vpmovzxbd(vmm, addr);
+            uni_vcvtdq2ps(vmm, vmm);
+            break;
+        case Precision::I8:
+            uni_vpmovsxbd(vmm, addr);
+            uni_vcvtdq2ps(vmm, vmm);
+            break;
+        default:
+            assert(!"unsupported embedding table precision");
+    }
+}
+
+template <cpu::x64::cpu_isa_t isa>
+void jit_uni_emb_bag_kernel_f32<isa>::load_scalar(const Xbyak::Xmm& xmm, const Xbyak::Reg64& reg, size_t offset) {
+    switch (jcp_.tablePrc) {
+        case Precision::FP32:
+            uni_vmovss(xmm, ptr[reg + offset]);
+            break;
+        case Precision::BF16:
+            movzx(reg_tmp_32, word[reg + offset]);
+            shl(reg_tmp_32, 16);
+            uni_vmovd(xmm, reg_tmp_32);
+            break;
+        case Precision::FP16:
+            movzx(reg_tmp_32, word[reg + offset]);
+            uni_vmovd(xmm, reg_tmp_32);
+            vcvtph2ps(xmm, xmm);
+            break;
+        case Precision::U8:
+            movzx(reg_tmp_32, byte[reg + offset]);
+            uni_vcvtsi2ss(xmm, xmm, reg_tmp_32);
+            break;
+        case Precision::I8:
+            movsx(reg_tmp_32, byte[reg + offset]);
+            uni_vcvtsi2ss(xmm, xmm, reg_tmp_32);
+            break;
+        default:
+            assert(!"unsupported embedding table precision");
+    }
+}
+
+template struct jit_uni_emb_bag_kernel_f32<cpu::x64::avx2>;
+template struct jit_uni_emb_bag_kernel_f32<cpu::x64::avx512_core>;
+
+}   // namespace intel_cpu
+}   // namespace ov
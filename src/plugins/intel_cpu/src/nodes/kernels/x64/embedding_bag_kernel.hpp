@@ -0,0 +1,108 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <cpu/x64/cpu_isa_traits.hpp>
+#include <cpu/x64/jit_generator.hpp>
+#include "ie_precision.hpp"
+
+namespace ov {
+namespace intel_cpu {
+
+struct jit_emb_bag_config_params {
+    // FP32, BF16, FP16 or U8 / I8 with per-row decompression
+    InferenceEngine::Precision tablePrc;
+    size_t embDepth = 0lu;
+    bool withWeights = false;
+    bool withDecompression = false;
+};
+
+struct jit_emb_bag_call_args {
+    const uint8_t* table;
+    const int* indices;
+    // per-sample weights of the bag, nullptr if the bag has no weights
+    const float* weights;
+    const float* scales;
+    const float* biases;
+    float* dst;
+    size_t indicesNum;
+};
+
+struct jit_uni_emb_bag_kernel {
+    void (*ker_)(const jit_emb_bag_call_args*);
+
+    void operator()(const jit_emb_bag_call_args* args) {
+        assert(ker_);
+        ker_(args);
+    }
+
+    explicit jit_uni_emb_bag_kernel(const jit_emb_bag_config_params& jcp) : ker_(nullptr), jcp_(jcp) {}
+    virtual ~jit_uni_emb_bag_kernel() {}
+
+    virtual void create_ker() = 0;
+
+    jit_emb_bag_config_params jcp_;
+};
+
+/**
+ * Sums up the rows of the embedding table for a single bag. The row is processed by chunks of vectors kept
+ * in registers, the rows of the upcoming indices are prefetched, so the random gathers from large tables
+ * are overlapped with the accumulation. The low precision rows are converted to FP32 on load.
+ */
+template <dnnl::impl::cpu::x64::cpu_isa_t isa>
+struct jit_uni_emb_bag_kernel_f32 : public jit_uni_emb_bag_kernel, public dnnl::impl::cpu::x64::jit_generator {
+    DECLARE_CPU_JIT_AUX_FUNCTIONS(jit_uni_emb_bag_kernel_f32)
+
+    explicit jit_uni_emb_bag_kernel_f32(const jit_emb_bag_config_params& jcp);
+
+    void create_ker() override;
+    void generate() override;
+
+private:
+    using Vmm = typename dnnl::impl::utils::conditional<isa == dnnl::impl::cpu::x64::avx2,
+                                                        Xbyak::Ymm,
+                                                        Xbyak::Zmm>::type;
+    const size_t vlen = dnnl::impl::cpu::x64::cpu_isa_traits<isa>::vlen;
+    const size_t simdW = vlen / sizeof(float);
+    // number of the accumulators, the lower registers are reserved for the temporary values
+    const size_t maxAccumulators = isa == dnnl::impl::cpu::x64::avx2 ? 8lu : 16lu;
+    const size_t firstAccumulatorIdx = 8lu;
+    // distance in indices between the accumulated row and the prefetched one
+    const size_t prefetchDistance = 8lu;
+
+    void process_chunk(size_t offset, size_t vecsNum, size_t tailNum);
+    void indices_loop(size_t offset, size_t vecsNum, size_t tailNum, bool withWeights);
+    void load_vector(const Vmm& vmm, const Xbyak::Reg64& reg, size_t offset);
+    void load_scalar(const Xbyak::Xmm& xmm, const Xbyak::Reg64& reg, size_t offset);
+
+    size_t tableTypeSize = 4lu;
+
+    Xbyak::Reg64 reg_table = r8;
+    Xbyak::Reg64 reg_indices = r9;
+    Xbyak::Reg64 reg_weights = r10;
+    Xbyak::Reg64 reg_scales = r11;
+    Xbyak::Reg64 reg_biases = r12;
+    Xbyak::Reg64 reg_dst = r13;
+    Xbyak::Reg64 reg_idx_ptr = r14;
+    Xbyak::Reg64 reg_weight_ptr = r15;
+    Xbyak::Reg64 reg_work_amount = rax;
+    Xbyak::Reg64 reg_row = rbx;
+    Xbyak::Reg64 reg_idx = rdx;
+    Xbyak::Reg64 reg_prefetch = rsi;
+    Xbyak::Reg32 reg_tmp_32 = ebp;
+    Xbyak::Reg64 reg_params = Xbyak::Reg64(dnnl::impl::cpu::x64::abi_param_regs[0]);
+
+    Vmm vmm_val = Vmm(0);
+    Vmm vmm_scale = Vmm(1);
+    // broadcasted xmm_bias_sum
+    Vmm vmm_bias = Vmm(2);
+    Xbyak::Xmm xmm_val = Xbyak::Xmm(0);
+    Xbyak::Xmm xmm_scale = Xbyak::Xmm(1);
+    Xbyak::Xmm xmm_bias_sum = Xbyak::Xmm(2);
+    Xbyak::Xmm xmm_tmp = Xbyak::Xmm(3);
+};
+
+}   // namespace intel_cpu
+}   // namespace ov
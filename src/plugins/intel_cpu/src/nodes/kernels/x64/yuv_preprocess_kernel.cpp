@@ -0,0 +1,262 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "yuv_preprocess_kernel.hpp"
+
+#include <cstring>
+
+using namespace InferenceEngine;
+using namespace dnnl::impl;
+using namespace dnnl::impl::cpu::x64;
+
+#define GET_OFF(field) offsetof(jit_yuv_row_call_args, field)
+#define GET_OFF_RESIZE(field) offsetof(jit_resize_row_call_args, field)
+
+namespace ov {
+namespace intel_cpu {
+
+namespace {
+// the same coefficients as in ColorConvert
+const float yuvConsts[8] = { 16.f, 128.f, 1.164f, 1.596f, 0.391f, 2.018f, 0.813f, 255.f };
+
+// pixel to chroma element maps: the interleaved UV pairs of NV12 and the separate U, V planes of I420
+const int nv12PermU[16] = { 0, 0, 2, 2, 4, 4, 6, 6, 8, 8, 10, 10, 12, 12, 14, 14 };
+const int nv12PermV[16] = { 1, 1, 3, 3, 5, 5, 7, 7, 9, 9, 11, 11, 13, 13, 15, 15 };
+const int i420Perm[16] = { 0, 0, 1, 1, 2, 2, 3, 3, 4, 4, 5, 5, 6, 6, 7, 7 };
+}   // namespace
+
+template <cpu::x64::cpu_isa_t isa>
+jit_uni_yuv_row_kernel_f32<isa>::jit_uni_yuv_row_kernel_f32(const jit_yuv_preprocess_config_params& jcp)
+    : jit_uni_yuv_row_kernel(jcp), jit_generator(jit_name()) {}
+
+template <cpu::x64::cpu_isa_t isa>
+void jit_uni_yuv_row_kernel_f32<isa>::create_ker() {
+    jit_generator::create_kernel();
+    ker_ = (decltype(ker_))jit_ker();
+}
+
+template <cpu::x64::cpu_isa_t isa>
+void jit_uni_yuv_row_kernel_f32<isa>::generate() {
+    this->preamble();
+
+    mov(reg_y, ptr[reg_params + GET_OFF(y)]);
+    mov(reg_u, ptr[reg_params + GET_OFF(u)]);
+    mov(reg_v, ptr[reg_params + GET_OFF(v)]);
+    mov(reg_dst_r, ptr[reg_params + GET_OFF(dst)]);
+    mov(reg_dst_g, ptr[reg_params + GET_OFF(dst) + sizeof(float*)]);
+    mov(reg_dst_b, ptr[reg_params + GET_OFF(dst) + 2 * sizeof(float*)]);
+    mov(reg_work_amount, ptr[reg_params + GET_OFF(workAmount)]);
+
+    mov(reg_consts, reinterpret_cast<size_t>(yuvConsts));
+    mov(reg_tmp, reinterpret_cast<size_t>(jcp_.i420 ? i420Perm : nv12PermU));
+    uni_vmovdqu(vmm_perm_u, ptr[reg_tmp]);
+    if (!jcp_.i420) {
+        mov(reg_tmp, reinterpret_cast<size_t>(nv12PermV));
+        uni_vmovdqu(vmm_perm_v, ptr[reg_tmp]);
+    }
+    uni_vpxor(vmm_zero, vmm_zero, vmm_zero);
+    uni_vbroadcastss(vmm_max, ptr[reg_consts + 7 * sizeof(float)]);
+
+    const size_t srcTypeSize = jcp_.srcPrc.size();
+
+    Xbyak::Label loop_label;
+    Xbyak::Label loop_end_label;
+
+    L(loop_label);
+    {
+        cmp(reg_work_amount, simdW);
+        jl(loop_end_label, T_NEAR);
+
+        load_values(vmm_y, ptr[reg_y], false);
+        load_chroma();
+
+        uni_vbroadcastss(vmm_tmp, ptr[reg_consts + 0 * sizeof(float)]);
+        uni_vsubps(vmm_y, vmm_y, vmm_tmp);
+        uni_vbroadcastss(vmm_tmp, ptr[reg_consts + 1 * sizeof(float)]);
+        uni_vsubps(vmm_u, vmm_u, vmm_tmp);
+        uni_vsubps(vmm_v, vmm_v, vmm_tmp);
+        uni_vbroadcastss(vmm_tmp, ptr[reg_consts + 2 * sizeof(float)]);
+        uni_vmulps(vmm_y, vmm_y, vmm_tmp);
+
+        // r = y + 1.596 * v
+        uni_vbroadcastss(vmm_r, ptr[reg_consts + 3 * sizeof(float)]);
+        uni_vmulps(vmm_r, vmm_r, vmm_v);
+        uni_vaddps(vmm_r, vmm_r, vmm_y);
+        // g = y - 0.391 * u - 0.813 * v
+        uni_vbroadcastss(vmm_g, ptr[reg_consts + 4 * sizeof(float)]);
+        uni_vmulps(vmm_g, vmm_g, vmm_u);
+        uni_vsubps(vmm_g, vmm_y, vmm_g);
+        uni_vbroadcastss(vmm_tmp, ptr[reg_consts + 6 * sizeof(float)]);
+        uni_vmulps(vmm_tmp, vmm_tmp, vmm_v);
+        uni_vsubps(vmm_g, vmm_g, vmm_tmp);
+        // b = y + 2.018 * u
+        uni_vbroadcastss(vmm_b, ptr[reg_consts + 5 * sizeof(float)]);
+        uni_vmulps(vmm_b, vmm_b, vmm_u);
+        uni_vaddps(vmm_b, vmm_b, vmm_y);
+
+        store_color(vmm_r, 0);
+        store_color(vmm_g, 1);
+        store_color(vmm_b, 2);
+
+        add(reg_y, simdW * srcTypeSize);
+        // both NV12 and I420 advance by simdW / 2 chroma pixels, NV12 has two values per pixel
+        const size_t chromaStep = (jcp_.i420 ? simdW / 2 : simdW) * srcTypeSize;
+        add(reg_u, chromaStep);
+        add(reg_v, chromaStep);
+        add(reg_dst_r, vlen);
+        add(reg_dst_g, vlen);
+        add(reg_dst_b, vlen);
+        sub(reg_work_amount, simdW);
+        jmp(loop_label, T_NEAR);
+    }
+    L(loop_end_label);
+
+    this->postamble();
+}
+
+template <cpu::x64::cpu_isa_t isa>
+void jit_uni_yuv_row_kernel_f32<isa>::load_values(const Vmm& vmm, const Xbyak::Address& addr, bool isHalf) {
+    if (jcp_.srcPrc == Precision::U8) {
+        if (isHalf) {
+            vpmovzxbd(Vmm_half(vmm.getIdx()), addr);
+            vcvtdq2ps(Vmm_half(vmm.getIdx()), Vmm_half(vmm.getIdx()));
+        } else {
+            vpmovzxbd(vmm, addr);
+            vcvtdq2ps(vmm, vmm);
+        }
+    } else {
+        if (isHalf) {
+            uni_vmovups(Vmm_half(vmm.getIdx()), addr);
+        } else {
+            uni_vmovups(vmm, addr);
+        }
+    }
+}
+
+template <cpu::x64::cpu_isa_t isa>
+void jit_uni_yuv_row_kernel_f32<isa>::load_chroma() {
+    if (jcp_.i420) {
+        // simdW / 2 values of each plane, every value is duplicated for the pair of pixels
+        load_values(vmm_u, ptr[reg_u], true);
+        load_values(vmm_v, ptr[reg_v], true);
+        vpermps(vmm_u, vmm_perm_u, vmm_u);
+        vpermps(vmm_v, vmm_perm_u, vmm_v);
+    } else {
+        // simdW interleaved U and V values
+        load_values(vmm_tmp, ptr[reg_u], false);
+        vpermps(vmm_u, vmm_perm_u, vmm_tmp);
+        vpermps(vmm_v, vmm_perm_v, vmm_tmp);
+    }
+}
+
+template <cpu::x64::cpu_isa_t isa>
+void jit_uni_yuv_row_kernel_f32<isa>::store_color(const Vmm& vmm, size_t channel) {
+    // the colors of the U8 image are rounded as the ColorConvert output
+    if (jcp_.srcPrc == Precision::U8)
+        uni_vroundps(vmm, vmm, 0);
+    uni_vmaxps(vmm, vmm, vmm_zero);
+    uni_vminps(vmm, vmm, vmm_max);
+    const Xbyak::Reg64 dsts[3] = {reg_dst_r, reg_dst_g, reg_dst_b};
+    uni_vmovups(ptr[dsts[channel]], vmm);
+}
+
+template <cpu::x64::cpu_isa_t isa>
+jit_uni_resize_row_kernel_f32<isa>::jit_uni_resize_row_kernel_f32(const jit_yuv_preprocess_config_params& jcp)
+    : jit_uni_resize_row_kernel(jcp), jit_generator(jit_name()) {}
+
+template <cpu::x64::cpu_isa_t isa>
+void jit_uni_resize_row_kernel_f32<isa>::create_ker() {
+    jit_generator::create_kernel();
+    ker_ = (decltype(ker_))jit_ker();
+}
+
+template <cpu::x64::cpu_isa_t isa>
+void jit_uni_resize_row_kernel_f32<isa>::generate() {
+    this->preamble();
+
+    uni_vbroadcastss(vmm_wy, ptr[reg_params + GET_OFF_RESIZE(bottomWeight)]);
+
+    // the channels are processed one after another, the offsets and the weights of the row stay in L1
+    for (size_t c = 0; c < 3; c++) {
+        mov(reg_top, ptr[reg_params + GET_OFF_RESIZE(top) + c * sizeof(float*)]);
+        mov(reg_bottom, ptr[reg_params + GET_OFF_RESIZE(bottom) + c * sizeof(float*)]);
+        mov(reg_dst, ptr[reg_params + GET_OFF_RESIZE(dst) + c * sizeof(float*)]);
+        mov(reg_left, ptr[reg_params + GET_OFF_RESIZE(leftOffsets)]);
+        mov(reg_right, ptr[reg_params + GET_OFF_RESIZE(rightOffsets)]);
+        mov(reg_weights, ptr[reg_params + GET_OFF_RESIZE(rightWeights)]);
+        mov(reg_work_amount, ptr[reg_params + GET_OFF_RESIZE(workAmount)]);
+        load_scalar(vmm_mean, jcp_.mean[c]);
+        load_scalar(vmm_scale, jcp_.scale[c]);
+
+        Xbyak::Label loop_label;
+        Xbyak::Label loop_end_label;
+
+        L(loop_label);
+        {
+            cmp(reg_work_amount, simdW);
+            jl(loop_end_label, T_NEAR);
+
+            uni_vmovdqu(vmm_left, ptr[reg_left]);
+            uni_vmovdqu(vmm_right, ptr[reg_right]);
+            uni_vmovups(vmm_wx, ptr[reg_weights]);
+            gather(vmm_tl, reg_top, vmm_left);
+            gather(vmm_tr, reg_top, vmm_right);
+            gather(vmm_bl, reg_bottom, vmm_left);
+            gather(vmm_br, reg_bottom, vmm_right);
+
+            // top = tl + wx * (tr - tl), bottom = bl + wx * (br - bl)
+            uni_vsubps(vmm_tr, vmm_tr, vmm_tl);
+            uni_vfmadd231ps(vmm_tl, vmm_tr, vmm_wx);
+            uni_vsubps(vmm_br, vmm_br, vmm_bl);
+            uni_vfmadd231ps(vmm_bl, vmm_br, vmm_wx);
+            // value = top + wy * (bottom - top)
+            uni_vsubps(vmm_bl, vmm_bl, vmm_tl);
+            uni_vfmadd231ps(vmm_tl, vmm_bl, vmm_wy);
+            // (value - mean) * scale
+            uni_vsubps(vmm_tl, vmm_tl, vmm_mean);
+            uni_vmulps(vmm_tl, vmm_tl, vmm_scale);
+            uni_vmovups(ptr[reg_dst], vmm_tl);
+
+            add(reg_left, simdW * sizeof(int));
+            add(reg_right, simdW * sizeof(int));
+            add(reg_weights, vlen);
+            add(reg_dst, vlen);
+            sub(reg_work_amount, simdW);
+            jmp(loop_label, T_NEAR);
+        }
+        L(loop_end_label);
+    }
+
+    this->postamble();
+}
+
+template <cpu::x64::cpu_isa_t isa>
+void jit_uni_resize_row_kernel_f32<isa>::gather(const Vmm& vmm_dst, const Xbyak::Reg64& reg_src, const Vmm& vmm_offsets) {
+    // the mask is cleared by the gather instruction
+    if (isa == cpu::x64::avx512_core) {
+        kxnord(k_mask, k_mask, k_mask);
+        vgatherdps(vmm_dst | k_mask, ptr[reg_src + vmm_offsets]);
+    } else {
+        const Xbyak::Ymm ymm_mask = Xbyak::Ymm(vmm_mask.getIdx());
+        vpcmpeqd(ymm_mask, ymm_mask, ymm_mask);
+        vgatherdps(Xbyak::Ymm(vmm_dst.getIdx()), ptr[reg_src + Xbyak::Ymm(vmm_offsets.getIdx())], ymm_mask);
+    }
+}
+
+template <cpu::x64::cpu_isa_t isa>
+void jit_uni_resize_row_kernel_f32<isa>::load_scalar(const Vmm& vmm, float value) {
+    int bits;
+    std::memcpy(&bits, &value, sizeof(bits));
+    mov(reg_tmp_32, bits);
+    vmovd(xmm_tmp, reg_tmp_32);
+    uni_vbroadcastss(vmm, xmm_tmp);
+}
+
+template struct jit_uni_yuv_row_kernel_f32<cpu::x64::avx2>;
+template struct jit_uni_yuv_row_kernel_f32<cpu::x64::avx512_core>;
+template struct jit_uni_resize_row_kernel_f32<cpu::x64::avx2>;
+template struct jit_uni_resize_row_kernel_f32<cpu::x64::avx512_core>;
+
+}   // namespace intel_cpu
+}   // namespace ov
@@ -0,0 +1,171 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <cpu/x64/cpu_isa_traits.hpp>
+#include <cpu/x64/jit_generator.hpp>
+#include "ie_precision.hpp"
+
+namespace ov {
+namespace intel_cpu {
+
+struct jit_yuv_preprocess_config_params {
+    // U8 or FP32
+    InferenceEngine::Precision srcPrc;
+    bool i420 = false;
+    // per output channel normalization, the channels are already ordered as RGB or BGR by the caller
+    float mean[3] = {0.f, 0.f, 0.f};
+    float scale[3] = {1.f, 1.f, 1.f};
+};
+
+struct jit_yuv_row_call_args {
+    const uint8_t* y;
+    const uint8_t* u;
+    // points to the second byte of the UV plane for NV12
+    const uint8_t* v;
+    // R, G and B rows
+    float* dst[3];
+    // number of pixels, multiple of the vector length
+    size_t workAmount;
+};
+
+struct jit_resize_row_call_args {
+    // per output channel rows of the upper and the lower source pixels
+    const float* top[3];
+    const float* bottom[3];
+    float* dst[3];
+    // per output pixel byte offsets of the left and the right source pixels
+    const int* leftOffsets;
+    const int* rightOffsets;
+    const float* rightWeights;
+    float bottomWeight;
+    // number of pixels, multiple of the vector length
+    size_t workAmount;
+};
+
+template <typename call_args>
+struct jit_uni_yuv_preprocess_kernel {
+    void (*ker_)(const call_args*);
+
+    void operator()(const call_args* args) {
+        assert(ker_);
+        ker_(args);
+    }
+
+    explicit jit_uni_yuv_preprocess_kernel(const jit_yuv_preprocess_config_params& jcp) : ker_(nullptr), jcp_(jcp) {}
+    virtual ~jit_uni_yuv_preprocess_kernel() {}
+
+    virtual void create_ker() = 0;
+
+    jit_yuv_preprocess_config_params jcp_;
+};
+
+using jit_uni_yuv_row_kernel = jit_uni_yuv_preprocess_kernel<jit_yuv_row_call_args>;
+using jit_uni_resize_row_kernel = jit_uni_yuv_preprocess_kernel<jit_resize_row_call_args>;
+
+/**
+ * Converts a row of the NV12 / I420 image to the planar R, G and B rows of FP32 values.
+ * The chroma values are loaded once per two pixels and duplicated with the cross-lane permutation.
+ */
+template <dnnl::impl::cpu::x64::cpu_isa_t isa>
+struct jit_uni_yuv_row_kernel_f32 : public jit_uni_yuv_row_kernel, public dnnl::impl::cpu::x64::jit_generator {
+    DECLARE_CPU_JIT_AUX_FUNCTIONS(jit_uni_yuv_row_kernel_f32)
+
+    explicit jit_uni_yuv_row_kernel_f32(const jit_yuv_preprocess_config_params& jcp);
+
+    void create_ker() override;
+    void generate() override;
+
+private:
+    using Vmm = typename dnnl::impl::utils::conditional<isa == dnnl::impl::cpu::x64::avx2,
+                                                        Xbyak::Ymm,
+                                                        Xbyak::Zmm>::type;
+    // the register of the half vector length
+    using Vmm_half = typename dnnl::impl::utils::conditional<isa == dnnl::impl::cpu::x64::avx2,
+                                                             Xbyak::Xmm,
+                                                             Xbyak::Ymm>::type;
+    const size_t vlen = dnnl::impl::cpu::x64::cpu_isa_traits<isa>::vlen;
+    const size_t simdW = vlen / sizeof(float);
+
+    void load_chroma();
+    void load_values(const Vmm& vmm, const Xbyak::Address& addr, bool isHalf);
+    void store_color(const Vmm& vmm, size_t channel);
+
+    Xbyak::Reg64 reg_y = r8;
+    Xbyak::Reg64 reg_u = r9;
+    Xbyak::Reg64 reg_v = r10;
+    Xbyak::Reg64 reg_dst_r = r11;
+    Xbyak::Reg64 reg_dst_g = r12;
+    Xbyak::Reg64 reg_dst_b = r13;
+    Xbyak::Reg64 reg_work_amount = r14;
+    Xbyak::Reg64 reg_consts = r15;
+    Xbyak::Reg64 reg_tmp = rax;
+    Xbyak::Reg64 reg_params = Xbyak::Reg64(dnnl::impl::cpu::x64::abi_param_regs[0]);
+
+    Vmm vmm_y = Vmm(0);
+    Vmm vmm_u = Vmm(1);
+    Vmm vmm_v = Vmm(2);
+    Vmm vmm_r = Vmm(3);
+    Vmm vmm_g = Vmm(4);
+    Vmm vmm_b = Vmm(5);
+    Vmm vmm_tmp = Vmm(6);
+    Vmm vmm_zero = Vmm(7);
+    Vmm vmm_max = Vmm(8);
+    // pixel to chroma index maps
+    Vmm vmm_perm_u = Vmm(9);
+    Vmm vmm_perm_v = Vmm(10);
+};
+
+/**
+ * Resizes the converted rows with the bilinear interpolation and normalizes the result.
+ * The source pixels are gathered by the precomputed per output pixel offsets, the nearest neighbor resize
+ * is the same computation with zero weights.
+ */
+template <dnnl::impl::cpu::x64::cpu_isa_t isa>
+struct jit_uni_resize_row_kernel_f32 : public jit_uni_resize_row_kernel, public dnnl::impl::cpu::x64::jit_generator {
+    DECLARE_CPU_JIT_AUX_FUNCTIONS(jit_uni_resize_row_kernel_f32)
+
+    explicit jit_uni_resize_row_kernel_f32(const jit_yuv_preprocess_config_params& jcp);
+
+    void create_ker() override;
+    void generate() override;
+
+private:
+    using Vmm = typename dnnl::impl::utils::conditional<isa == dnnl::impl::cpu::x64::avx2,
+                                                        Xbyak::Ymm,
+                                                        Xbyak::Zmm>::type;
+    const size_t vlen = dnnl::impl::cpu::x64::cpu_isa_traits<isa>::vlen;
+    const size_t simdW = vlen / sizeof(float);
+
+    void gather(const Vmm& vmm_dst, const Xbyak::Reg64& reg_src, const Vmm& vmm_offsets);
+    void load_scalar(const Vmm& vmm, float value);
+
+    Xbyak::Reg64 reg_top = r8;
+    Xbyak::Reg64 reg_bottom = r9;
+    Xbyak::Reg64 reg_dst = r10;
+    Xbyak::Reg64 reg_left = r11;
+    Xbyak::Reg64 reg_right = r12;
+    Xbyak::Reg64 reg_weights = r13;
+    Xbyak::Reg64 reg_work_amount = r14;
+    Xbyak::Reg32 reg_tmp_32 = eax;
+    Xbyak::Reg64 reg_params = Xbyak::Reg64(dnnl::impl::cpu::x64::abi_param_regs[0]);
+
+    Vmm vmm_left = Vmm(0);
+    Vmm vmm_right = Vmm(1);
+    Vmm vmm_wx = Vmm(2);
+    Vmm vmm_wy = Vmm(3);
+    Vmm vmm_mask = Vmm(4);
+    Vmm vmm_tl = Vmm(5);
+    Vmm vmm_tr = Vmm(6);
+    Vmm vmm_bl = Vmm(7);
+    Vmm vmm_br = Vmm(8);
+    Vmm vmm_mean = Vmm(9);
+    Vmm vmm_scale = Vmm(10);
+    Xbyak::Xmm xmm_tmp = Xbyak::Xmm(11);
+    Xbyak::Opmask k_mask = Xbyak::Opmask(1);
+};
+
+}   // namespace intel_cpu
+}   // namespace ov
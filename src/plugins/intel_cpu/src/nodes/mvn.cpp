@@ -25,6 +25,7 @@
 #include <ngraph/opsets/opset6.hpp>
 #include "memory_desc/dnnl_blocked_memory_desc.h"
 #include "utils/cpu_utils.hpp"
+#include "cache/jit_kernel_registry.h"
 
 using namespace dnnl;
 using namespace InferenceEngine;
@@ -85,13 +86,54 @@ bool MVNKey::operator==(const MVNKey& rhs) const {
     retVal = retVal && *attr.get() == *rhs.attr.get();
     return retVal;
 }
+
+// the configuration the code of the jit MVN kernels is generated for
+struct MVNKernelKey {
+    jit_mvn_config_params jcp;
+    dnnl::primitive_attr attr;
+
+    size_t hash() const;
+    bool operator==(const MVNKernelKey& rhs) const;
+};
+
+size_t MVNKernelKey::hash() const {
+    using namespace dnnl::impl;
+    using namespace dnnl::impl::primitive_hashing;
+
+    size_t seed = 0;
+    seed = hash_combine(seed, jcp.layout);
+    seed = hash_combine(seed, jcp.across_channels);
+    seed = hash_combine(seed, jcp.normalize_variance);
+    seed = hash_combine(seed, jcp.src_prc.getPrecVal());
+    seed = hash_combine(seed, jcp.dst_prc.getPrecVal());
+    seed = hash_combine(seed, jcp.src_data_size);
+    seed = hash_combine(seed, jcp.dst_data_size);
+    seed = hash_combine(seed, jcp.C);
+    seed = hash_combine(seed, jcp.D);
+    seed = hash_combine(seed, jcp.H);
+    seed = hash_combine(seed, jcp.W);
+    seed = hash_combine(seed, get_attr_hash(*attr.get()));
+    return seed;
+}
+
+bool MVNKernelKey::operator==(const MVNKernelKey& rhs) const {
+    return jcp.layout == rhs.jcp.layout &&
+           jcp.across_channels == rhs.jcp.across_channels &&
+           jcp.normalize_variance == rhs.jcp.normalize_variance &&
+           jcp.src_prc == rhs.jcp.src_prc &&
+           jcp.dst_prc == rhs.jcp.dst_prc &&
+           jcp.src_data_size == rhs.jcp.src_data_size &&
+           jcp.dst_data_size == rhs.jcp.dst_data_size &&
+           jcp.C == rhs.jcp.C && jcp.D == rhs.jcp.D && jcp.H == rhs.jcp.H && jcp.W == rhs.jcp.W &&
+           *attr.get() == *rhs.attr.get();
+}
 } // namespace
 
 #if defined(OPENVINO_ARCH_X86_64)
 
 // some utility functions
 static inline bool isFloatCompatible(Precision prc) {
-    return Precision::FP32 == prc || Precision::BF16 == prc;
+    return Precision::FP32 == prc || Precision::BF16 == prc || Precision::FP16 == prc;
 }
 
 // normalize_variance = false : src->mean
@@ -1180,6 +1222,14 @@ void MVN::initSupportedPrimitiveDescriptors() {
         outputPrecision = fusedWith[fusedWith.size() - 1]->getOriginalOutputPrecisionAtPort(0);
     }
 
+    // FP16 is converted in registers with F16C instructions
+    if (!mayiuse(cpu::x64::avx2)) {
+        if (inputPrecision == Precision::FP16)
+            inputPrecision = Precision::FP32;
+        if (outputPrecision == Precision::FP16)
+            outputPrecision = Precision::FP32;
+    }
+
     // ref with float planar and no fusion
     if (!mayiuse(cpu::x64::sse41)) {
         inputPrecision = outputPrecision = Precision::FP32;
@@ -1288,41 +1338,51 @@ MVN::MVNJitExecutor::MVNJitExecutor(const MVNAttrs& mvnAttrs,
     jcp.across_channels = mvnAttrs.execAcrossChannels_;
     int N = 0;
     std::tie(N, jcp.C, jcp.D, jcp.H, jcp.W) = mvnAttrs.shape5D;
+    auto mvnBuilder = [](const MVNKernelKey& key) -> std::shared_ptr<jit_uni_mvn_kernel> {
+        std::shared_ptr<jit_uni_mvn_kernel> kernel;
 #if defined(OPENVINO_ARCH_X86_64)
-    if (mayiuse(cpu::x64::avx512_core)) {
-        mvn_kernel.reset(new jit_uni_mvn_kernel_f32<cpu::x64::avx512_core>(jcp, *attr.get()));
-        jcp.normalize_variance = false;
-        mvn_mean_kernel.reset(new jit_uni_mvn_mean_variance_kernel_f32<cpu::x64::avx512_core>(jcp));
-        if (mvnAttrs.normalizeVariance_) {
-            jcp.normalize_variance = true;
-            mvn_variance_kernel.reset(new jit_uni_mvn_mean_variance_kernel_f32<cpu::x64::avx512_core>(jcp));
-        }
-    } else if (mayiuse(cpu::x64::avx2)) {
-        mvn_kernel.reset(new jit_uni_mvn_kernel_f32<cpu::x64::avx2>(jcp, *attr.get()));
-        jcp.normalize_variance = false;
-        mvn_mean_kernel.reset(new jit_uni_mvn_mean_variance_kernel_f32<cpu::x64::avx2>(jcp));
-        if (mvnAttrs.normalizeVariance_) {
-            jcp.normalize_variance = true;
-            mvn_variance_kernel.reset(new jit_uni_mvn_mean_variance_kernel_f32<cpu::x64::avx2>(jcp));
+        if (mayiuse(cpu::x64::avx512_core)) {
+            kernel.reset(new jit_uni_mvn_kernel_f32<cpu::x64::avx512_core>(key.jcp, *key.attr.get()));
+        } else if (mayiuse(cpu::x64::avx2)) {
+            kernel.reset(new jit_uni_mvn_kernel_f32<cpu::x64::avx2>(key.jcp, *key.attr.get()));
+        } else if (mayiuse(cpu::x64::sse41)) {
+            kernel.reset(new jit_uni_mvn_kernel_f32<cpu::x64::sse41>(key.jcp, *key.attr.get()));
+        } else {
+            IE_THROW() << "Can't create jit MVN kernel";
         }
-    } else if (mayiuse(cpu::x64::sse41)) {
-        mvn_kernel.reset(new jit_uni_mvn_kernel_f32<cpu::x64::sse41>(jcp, *attr.get()));
-        jcp.normalize_variance = false;
-        mvn_mean_kernel.reset(new jit_uni_mvn_mean_variance_kernel_f32<cpu::x64::sse41>(jcp));
-        if (mvnAttrs.normalizeVariance_) {
-            jcp.normalize_variance = true;
-            mvn_variance_kernel.reset(new jit_uni_mvn_mean_variance_kernel_f32<cpu::x64::sse41>(jcp));
+#endif // OPENVINO_ARCH_X86_64
+        if (kernel)
+            kernel->create_ker();
+        return kernel;
+    };
+    auto meanVarianceBuilder = [](const MVNKernelKey& key) -> std::shared_ptr<jit_uni_mvn_mean_variance_kernel> {
+        std::shared_ptr<jit_uni_mvn_mean_variance_kernel> kernel;
+#if defined(OPENVINO_ARCH_X86_64)
+        if (mayiuse(cpu::x64::avx512_core)) {
+            kernel.reset(new jit_uni_mvn_mean_variance_kernel_f32<cpu::x64::avx512_core>(key.jcp));
+        } else if (mayiuse(cpu::x64::avx2)) {
+            kernel.reset(new jit_uni_mvn_mean_variance_kernel_f32<cpu::x64::avx2>(key.jcp));
+        } else if (mayiuse(cpu::x64::sse41)) {
+            kernel.reset(new jit_uni_mvn_mean_variance_kernel_f32<cpu::x64::sse41>(key.jcp));
         }
-    } else {
-        IE_THROW() << "Can't create jit MVN kernel";
-    }
 #endif // OPENVINO_ARCH_X86_64
-    if (mvn_kernel)
-        mvn_kernel->create_ker();
-    if (mvn_mean_kernel)
-        mvn_mean_kernel->create_ker();
-    if (mvn_variance_kernel)
-        mvn_variance_kernel->create_ker();
+        if (kernel)
+            kernel->create_ker();
+        return kernel;
+    };
+
+    // the identical kernels of the nodes, the graphs and the streams are generated once
+    auto& registry = JitKernelRegistry::instance();
+    mvn_kernel = registry.getOrCreate<jit_uni_mvn_kernel>(MVNKernelKey{jcp, attr}, mvnBuilder);
+    // the mean and the variance kernels don't depend on the post ops
+    jcp.normalize_variance = false;
+    mvn_mean_kernel = registry.getOrCreate<jit_uni_mvn_mean_variance_kernel>(
+        MVNKernelKey{jcp, dnnl::primitive_attr()}, meanVarianceBuilder);
+    if (mvnAttrs.normalizeVariance_) {
+        jcp.normalize_variance = true;
+        mvn_variance_kernel = registry.getOrCreate<jit_uni_mvn_mean_variance_kernel>(
+            MVNKernelKey{jcp, dnnl::primitive_attr()}, meanVarianceBuilder);
+    }
 }
 
 void MVN::MVNJitExecutor::exec(const uint8_t *src_data, uint8_t *dst_data, const void *post_ops_data_) {
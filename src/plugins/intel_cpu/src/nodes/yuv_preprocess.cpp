@@ -0,0 +1,385 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+#include "yuv_preprocess.h"
+#include "ie_parallel.hpp"
+#include "transformations/cpu_opset/common/op/yuv_preprocess.hpp"
+
+using namespace InferenceEngine;
+using namespace dnnl::impl::cpu;
+
+namespace ov {
+namespace intel_cpu {
+namespace node {
+namespace {
+class YUVPreprocessShapeInfer : public ShapeInferEmptyPads {
+public:
+    YUVPreprocessShapeInfer(bool singlePlane, size_t outHeight, size_t outWidth)
+        : m_singlePlane(singlePlane), m_outHeight(outHeight), m_outWidth(outWidth) {}
+    Result infer(
+        const std::vector<std::reference_wrapper<const VectorDims>>& input_shapes,
+        const std::unordered_map<size_t, MemoryPtr>& data_dependency) override {
+        const auto& srcDims = input_shapes[0].get();
+        VectorDims outputShape{srcDims[0], 3, m_singlePlane ? srcDims[1] * 2 / 3 : srcDims[1], srcDims[2]};
+        if (m_outHeight != 0 && m_outWidth != 0) {
+            outputShape[2] = m_outHeight;
+            outputShape[3] = m_outWidth;
+        }
+        return {{std::move(outputShape)}, ShapeInferStatus::success};
+    }
+    port_mask_t get_port_mask() const override {
+        return EMPTY_PORT_MASK;
+    }
+
+private:
+    bool m_singlePlane;
+    size_t m_outHeight;
+    size_t m_outWidth;
+};
+
+class YUVPreprocessShapeInferFactory : public ShapeInferFactory {
+public:
+    YUVPreprocessShapeInferFactory(const std::shared_ptr<ov::Node>& op) : m_op(op) {}
+    ShapeInferPtr makeShapeInfer() const override {
+        auto preprocess = ov::as_type_ptr<YUVPreprocessNode>(m_op);
+        if (!preprocess) {
+            IE_THROW(Unexpected) << "Wrong operation type";
+        }
+        const auto& attrs = preprocess->get_attrs();
+        return std::make_shared<YUVPreprocessShapeInfer>(preprocess->get_input_size() == 1, attrs.out_height, attrs.out_width);
+    }
+private:
+    std::shared_ptr<ov::Node> m_op;
+};
+
+// half pixel source coordinate of the output pixel
+float getSourceCoordinate(size_t outCoord, size_t inLength, size_t outLength) {
+    const float scale = static_cast<float>(outLength) / static_cast<float>(inLength);
+    return (static_cast<float>(outCoord) + 0.5f) / scale - 0.5f;
+}
+
+// source pixels and the weight of the second one for the linear or the round prefer floor nearest resize
+void getSourcePixels(size_t outCoord, size_t inLength, size_t outLength, bool nearest,
+                     size_t& first, size_t& second, float& secondWeight) {
+    const float maxCoord = static_cast<float>(inLength - 1);
+    float inCoord = getSourceCoordinate(outCoord, inLength, outLength);
+    if (nearest) {
+        const float rounded = inCoord == std::floor(inCoord) + 0.5f ? std::floor(inCoord) : std::round(inCoord);
+        first = second = static_cast<size_t>(std::min(std::max(rounded, 0.f), maxCoord));
+        secondWeight = 0.f;
+        return;
+    }
+    inCoord = std::min(std::max(inCoord, 0.f), maxCoord);
+    first = static_cast<size_t>(std::floor(inCoord));
+    second = std::min(first + 1, inLength - 1);
+    secondWeight = inCoord - static_cast<float>(first);
+}
+}   // namespace
+
+bool YUVPreprocess::isSupportedOperation(const std::shared_ptr<const ov::Node>& op, std::string& errorMessage) noexcept {
+    try {
+        const auto preprocess = ov::as_type_ptr<const YUVPreprocessNode>(op);
+        if (!preprocess) {
+            errorMessage = "Only YUVPreprocess from CPU internal opset is supported";
+            return false;
+        }
+    } catch (...) {
+        return false;
+    }
+
+    return true;
+}
+
+YUVPreprocess::YUVPreprocess(const std::shared_ptr<ov::Node>& op, const GraphContext::CPtr& context)
+    : Node(op, context, YUVPreprocessShapeInferFactory(op)) {
+    std::string errorMessage;
+    if (!isSupportedOperation(op, errorMessage)) {
+        IE_THROW(NotImplemented) << errorMessage;
+    }
+
+    const auto& attrs = ov::as_type_ptr<const YUVPreprocessNode>(op)->get_attrs();
+    i420 = attrs.i420;
+    bgr = attrs.bgr;
+    nearest = attrs.nearest;
+    mean = attrs.mean;
+    scale = attrs.scale;
+}
+
+bool YUVPreprocess::useJitKernels() const {
+#if defined(OPENVINO_ARCH_X86_64)
+    return x64::mayiuse(x64::avx2);
+#else
+    return false;
+#endif
+}
+
+void YUVPreprocess::initSupportedPrimitiveDescriptors() {
+    if (!supportedPrimitiveDescriptors.empty())
+        return;
+
+    srcPrecision = getOriginalInputPrecisionAtPort(0);
+    if (srcPrecision != Precision::U8 && srcPrecision != Precision::FP32) {
+        srcPrecision = Precision::FP32;
+    }
+
+    std::vector<PortConfigurator> inConfs(getOriginalInputsNumber(), {LayoutType::ncsp, srcPrecision});
+    impl_desc_type implType = impl_desc_type::ref_any;
+#if defined(OPENVINO_ARCH_X86_64)
+    if (useJitKernels())
+        implType = x64::mayiuse(x64::avx512_core) ? impl_desc_type::jit_avx512 : impl_desc_type::jit_avx2;
+#endif
+    addSupportedPrimDesc(inConfs, {{LayoutType::ncsp, Precision::FP32}}, implType);
+    // the first convolution usually takes the planar image, the blocked layouts spare a Reorder for other consumers
+#if defined(OPENVINO_ARCH_X86_64)
+    if (x64::mayiuse(x64::avx512_core))
+        addSupportedPrimDesc(inConfs, {{LayoutType::nCsp16c, Precision::FP32}}, implType);
+    else if (x64::mayiuse(x64::avx2))
+        addSupportedPrimDesc(inConfs, {{LayoutType::nCsp8c, Precision::FP32}}, implType);
+#endif
+}
+
+void YUVPreprocess::createKernels() {
+#if defined(OPENVINO_ARCH_X86_64)
+    if (!useJitKernels() || rowKernel)
+        return;
+
+    jit_yuv_preprocess_config_params jcp;
+    jcp.srcPrc = srcPrecision;
+    jcp.i420 = i420;
+    std::copy(mean.begin(), mean.end(), jcp.mean);
+    std::copy(scale.begin(), scale.end(), jcp.scale);
+    if (x64::mayiuse(x64::avx512_core)) {
+        rowKernel.reset(new jit_uni_yuv_row_kernel_f32<x64::avx512_core>(jcp));
+        resizeKernel.reset(new jit_uni_resize_row_kernel_f32<x64::avx512_core>(jcp));
+        kernelStep = x64::cpu_isa_traits<x64::avx512_core>::vlen / sizeof(float);
+    } else {
+        rowKernel.reset(new jit_uni_yuv_row_kernel_f32<x64::avx2>(jcp));
+        resizeKernel.reset(new jit_uni_resize_row_kernel_f32<x64::avx2>(jcp));
+        kernelStep = x64::cpu_isa_traits<x64::avx2>::vlen / sizeof(float);
+    }
+    rowKernel->create_ker();
+    resizeKernel->create_ker();
+#endif
+}
+
+void YUVPreprocess::prepareParams() {
+    const auto& srcDims = getParentEdgeAt(0)->getMemoryPtr()->getStaticDims();
+    const auto& dstDims = getChildEdgeAt(0)->getMemoryPtr()->getStaticDims();
+    const auto& dstDesc = getChildEdgeAt(0)->getMemoryPtr()->getDesc();
+
+    batch = srcDims[0];
+    srcHeight = getOriginalInputsNumber() == 1 ? srcDims[1] * 2 / 3 : srcDims[1];
+    srcWidth = srcDims[2];
+    dstHeight = dstDims[2];
+    dstWidth = dstDims[3];
+    dstBlockSize = 1lu;
+    if (dstDesc.hasLayoutType(LayoutType::nCsp16c))
+        dstBlockSize = 16lu;
+    else if (dstDesc.hasLayoutType(LayoutType::nCsp8c))
+        dstBlockSize = 8lu;
+    if (srcHeight % 2 != 0 || srcWidth % 2 != 0)
+        IE_THROW() << "YUVPreprocess node with name '" << getName() << "' requires even image height and width, got "
+                   << srcHeight << "x" << srcWidth;
+
+    createKernels();
+
+    leftOffsets.resize(dstWidth);
+    rightOffsets.resize(dstWidth);
+    rightWeights.resize(dstWidth);
+    for (size_t x = 0; x < dstWidth; x++) {
+        size_t left, right;
+        getSourcePixels(x, srcWidth, dstWidth, nearest, left, right, rightWeights[x]);
+        leftOffsets[x] = static_cast<int>(left * sizeof(float));
+        rightOffsets[x] = static_cast<int>(right * sizeof(float));
+    }
+
+    topRows.resize(dstHeight);
+    bottomRows.resize(dstHeight);
+    bottomWeights.resize(dstHeight);
+    for (size_t y = 0; y < dstHeight; y++) {
+        getSourcePixels(y, srcHeight, dstHeight, nearest, topRows[y], bottomRows[y], bottomWeights[y]);
+    }
+
+    threadBufferSize = 2 * 3 * srcWidth + (dstBlockSize > 1 ? 3 * dstWidth : 0);
+    rowsBuffer.resize(parallel_get_max_threads() * threadBufferSize);
+}
+
+template <typename T>
+void YUVPreprocess::convertRowRef(const T* y, const T* u, const T* v, size_t from, float* dst) const {
+    // the same conversion as in ColorConvert
+    auto clip = [&](float a) {
+        if (std::is_integral<T>())
+            a = std::round(a);
+        return std::min(std::max(a, 0.f), 255.f);
+    };
+    const size_t chromaStride = i420 ? 1 : 2;
+    for (size_t x = from; x < srcWidth; x++) {
+        const size_t chromaIdx = x / 2 * chromaStride;
+        const auto c = static_cast<float>(y[x]) - 16.f;
+        const auto d = static_cast<float>(u[chromaIdx]) - 128.f;
+        const auto e = static_cast<float>(v[chromaIdx]) - 128.f;
+        dst[x] = clip(1.164f * c + 1.596f * e);
+        dst[srcWidth + x] = clip(1.164f * c - 0.391f * d - 0.813f * e);
+        dst[2 * srcWidth + x] = clip(1.164f * c + 2.018f * d);
+    }
+}
+
+void YUVPreprocess::convertRow(size_t b, size_t row, float* dst) const {
+    const size_t typeSize = srcPrecision.size();
+    const size_t lumaSize = srcHeight * srcWidth;
+    const size_t chromaRow = row / 2;
+    const uint8_t* yPtr = nullptr;
+    const uint8_t* uPtr = nullptr;
+    const uint8_t* vPtr = nullptr;
+    if (getOriginalInputsNumber() == 1) {
+        const auto* src = reinterpret_cast<const uint8_t*>(getParentEdgeAt(0)->getMemoryPtr()->GetPtr()) +
+                          b * lumaSize * 3 / 2 * typeSize;
+        yPtr = src + row * srcWidth * typeSize;
+        if (i420) {
+            uPtr = src + (lumaSize + chromaRow * srcWidth / 2) * typeSize;
+            vPtr = uPtr + lumaSize / 4 * typeSize;
+        } else {
+            uPtr = src + (lumaSize + chromaRow * srcWidth) * typeSize;
+            vPtr = uPtr + typeSize;
+        }
+    } else {
+        yPtr = reinterpret_cast<const uint8_t*>(getParentEdgeAt(0)->getMemoryPtr()->GetPtr()) +
+               (b * lumaSize + row * srcWidth) * typeSize;
+        const auto* chroma = reinterpret_cast<const uint8_t*>(getParentEdgeAt(1)->getMemoryPtr()->GetPtr());
+        if (i420) {
+            const size_t offset = (b * lumaSize / 4 + chromaRow * srcWidth / 2) * typeSize;
+            uPtr = chroma + offset;
+            vPtr = reinterpret_cast<const uint8_t*>(getParentEdgeAt(2)->getMemoryPtr()->GetPtr()) + offset;
+        } else {
+            uPtr = chroma + (b * lumaSize / 2 + chromaRow * srcWidth) * typeSize;
+            vPtr = uPtr + typeSize;
+        }
+    }
+
+    size_t processed = 0lu;
+    if (rowKernel) {
+        jit_yuv_row_call_args args;
+        args.y = yPtr;
+        args.u = uPtr;
+        args.v = vPtr;
+        args.dst[0] = dst;
+        args.dst[1] = dst + srcWidth;
+        args.dst[2] = dst + 2 * srcWidth;
+        args.workAmount = srcWidth / kernelStep * kernelStep;
+        (*rowKernel)(&args);
+        processed = args.workAmount;
+    }
+    if (srcPrecision == Precision::U8) {
+        convertRowRef(yPtr, uPtr, vPtr, processed, dst);
+    } else {
+        convertRowRef(reinterpret_cast<const float*>(yPtr), reinterpret_cast<const float*>(uPtr),
+                      reinterpret_cast<const float*>(vPtr), processed, dst);
+    }
+}
+
+void YUVPreprocess::resizeRow(const float* top, const float* bottom, float bottomWeight, float* dst,
+                              size_t channelStride) const {
+    const float* tops[3];
+    const float* bottoms[3];
+    float* dsts[3];
+    for (size_t c = 0; c < 3; c++) {
+        const size_t srcChannel = bgr ? 2 - c : c;
+        tops[c] = top + srcChannel * srcWidth;
+        bottoms[c] = bottom + srcChannel * srcWidth;
+        dsts[c] = dst + c * channelStride;
+    }
+
+    size_t processed = 0lu;
+    if (resizeKernel) {
+        jit_resize_row_call_args args;
+        std::copy(tops, tops + 3, args.top);
+        std::copy(bottoms, bottoms + 3, args.bottom);
+        std::copy(dsts, dsts + 3, args.dst);
+        args.leftOffsets = leftOffsets.data();
+        args.rightOffsets = rightOffsets.data();
+        args.rightWeights = rightWeights.data();
+        args.bottomWeight = bottomWeight;
+        args.workAmount = dstWidth / kernelStep * kernelStep;
+        (*resizeKernel)(&args);
+        processed = args.workAmount;
+    }
+    for (size_t c = 0; c < 3; c++) {
+        for (size_t x = processed; x < dstWidth; x++) {
+            const size_t left = leftOffsets[x] / sizeof(float);
+            const size_t right = rightOffsets[x] / sizeof(float);
+            const float topValue = tops[c][left] + rightWeights[x] * (tops[c][right] - tops[c][left]);
+            const float bottomValue = bottoms[c][left] + rightWeights[x] * (bottoms[c][right] - bottoms[c][left]);
+            const float value = topValue + bottomWeight * (bottomValue - topValue);
+            dsts[c][x] = (value - mean[c]) * scale[c];
+        }
+    }
+}
+
+void YUVPreprocess::blockRow(const float* planar, float* dst) const {
+    for (size_t x = 0; x < dstWidth; x++) {
+        float* pixel = dst + x * dstBlockSize;
+        for (size_t c = 0; c < 3; c++)
+            pixel[c] = planar[c * dstWidth + x];
+        std::fill(pixel + 3, pixel + dstBlockSize, 0.f);
+    }
+}
+
+void YUVPreprocess::execute(dnnl::stream strm) {
+    auto* dstData = reinterpret_cast<float*>(getChildEdgeAt(0)->getMemoryPtr()->GetPtr());
+    const size_t rowSize = 3 * srcWidth;
+
+    parallel_nt(0, [&](const int ithr, const int nthr) {
+        size_t start(0lu), end(0lu);
+        splitter(batch * dstHeight, nthr, ithr, start, end);
+
+        // the rows of the same parity share the slot, so the upper and the lower rows never evict each other
+        float* cache = rowsBuffer.data() + ithr * threadBufferSize;
+        float* planarRow = cache + 2 * rowSize;
+        size_t cachedRows[2] = {SIZE_MAX, SIZE_MAX};
+        auto getRow = [&](size_t b, size_t row) {
+            const size_t slot = row % 2;
+            const size_t key = b * srcHeight + row;
+            float* rowData = cache + slot * rowSize;
+            if (cachedRows[slot] != key) {
+                convertRow(b, row, rowData);
+                cachedRows[slot] = key;
+            }
+            return rowData;
+        };
+
+        for (size_t i = start; i < end; i++) {
+            const size_t b = i / dstHeight;
+            const size_t y = i % dstHeight;
+            const float* top = getRow(b, topRows[y]);
+            const float* bottom = getRow(b, bottomRows[y]);
+            if (dstBlockSize == 1) {
+                resizeRow(top, bottom, bottomWeights[y], dstData + b * 3 * dstHeight * dstWidth + y * dstWidth,
+                          dstHeight * dstWidth);
+            } else {
+                // the three channels are in the single channel block
+                resizeRow(top, bottom, bottomWeights[y], planarRow, dstWidth);
+                blockRow(planarRow, dstData + (b * dstHeight + y) * dstWidth * dstBlockSize);
+            }
+        }
+    });
+}
+
+void YUVPreprocess::executeDynamicImpl(dnnl::stream strm) {
+    execute(strm);
+}
+
+bool YUVPreprocess::created() const {
+    return getType() == Type::YUVPreprocess;
+}
+
+}   // namespace node
+}   // namespace intel_cpu
+}   // namespace ov
@@ -0,0 +1,85 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <node.h>
+
+#include <memory>
+#include <string>
+#include <vector>
+#include "kernels/x64/yuv_preprocess_kernel.hpp"
+
+namespace ov {
+namespace intel_cpu {
+namespace node {
+
+/**
+ * Converts NV12 / I420 image to the planar (or nChw8c / nChw16c) normalized RGB / BGR tensor with the optional resize.
+ * The output rows are distributed between the threads, every thread converts only the source rows
+ * required by its output rows and keeps the last two of them, so no full size intermediate image is created.
+ */
+class YUVPreprocess : public Node {
+public:
+    YUVPreprocess(const std::shared_ptr<ov::Node>& op, const GraphContext::CPtr& context);
+
+    void getSupportedDescriptors() override {};
+    void initSupportedPrimitiveDescriptors() override;
+    void execute(dnnl::stream strm) override;
+    bool created() const override;
+
+    static bool isSupportedOperation(const std::shared_ptr<const ov::Node>& op, std::string& errorMessage) noexcept;
+
+protected:
+    void executeDynamicImpl(dnnl::stream strm) override;
+    void prepareParams() override;
+
+private:
+    bool useJitKernels() const;
+    void createKernels();
+    // converts the source row into the R, G, B rows of the buffer
+    void convertRow(size_t b, size_t row, float* dst) const;
+    template <typename T>
+    void convertRowRef(const T* y, const T* u, const T* v, size_t from, float* dst) const;
+    // writes the resized R, G, B rows, which are channelStride floats apart
+    void resizeRow(const float* top, const float* bottom, float bottomWeight, float* dst, size_t channelStride) const;
+    // moves the planar R, G, B rows into the channel block of the blocked output, the padded channels are zeroed
+    void blockRow(const float* planar, float* dst) const;
+
+    bool i420 = false;
+    bool bgr = false;
+    bool nearest = false;
+    std::vector<float> mean;
+    std::vector<float> scale;
+    InferenceEngine::Precision srcPrecision;
+
+    size_t batch = 0lu;
+    size_t srcHeight = 0lu;
+    size_t srcWidth = 0lu;
+    size_t dstHeight = 0lu;
+    size_t dstWidth = 0lu;
+    // channel block of the nChw8c / nChw16c output, 1 for the planar one
+    size_t dstBlockSize = 1lu;
+
+    // per output pixel source offsets in bytes and weights of the right pixels
+    std::vector<int> leftOffsets;
+    std::vector<int> rightOffsets;
+    std::vector<float> rightWeights;
+    // per output row source rows and weights of the bottom rows
+    std::vector<size_t> topRows;
+    std::vector<size_t> bottomRows;
+    std::vector<float> bottomWeights;
+    // two converted source rows per thread and the planar output row for the blocked output
+    std::vector<float> rowsBuffer;
+    size_t threadBufferSize = 0lu;
+
+    std::shared_ptr<jit_uni_yuv_row_kernel> rowKernel;
+    std::shared_ptr<jit_uni_resize_row_kernel> resizeKernel;
+    // number of pixels processed by the kernels at once, the rest of the row is processed by the reference code
+    size_t kernelStep = 0lu;
+};
+
+}   // namespace node
+}   // namespace intel_cpu
+}   // namespace ov
@@ -4,15 +4,89 @@
 
 #pragma once
 
+#include <array>
 #include <chrono>
+#include <cstdint>
+#include <memory>
 #include <ratio>
+#include <vector>
 
 namespace ov {
 namespace intel_cpu {
 
+class Node;
+
+/**
+ * Latency histogram with log-linear buckets: every power of two of nanoseconds is split into 8 sub-buckets,
+ * so percentiles are reported with the relative error below 6% and the histogram has fixed size.
+ */
+class LatencyHistogram {
+public:
+    static constexpr size_t subBucketsLog2 = 3;
+    static constexpr size_t subBuckets = 1 << subBucketsLog2;
+    static constexpr size_t maxValueLog2 = 48;
+    static constexpr size_t bucketsNum = (maxValueLog2 - subBucketsLog2 + 1) * subBuckets;
+
+    LatencyHistogram() { buckets.fill(0); }
+
+    void add(uint64_t ns) {
+        buckets[bucketIndex(ns)]++;
+        num++;
+    }
+
+    LatencyHistogram& operator+=(const LatencyHistogram& rhs) {
+        for (size_t i = 0; i < bucketsNum; i++)
+            buckets[i] += rhs.buckets[i];
+        num += rhs.num;
+        return *this;
+    }
+
+    uint64_t count() const { return num; }
+
+    // returns the middle of the bucket, which contains the requested percentile, in nanoseconds
+    uint64_t percentile(double p) const {
+        if (num == 0)
+            return 0;
+        const uint64_t rank = static_cast<uint64_t>(p / 100.0 * static_cast<double>(num - 1)) + 1;
+        uint64_t accumulated = 0;
+        for (size_t i = 0; i < bucketsNum; i++) {
+            accumulated += buckets[i];
+            if (accumulated >= rank)
+                return (bucketLowerBound(i) + bucketLowerBound(i + 1)) / 2;
+        }
+        return bucketLowerBound(bucketsNum);
+    }
+
+private:
+    static size_t bucketIndex(uint64_t value) {
+        if (value < subBuckets)
+            return static_cast<size_t>(value);
+        size_t msb = 0;
+        for (uint64_t v = value; v >>= 1;)
+            msb++;
+        if (msb >= maxValueLog2)
+            return bucketsNum - 1;
+        const size_t sub = static_cast<size_t>(value >> (msb - subBucketsLog2)) & (subBuckets - 1);
+        return (msb - subBucketsLog2 + 1) * subBuckets + sub;
+    }
+
+    static uint64_t bucketLowerBound(size_t index) {
+        if (index < subBuckets)
+            return index;
+        const size_t msb = index / subBuckets + subBucketsLog2 - 1;
+        const uint64_t sub = index % subBuckets;
+        return (subBuckets + sub) << (msb - subBucketsLog2);
+    }
+
+    std::array<uint32_t, bucketsNum> buckets;
+    uint64_t num = 0;
+};
+
 class PerfCount {
     uint64_t total_duration;
     uint32_t num;
+    // the histogram takes about 1.5KB, so it's allocated on the first measurement, which is done with profiling only
+    std::unique_ptr<LatencyHistogram> histogram;
 
     std::chrono::high_resolution_clock::time_point __start = {};
     std::chrono::high_resolution_clock::time_point __finish = {};
@@ -24,8 +98,15 @@ public:
         return __finish - __start;
     }
 
+    std::chrono::high_resolution_clock::time_point start() const { return __start; }
+    std::chrono::high_resolution_clock::time_point finish() const { return __finish; }
+
     uint64_t avg() const { return (num == 0) ? 0 : total_duration / num; }
     uint32_t count() const { return num; }
+    const LatencyHistogram& latency() const {
+        static const LatencyHistogram empty;
+        return histogram ? *histogram : empty;
+    }
 
 private:
     void start_itr() {
@@ -35,23 +116,75 @@ private:
     void finish_itr() {
         __finish = std::chrono::high_resolution_clock::now();
         total_duration += std::chrono::duration_cast<std::chrono::microseconds>(__finish - __start).count();
+        if (!histogram)
+            histogram.reset(new LatencyHistogram());
+        histogram->add(std::chrono::duration_cast<std::chrono::nanoseconds>(__finish - __start).count());
         num++;
     }
 
     friend class PerfHelper;
 };
 
+/**
+ * Bounded buffer of the latest node executions of a graph, which is exported as a Chrome trace.
+ * The memory is allocated on the first record only, so the buffer costs nothing while profiling is disabled.
+ */
+class PerfTrace {
+public:
+    struct Event {
+        const Node* node;
+        std::chrono::high_resolution_clock::time_point start;
+        std::chrono::high_resolution_clock::duration duration;
+    };
+
+    static constexpr size_t capacity = 1 << 16;
+
+    void record(const Node* node, const PerfCount& counter) {
+        if (events.empty())
+            events.resize(capacity);
+        events[next % capacity] = {node, counter.start(), counter.finish() - counter.start()};
+        next++;
+    }
+
+    void clear() {
+        events.clear();
+        next = 0;
+    }
+
+    // visits the events from the oldest to the newest one
+    template <typename Visitor>
+    void forEach(const Visitor& visitor) const {
+        const size_t num = next < capacity ? next : static_cast<size_t>(capacity);
+        for (size_t i = next - num; i < next; i++)
+            visitor(events[i % capacity]);
+    }
+
+private:
+    std::vector<Event> events;
+    size_t next = 0;
+};
+
 class PerfHelper {
-    PerfCount &counter;
+    PerfCount *counter;
+    PerfTrace *trace;
+    const Node *node;
 
 public:
-    explicit PerfHelper(PerfCount &count): counter(count) { counter.start_itr(); }
+    PerfHelper(PerfCount &count, PerfTrace &perfTrace, const Node *perfNode, bool enabled)
+        : counter(enabled ? &count : nullptr), trace(&perfTrace), node(perfNode) {
+        if (counter)
+            counter->start_itr();
+    }
 
-    ~PerfHelper() { counter.finish_itr(); }
+    ~PerfHelper() {
+        if (counter) {
+            counter->finish_itr();
+            trace->record(node, *counter);
+        }
+    }
 };
 
 }   // namespace intel_cpu
 }   // namespace ov
 
-#define GET_PERF(_node) std::unique_ptr<PerfHelper>(new PerfHelper(_node->PerfCounter()))
-#define PERF(_node, _need) auto pc = _need ? GET_PERF(_node) : nullptr;
+#define PERF(_node, _need) PerfHelper pc(_node->PerfCounter(), perfTrace, _node.get(), _need);
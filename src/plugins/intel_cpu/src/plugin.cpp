@@ -23,10 +23,38 @@
 
 #include <transformations/utils/utils.hpp>
 #include <ie_ngraph_utils.hpp>
+#include <openvino/core/validation_util.hpp>
+#include <openvino/op/constant.hpp>
+#include <openvino/op/cum_sum.hpp>
+#include <openvino/op/einsum.hpp>
+#include <openvino/op/embedding_segments_sum.hpp>
+#include <openvino/op/gather_elements.hpp>
+#include <openvino/op/log_softmax.hpp>
+#include <openvino/op/matmul.hpp>
+#include <openvino/op/mvn.hpp>
+#include <openvino/op/normalize_l2.hpp>
+#include <openvino/op/reverse.hpp>
+#include <openvino/op/reverse_sequence.hpp>
+#include <openvino/op/roll.hpp>
+#include <openvino/op/scatter_elements_update.hpp>
+#include <openvino/op/scatter_nd_update.hpp>
+#include <openvino/op/scatter_update.hpp>
+#include <openvino/op/shape_of.hpp>
+#include <openvino/op/softmax.hpp>
+#include <openvino/op/transpose.hpp>
+#include <openvino/op/util/convolution_base.hpp>
+#include <openvino/op/util/deformable_convolution_base.hpp>
+#include <openvino/op/util/embeddingbag_offsets_base.hpp>
+#include <openvino/op/util/embeddingbag_packed_base.hpp>
+#include <openvino/op/util/gather_base.hpp>
+#include <openvino/op/util/gather_nd_base.hpp>
+#include <openvino/op/util/multi_subgraph_base.hpp>
+#include <openvino/op/util/read_value_base.hpp>
 
 #include "performance_heuristics.hpp"
 #include "openvino/runtime/properties.hpp"
 #include "weights_cache.hpp"
+#include "cache/jit_kernel_registry.h"
 #include "utils/denormals.hpp"
 
 #if defined(__linux__)
@@ -148,6 +176,7 @@ Engine::~Engine() {
     executorManager()->clear("CPU");
     executorManager()->clear("CPUStreamsExecutor");
     executorManager()->clear("CPUCallbackExecutor");
+    executorManager()->clear("CPULazyCompilation");
 }
 
 static bool streamsSet(const std::map<std::string, std::string>& config) {
@@ -431,6 +460,207 @@ static Config::SnippetsMode getSnippetsMode(const std::map<std::string, std::str
         IE_THROW() << "Wrong value for property key SNIPPETS_MODE. Expected values: ENABLE/DISABLE/IGNORE_CALLBACK";
 }
 
+/* The ops, which may mix the elements of the sequences along the batch axis keeping the shapes, e.g. the normalizations
+ * along the batch axis, the contractions of the batched weights or the gathers and the scatters of the rows.
+ * The ops changing the shape along the batch axis are found by the shapes, see keepsSequencesApart().
+ */
+static bool mayMixBatch(const std::shared_ptr<ov::Node>& op, const std::function<bool(size_t)>& isBatchedInput) {
+    if (op->get_input_size() == 0)
+        return false;
+    const auto rank = op->get_input_partial_shape(0).rank();
+    if (rank.is_dynamic())
+        return true;
+    auto hasBatchAxis = [&rank](const std::vector<int64_t>& axes) {
+        return std::any_of(axes.begin(), axes.end(), [&rank](int64_t axis) {
+            return axis == 0 || axis + rank.get_length() == 0;
+        });
+    };
+    // the axes, which are not constant, are treated as the batch one
+    auto hasConstantBatchAxis = [&](size_t port) {
+        const auto axes = ov::get_constant_from_source(op->input_value(port));
+        return !axes || hasBatchAxis(axes->cast_vector<int64_t>());
+    };
+    auto hasReductionBatchAxis = [](const ov::AxisSet& axes) {
+        return axes.count(0) != 0;
+    };
+
+    if (ov::is_type<ov::op::util::MultiSubGraphOp>(op) || ov::is_type<ov::op::v7::Einsum>(op)) {
+        // e.g. the iterations of TensorIterator may be sliced along the batch axis
+        return true;
+    } else if (auto matMul = ov::as_type_ptr<ov::op::v0::MatMul>(op)) {
+        // the first dimension is the batch of the multiplication only for the inputs of rank 3 and more,
+        // otherwise it is the rows of the first input or the contracted dimension of the second one
+        const auto rankA = matMul->get_input_partial_shape(0).rank();
+        const auto rankB = matMul->get_input_partial_shape(1).rank();
+        if (rankA.is_dynamic() || rankB.is_dynamic())
+            return true;
+        return (isBatchedInput(0) && rankA.get_length() < 3 && (rankA.get_length() < 2 || matMul->get_transpose_a())) ||
+               (isBatchedInput(1) && rankB.get_length() < 3);
+    } else if (ov::is_type<ov::op::util::ConvolutionBase>(op)) {
+        // the batched filters would be the output channels, the offsets and the mask of the deformable ones are per sample
+        return isBatchedInput(ov::is_type<ov::op::util::DeformableConvolutionBase>(op) ? 2 : 1);
+    } else if (auto softmax = ov::as_type_ptr<ov::op::v1::Softmax>(op)) {
+        return hasBatchAxis({static_cast<int64_t>(softmax->get_axis())});
+    } else if (auto softmax = ov::as_type_ptr<ov::op::v8::Softmax>(op)) {
+        return hasBatchAxis({softmax->get_axis()});
+    } else if (auto logSoftmax = ov::as_type_ptr<ov::op::v5::LogSoftmax>(op)) {
+        return hasBatchAxis({logSoftmax->get_axis()});
+    } else if (auto mvn = ov::as_type_ptr<ov::op::v0::MVN>(op)) {
+        return hasReductionBatchAxis(mvn->get_reduction_axes());
+    } else if (ov::is_type<ov::op::v6::MVN>(op) || ov::is_type<ov::op::v0::CumSum>(op)) {
+        return hasConstantBatchAxis(1);
+    } else if (auto normalize = ov::as_type_ptr<ov::op::v0::NormalizeL2>(op)) {
+        return hasReductionBatchAxis(normalize->get_reduction_axes());
+    } else if (ov::is_type<ov::op::v7::Roll>(op)) {
+        return hasConstantBatchAxis(2);
+    } else if (auto reverse = ov::as_type_ptr<ov::op::v1::Reverse>(op)) {
+        if (reverse->get_mode() == ov::op::v1::Reverse::Mode::INDEX)
+            return hasConstantBatchAxis(1);
+        const auto mask = ov::get_constant_from_source(reverse->input_value(1));
+        return !mask || mask->cast_vector<bool>().front();
+    } else if (auto reverseSequence = ov::as_type_ptr<ov::op::v0::ReverseSequence>(op)) {
+        return reverseSequence->get_sequence_axis() == 0;
+    } else if (ov::is_type<ov::op::v1::Transpose>(op)) {
+        // the empty order reverses the dimensions
+        const auto order = ov::get_constant_from_source(op->input_value(1));
+        return !order || order->cast_vector<int64_t>().empty() || order->cast_vector<int64_t>().front() != 0;
+    } else if (auto gather = ov::as_type_ptr<ov::op::util::GatherBase>(op)) {
+        auto batchDims = gather->get_batch_dims();
+        const auto indicesRank = gather->get_input_partial_shape(1).rank();
+        if (batchDims < 0 && indicesRank.is_static())
+            batchDims += indicesRank.get_length();
+        // the rows of the data and of the indices are gathered pairwise
+        if (batchDims > 0)
+            return false;
+        // the lookup of the rows of a table, which is not batched, or the gather within the rows
+        const auto axis = ov::get_constant_from_source(op->input_value(2));
+        if (!axis)
+            return true;
+        const bool alongBatch = hasBatchAxis(axis->cast_vector<int64_t>());
+        if (!isBatchedInput(0))
+            return !alongBatch;
+        return alongBatch || isBatchedInput(1);
+    } else if (auto gatherElements = ov::as_type_ptr<ov::op::v6::GatherElements>(op)) {
+        return isBatchedInput(0) && hasBatchAxis({gatherElements->get_axis()});
+    } else if (auto gatherND = ov::as_type_ptr<ov::op::util::GatherNDBase>(op)) {
+        // the indices address the data starting from the first dimension after the batch ones
+        return isBatchedInput(0) && gatherND->get_batch_dims() == 0;
+    } else if (ov::is_type<ov::op::v3::ScatterUpdate>(op)) {
+        // the indices are placed between the leading and the trailing dimensions of the updates
+        return hasConstantBatchAxis(3) || isBatchedInput(1);
+    } else if (ov::is_type<ov::op::v3::ScatterElementsUpdate>(op)) {
+        return hasConstantBatchAxis(3);
+    } else if (ov::is_type<ov::op::v3::ScatterNDUpdate>(op) || ov::is_type<ov::op::v3::EmbeddingSegmentsSum>(op) ||
+               ov::is_type<ov::op::util::EmbeddingBagOffsetsBase>(op)) {
+        // the indices address the rows of the data, the segments and the bags are not aligned with the rows
+        return true;
+    } else if (ov::is_type<ov::op::util::EmbeddingBagPackedBase>(op)) {
+        return isBatchedInput(0);
+    }
+    return false;
+}
+
+/* Checks that the rows of the batch are computed independently: each tensor computed from the inputs or the states
+ * keeps the batch in its first dimension and no op mixes the rows. The shape subgraphs, e.g. ShapeOf, are not batched.
+ */
+static bool keepsSequencesApart(const std::shared_ptr<const ov::Model>& function, int64_t batch) {
+    std::unordered_set<const ov::Node*> batched;
+    for (const auto& op : function->get_ordered_ops()) {
+        bool isBatched = ov::is_type<ov::op::v0::Parameter>(op) || ov::is_type<ov::op::util::ReadValueBase>(op);
+        if (!ov::is_type<ov::op::v0::ShapeOf>(op) && !ov::is_type<ov::op::v3::ShapeOf>(op)) {
+            for (const auto& input : op->input_values())
+                isBatched = isBatched || batched.count(input.get_node()) != 0;
+        }
+        if (!isBatched)
+            continue;
+        auto isBatchedInput = [&](size_t port) {
+            return batched.count(op->get_input_node_ptr(port)) != 0;
+        };
+        if (mayMixBatch(op, isBatchedInput))
+            return false;
+        for (const auto& output : op->outputs()) {
+            const auto& shape = output.get_partial_shape();
+            if (shape.rank().is_dynamic() || shape.rank().get_length() == 0 || shape[0] != batch)
+                return false;
+        }
+        batched.insert(op.get());
+    }
+    return true;
+}
+
+/* The stateful network reshaped to the batch of the sequences of the continuous batching.
+ * The batch must be the first dimension of the inputs, the outputs and the states, which is 1 in the original network,
+ * otherwise the batching is not applicable and the returned network is empty.
+ */
+static CNNNetwork makeBatchedNetwork(const CNNNetwork& network, size_t batch) {
+    const auto function = network.getFunction();
+    if (!function || function->is_dynamic())
+        return {};
+    auto isBatchOne = [](const ov::PartialShape& shape) {
+        return shape.rank().is_static() && shape.rank().get_length() > 0 && shape[0] == 1;
+    };
+    auto batchedShape = [batch](ov::PartialShape shape) {
+        shape[0] = static_cast<int64_t>(batch);
+        return shape;
+    };
+    std::map<std::string, ov::PartialShape> states;
+    for (const auto& op : function->get_ops()) {
+        if (auto readValue = ov::as_type_ptr<ov::op::util::ReadValueBase>(op)) {
+            if (!isBatchOne(readValue->get_output_partial_shape(0)))
+                return {};
+            states[readValue->get_variable_id()] = batchedShape(readValue->get_output_partial_shape(0));
+        }
+    }
+    if (states.empty() || !keepsSequencesApart(function, 1))
+        return {};
+    for (const auto& parameter : function->get_parameters()) {
+        if (!isBatchOne(parameter->get_output_partial_shape(0)))
+            return {};
+    }
+    for (const auto& result : function->get_results()) {
+        if (!isBatchOne(result->get_output_partial_shape(0)))
+            return {};
+    }
+
+    try {
+        CNNNetwork batchedNetwork = InferenceEngine::details::cloneNetwork(network);
+        const auto batchedFunction = batchedNetwork.getFunction();
+        // the plugin starts the states from zeros ignoring the initializers, so they are replaced with the batched zeros
+        for (const auto& op : batchedFunction->get_ops()) {
+            auto readValue = ov::as_type_ptr<ov::op::util::ReadValueBase>(op);
+            if (!readValue)
+                continue;
+            const auto type = readValue->get_output_element_type(0);
+            const auto shape = states.at(readValue->get_variable_id()).to_shape();
+            if (auto variable = readValue->get_variable())
+                variable->update({shape, type, readValue->get_variable_id()});
+            readValue->input(0).replace_source_output(ov::op::v0::Constant::create(type, shape, {0}));
+        }
+        ICNNNetwork::InputShapes inputShapes;
+        for (const auto& parameter : batchedFunction->get_parameters())
+            inputShapes[parameter->get_friendly_name()] = batchedShape(parameter->get_output_partial_shape(0)).to_shape();
+        batchedNetwork.reshape(inputShapes);
+
+        // the batch must not be mixed with the other dimensions, e.g. by the reshapes with the constant target shapes
+        if (!keepsSequencesApart(batchedFunction, static_cast<int64_t>(batch)))
+            return {};
+        const auto& results = function->get_results();
+        const auto& batchedResults = batchedFunction->get_results();
+        for (size_t i = 0; i < results.size(); i++) {
+            if (batchedResults[i]->get_output_partial_shape(0) != batchedShape(results[i]->get_output_partial_shape(0)))
+                return {};
+        }
+        for (const auto& op : batchedFunction->get_ops()) {
+            auto readValue = ov::as_type_ptr<ov::op::util::ReadValueBase>(op);
+            if (readValue && readValue->get_output_partial_shape(0) != states.at(readValue->get_variable_id()))
+                return {};
+        }
+        return batchedNetwork;
+    } catch (...) {
+        return {};
+    }
+}
+
 InferenceEngine::IExecutableNetworkInternal::Ptr
 Engine::LoadExeNetworkImpl(const InferenceEngine::CNNNetwork &network, const std::map<std::string, std::string> &orig_config) {
     OV_ITT_SCOPED_TASK(itt::domains::intel_cpu, "Engine::LoadExeNetworkImpl");
@@ -497,6 +727,20 @@ Engine::LoadExeNetworkImpl(const InferenceEngine::CNNNetwork &network, const std
     if (is_cpu_map_available()) {
         GetPerformanceStreams(conf, nGraphFunc);
     }
+    // the batched network is transformed the same way, but it is not used by the legacy API infer requests
+    CNNNetwork batchedNetwork;
+    if (conf.continuousBatching > 1 && !isLegacyAPI()) {
+        batchedNetwork = makeBatchedNetwork(network, conf.continuousBatching);
+        if (auto batchedFunc = batchedNetwork.getFunction()) {
+            Transformations batchedTransformations(batchedFunc, enableLPT, enableBF16, isLegacyAPI(), snippetsMode, engConfig);
+            batchedTransformations.UpToCpuSpecificOpSet();
+            batchedTransformations.CpuSpecificOpSet();
+        }
+    }
+    // the warmup shapes are exported with the model, so the model imported from the cache is prepared the same way
+    if (!conf.warmupShapes.empty()) {
+        nGraphFunc->set_rt_info(conf.warmupShapes, "intel_cpu_warmup_shapes");
+    }
 
     // SSE runtime check is needed for some ATOM machine, which is x86-64 but w/o SSE
     static Xbyak::util::Cpu cpu;
@@ -510,7 +754,7 @@ Engine::LoadExeNetworkImpl(const InferenceEngine::CNNNetwork &network, const std
         }
     }
 
-    return std::make_shared<ExecNetwork>(clonedNetwork, conf, extensionManager, shared_from_this());
+    return std::make_shared<ExecNetwork>(clonedNetwork, conf, extensionManager, shared_from_this(), batchedNetwork);
 }
 
 void Engine::SetConfig(const std::map<std::string, std::string> &config) {
@@ -568,7 +812,8 @@ Parameter Engine::GetConfig(const std::string& name, const std::map<std::string,
         return decltype(ov::enable_profiling)::value_type(perfCount);
     } else if (name == ov::hint::inference_precision) {
         const auto enforceBF16 = engConfig.enforceBF16;
-        const auto inference_precision = enforceBF16 ? ov::element::bf16 : ov::element::f32;
+        const auto enforceFP16 = engConfig.enforceFP16;
+        const auto inference_precision = enforceBF16 ? ov::element::bf16 : enforceFP16 ? ov::element::f16 : ov::element::f32;
         return decltype(ov::hint::inference_precision)::value_type(inference_precision);
     } else if (name == ov::hint::performance_mode) {
         const auto perfHint = ov::util::from_string(engConfig.perfHintsConfig.ovPerfHint, ov::hint::performance_mode);
@@ -587,6 +832,8 @@ Parameter Engine::GetConfig(const std::string& name, const std::map<std::string,
         return decltype(ov::hint::num_requests)::value_type(perfHintNumRequests);
     } else if (name == ov::hint::execution_mode) {
         return engConfig.executionMode;
+    } else if (name == ov::hint::model_priority) {
+        return engConfig.modelPriority;
     }
     /* Internally legacy parameters are used with new API as part of migration procedure.
      * This fallback can be removed as soon as migration completed */
@@ -663,6 +910,7 @@ Parameter Engine::GetMetric(const std::string& name, const std::map<std::string,
                                                     RO_property(ov::device::full_name.name()),
                                                     RO_property(ov::device::capabilities.name()),
                                                     RO_property(ov::caching_properties.name()),
+                                                    RO_property(ov::intel_cpu::jit_kernel_cache_stats.name()),
         };
         // the whole config is RW before model is loaded.
         std::vector<ov::PropertyName> rwProperties {RW_property(ov::num_streams.name()),
@@ -672,6 +920,7 @@ Parameter Engine::GetMetric(const std::string& name, const std::map<std::string,
                                                     RW_property(ov::hint::inference_precision.name()),
                                                     RW_property(ov::hint::performance_mode.name()),
                                                     RW_property(ov::hint::execution_mode.name()),
+                                                    RW_property(ov::hint::model_priority.name()),
                                                     RW_property(ov::hint::num_requests.name()),
                                                     RW_property(ov::hint::enable_cpu_pinning.name()),
                                                     RW_property(ov::hint::scheduling_core_type.name()),
@@ -679,6 +928,14 @@ Parameter Engine::GetMetric(const std::string& name, const std::map<std::string,
                                                     RW_property(ov::device::id.name()),
                                                     RW_property(ov::intel_cpu::denormals_optimization.name()),
                                                     RW_property(ov::intel_cpu::sparse_weights_decompression_rate.name()),
+                                                    RW_property(ov::intel_cpu::profiling_sampling_rate.name()),
+                                                    RW_property(ov::intel_cpu::warmup_shapes.name()),
+                                                    RW_property(ov::intel_cpu::huge_pages.name()),
+                                                    RW_property(ov::intel_cpu::numa_aware_allocation.name()),
+                                                    RW_property(ov::intel_cpu::prefault_memory.name()),
+                                                    RW_property(ov::intel_cpu::lazy_compilation.name()),
+                                                    RW_property(ov::intel_cpu::parallel_compilation.name()),
+                                                    RW_property(ov::intel_cpu::continuous_batching.name()),
         };
 
         std::vector<ov::PropertyName> supportedProperties;
@@ -717,6 +974,25 @@ Parameter Engine::GetMetric(const std::string& name, const std::map<std::string,
         return decltype(ov::intel_cpu::denormals_optimization)::value_type(engConfig.denormalsOptMode == Config::DenormalsOptMode::DO_On);
     } else if (name == ov::intel_cpu::sparse_weights_decompression_rate) {
         return decltype(ov::intel_cpu::sparse_weights_decompression_rate)::value_type(engConfig.fcSparseWeiDecompressionRate);
+    } else if (name == ov::intel_cpu::profiling_sampling_rate) {
+        return decltype(ov::intel_cpu::profiling_sampling_rate)::value_type(engConfig.perfCountersSamplingRate);
+    } else if (name == ov::intel_cpu::warmup_shapes) {
+        return decltype(ov::intel_cpu::warmup_shapes)::value_type(engConfig.warmupShapes);
+    } else if (name == ov::intel_cpu::huge_pages) {
+        return engConfig.hugePages;
+    } else if (name == ov::intel_cpu::numa_aware_allocation) {
+        return decltype(ov::intel_cpu::numa_aware_allocation)::value_type(engConfig.numaAwareAllocation);
+    } else if (name == ov::intel_cpu::prefault_memory) {
+        return decltype(ov::intel_cpu::prefault_memory)::value_type(engConfig.prefaultMemory);
+    } else if (name == ov::intel_cpu::lazy_compilation) {
+        return decltype(ov::intel_cpu::lazy_compilation)::value_type(engConfig.lazyCompilation);
+    } else if (name == ov::intel_cpu::parallel_compilation) {
+        return decltype(ov::intel_cpu::parallel_compilation)::value_type(engConfig.parallelCompilation);
+    } else if (name == ov::intel_cpu::continuous_batching) {
+        return decltype(ov::intel_cpu::continuous_batching)::value_type(engConfig.continuousBatching);
+    } else if (name == ov::intel_cpu::jit_kernel_cache_stats) {
+        return decltype(ov::intel_cpu::jit_kernel_cache_stats)::value_type(
+            JitKernelRegistry::instance().getStats().toJson());
     }
     /* Internally legacy parameters are used with new API as part of migration procedure.
      * This fallback can be removed as soon as migration completed */
@@ -801,6 +1077,11 @@ InferenceEngine::IExecutableNetworkInternal::Ptr Engine::ImportNetwork(std::istr
         }
     }
 
+    if (function->has_rt_info("intel_cpu_warmup_shapes") && conf.warmupShapes.empty()) {
+        conf.readProperties({{std::string(ov::intel_cpu::warmup_shapes.name()),
+                              function->get_rt_info<std::string>("intel_cpu_warmup_shapes")}});
+    }
+
     if (is_cpu_map_available()) {
         get_num_streams(conf.streamExecutorConfig._streams, function, conf);
     }
@@ -0,0 +1,56 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "yuv_preprocess.hpp"
+#include "transformations/itt.hpp"
+
+ov::intel_cpu::YUVPreprocessNode::YUVPreprocessNode(const ov::OutputVector& planes, const Attributes& attrs)
+    : Op(planes), m_attrs(attrs) {
+    validate_and_infer_types();
+}
+
+std::shared_ptr<ov::Node> ov::intel_cpu::YUVPreprocessNode::clone_with_new_inputs(const ov::OutputVector& new_args) const {
+    INTERNAL_OP_SCOPE(YUVPreprocessNode_clone_with_new_inputs);
+    check_new_args_count(this, new_args);
+    return std::make_shared<ov::intel_cpu::YUVPreprocessNode>(new_args, m_attrs);
+}
+
+bool ov::intel_cpu::YUVPreprocessNode::visit_attributes(ov::AttributeVisitor &visitor) {
+    INTERNAL_OP_SCOPE(YUVPreprocessNode_visit_attributes);
+    visitor.on_attribute("i420", m_attrs.i420);
+    visitor.on_attribute("bgr", m_attrs.bgr);
+    visitor.on_attribute("nearest", m_attrs.nearest);
+    visitor.on_attribute("out_height", m_attrs.out_height);
+    visitor.on_attribute("out_width", m_attrs.out_width);
+    visitor.on_attribute("mean", m_attrs.mean);
+    visitor.on_attribute("scale", m_attrs.scale);
+    return true;
+}
+
+void ov::intel_cpu::YUVPreprocessNode::validate_and_infer_types() {
+    INTERNAL_OP_SCOPE(YUVPreprocessNode_validate_and_infer_types);
+    const size_t planesNum = get_input_size();
+    NGRAPH_CHECK(planesNum == 1 || planesNum == (m_attrs.i420 ? 3 : 2), "Incorrect number of the image planes: ", planesNum);
+    NGRAPH_CHECK(m_attrs.mean.size() == 3 && m_attrs.scale.size() == 3, "Mean and scale must contain 3 values");
+
+    const auto& et = get_input_element_type(0);
+    NGRAPH_CHECK(et == ov::element::u8 || et == ov::element::f32, "Image must be u8 or f32 whereas current element type is", et);
+
+    const auto& shape = get_input_partial_shape(0);
+    NGRAPH_CHECK(shape.rank().compatible(4), "Image planes must have 4D shape whereas current shape is", shape);
+
+    ov::PartialShape out_shape{ov::Dimension::dynamic(), 3, ov::Dimension::dynamic(), ov::Dimension::dynamic()};
+    if (shape.rank().is_static()) {
+        out_shape[0] = shape[0];
+        out_shape[2] = shape[1];
+        out_shape[3] = shape[2];
+        if (planesNum == 1 && shape[1].is_static())
+            out_shape[2] = shape[1].get_length() * 2 / 3;
+    }
+    if (m_attrs.out_height != 0 && m_attrs.out_width != 0) {
+        out_shape[2] = m_attrs.out_height;
+        out_shape[3] = m_attrs.out_width;
+    }
+    set_output_type(0, ov::element::f32, out_shape);
+}
@@ -0,0 +1,58 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <openvino/core/node.hpp>
+#include <openvino/op/op.hpp>
+
+#include <vector>
+
+namespace ov {
+namespace intel_cpu {
+/**
+ * The operation converts NV12 / I420 image to RGB / BGR, resizes it, normalizes and stores as a planar tensor.
+ * It replaces the chain ConvertColor -> [Convert] -> [Interpolate] -> [Subtract] -> [Multiply] -> Transpose,
+ * which is produced by the preprocessing of the camera frames.
+ * Inputs:
+ *     1. Y or YUV planes of type T - shape [N, H, W, 1] or [N, H * 3 / 2, W, 1] for the single plane image. Required
+ *     2. UV plane for NV12 - shape [N, H / 2, W / 2, 2], U plane for I420 - shape [N, H / 2, W / 2, 1]. Optional
+ *     3. V plane for I420 - shape [N, H / 2, W / 2, 1]. Optional
+ * Outputs:
+ *     1. Normalized image of type FP32 and of shape [N, 3, out_height, out_width].
+ * Types:
+ *     T - U8 or FP32. The colors of the U8 image are rounded before the resize.
+ */
+class YUVPreprocessNode : public ov::op::Op {
+public:
+    OPENVINO_OP("YUVPreprocess", "cpu_plugin_opset");
+
+    struct Attributes {
+        bool i420 = false;
+        bool bgr = false;
+        // nearest neighbor or linear resize with the half pixel coordinate transformation
+        bool nearest = false;
+        // 0 means the original size of the image
+        size_t out_height = 0lu;
+        size_t out_width = 0lu;
+        // the output is (color - mean) * scale
+        std::vector<float> mean = {0.f, 0.f, 0.f};
+        std::vector<float> scale = {1.f, 1.f, 1.f};
+    };
+
+    YUVPreprocessNode() = default;
+    YUVPreprocessNode(const ov::OutputVector& planes, const Attributes& attrs);
+    std::shared_ptr<ov::Node> clone_with_new_inputs(const ov::OutputVector& new_args) const override;
+    bool visit_attributes(ov::AttributeVisitor& visitor) override;
+    void validate_and_infer_types() override;
+
+    const Attributes& get_attrs() const {
+        return m_attrs;
+    }
+
+private:
+    Attributes m_attrs;
+};
+}   // namespace intel_cpu
+}   // namespace ov
@@ -0,0 +1,369 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "depth_first_tiling.hpp"
+
+#include <algorithm>
+#include <functional>
+#include <memory>
+#include <numeric>
+#include <unordered_set>
+#include <vector>
+
+#include "openvino/core/rt_info.hpp"
+#include "openvino/opsets/opset1.hpp"
+#include "openvino/opsets/opset8.hpp"
+#include "openvino/op/util/binary_elementwise_arithmetic.hpp"
+#include "openvino/op/util/convolution_base.hpp"
+#include "openvino/op/util/max_pool_base.hpp"
+#include "openvino/op/util/unary_elementwise_arithmetic.hpp"
+
+#include "itt.hpp"
+
+namespace ov {
+namespace intel_cpu {
+
+namespace {
+constexpr size_t heightAxis = 2;
+constexpr size_t maxTiles = 32;
+// Tiling is skipped if the halo rows increase the summary amount of computations more than by this factor
+constexpr double maxRecomputationOverhead = 0.2;
+
+struct ChainOp {
+    std::shared_ptr<ov::Node> node;
+    size_t dataPort = 0;
+    bool spatial = false;
+    // receptive field of the kernel along the height, dilation included
+    int64_t kernel = 1;
+    int64_t padBegin = 0;
+    int64_t padEnd = 0;
+    int64_t inHeight = 0;
+    int64_t outHeight = 0;
+    // number of elements in a single row of the input and output tensors, batch and channels included
+    size_t inRowSize = 0;
+    size_t outRowSize = 0;
+    // relative amount of computations per output row
+    double rowCost = 0.;
+    size_t elemSize = 0;
+};
+
+struct Rows {
+    int64_t begin;
+    int64_t end;
+    int64_t size() const {
+        return end - begin;
+    }
+};
+
+bool isConstantPath(const ov::Output<ov::Node>& output, size_t depth = 0) {
+    const auto node = output.get_node();
+    if (ov::is_type<opset1::Constant>(node))
+        return true;
+    if (depth > 4 || node->get_input_size() == 0)
+        return false;
+    for (const auto& input : node->input_values()) {
+        if (!isConstantPath(input, depth + 1))
+            return false;
+    }
+    return true;
+}
+
+// Elementwise parameters must not vary along the height, otherwise each tile would need its own slice of them
+bool isBroadcastedAlongHeight(const ov::Output<ov::Node>& output) {
+    const auto& pshape = output.get_partial_shape();
+    if (pshape.is_dynamic() || pshape.size() > 4)
+        return false;
+    const auto& shape = pshape.to_shape();
+    return shape.size() < 4 - heightAxis || shape[shape.size() - (4 - heightAxis)] == 1;
+}
+
+bool describeSpatialOp(const std::shared_ptr<ov::Node>& node, ChainOp& op) {
+    int64_t kernel = 0, stride = 0, dilation = 1;
+    std::vector<int64_t> pads;
+    if (ov::is_type<opset1::Convolution>(node) || ov::is_type<opset1::GroupConvolution>(node)) {
+        const auto conv = ov::as_type_ptr<ov::op::util::ConvolutionFwdPropBase>(node);
+        const auto& weightsShape = node->get_input_partial_shape(1);
+        if (weightsShape.is_dynamic() || conv->get_pads_begin().size() != 2 || conv->get_pads_end().size() != 2)
+            return false;
+        const auto& weights = weightsShape.to_shape();
+        kernel = static_cast<int64_t>(weights[weights.size() - 2]);
+        stride = static_cast<int64_t>(conv->get_strides()[0]);
+        dilation = static_cast<int64_t>(conv->get_dilations()[0]);
+        pads = {conv->get_pads_begin()[0], conv->get_pads_end()[0]};
+        // weights are [OC, IC, KH, KW] or [G, OC/G, IC/G, KH, KW], a single output point costs IC/G * KH * KW
+        const size_t outChannelsDims = weights.size() - 3;
+        op.rowCost = static_cast<double>(shape_size(weights)) /
+                     std::accumulate(weights.begin(), weights.begin() + outChannelsDims, size_t(1), std::multiplies<size_t>());
+    } else if (const auto pool = ov::as_type_ptr<ov::op::util::MaxPoolBase>(node)) {
+        // indices of MaxPool-8 refer to the whole input and can't be computed by tiles
+        if (node->get_output_size() > 1 && !node->get_output_target_inputs(1).empty())
+            return false;
+        if (pool->get_pads_begin().size() != 2 || pool->get_pads_end().size() != 2)
+            return false;
+        kernel = static_cast<int64_t>(pool->get_kernel()[0]);
+        stride = static_cast<int64_t>(pool->get_strides()[0]);
+        if (const auto pool8 = ov::as_type_ptr<opset8::MaxPool>(node))
+            dilation = static_cast<int64_t>(pool8->get_dilations()[0]);
+        pads = {static_cast<int64_t>(pool->get_pads_begin()[0]), static_cast<int64_t>(pool->get_pads_end()[0])};
+        op.rowCost = static_cast<double>(shape_size(pool->get_kernel()));
+    } else if (const auto pool = ov::as_type_ptr<opset1::AvgPool>(node)) {
+        if (pool->get_pads_begin().size() != 2 || pool->get_pads_end().size() != 2)
+            return false;
+        kernel = static_cast<int64_t>(pool->get_kernel()[0]);
+        stride = static_cast<int64_t>(pool->get_strides()[0]);
+        pads = {static_cast<int64_t>(pool->get_pads_begin()[0]), static_cast<int64_t>(pool->get_pads_end()[0])};
+        op.rowCost = static_cast<double>(shape_size(pool->get_kernel()));
+    } else {
+        return false;
+    }
+
+    if (stride != 1 || pads[0] < 0 || pads[1] < 0)
+        return false;
+    for (size_t i = 1; i < node->get_input_size(); i++) {
+        if (!isConstantPath(node->input_value(i)))
+            return false;
+    }
+    op.spatial = true;
+    op.kernel = dilation * (kernel - 1) + 1;
+    op.padBegin = pads[0];
+    op.padEnd = pads[1];
+    return true;
+}
+
+bool describePointwiseOp(const std::shared_ptr<ov::Node>& node, size_t dataPort) {
+    if (!ov::is_type<ov::op::util::UnaryElementwiseArithmetic>(node) &&
+        !ov::is_type<ov::op::util::BinaryElementwiseArithmetic>(node) &&
+        !ov::is_type<opset8::Swish>(node) &&
+        !ov::is_type<opset1::PRelu>(node) &&
+        !ov::is_type<opset1::FakeQuantize>(node))
+        return false;
+    if (const auto binary = ov::as_type_ptr<ov::op::util::BinaryElementwiseArithmetic>(node)) {
+        if (binary->get_autob().m_type != ov::op::AutoBroadcastType::NUMPY)
+            return false;
+    }
+    if (node->get_output_partial_shape(0) != node->get_input_partial_shape(dataPort))
+        return false;
+    for (size_t i = 0; i < node->get_input_size(); i++) {
+        if (i != dataPort && (!isConstantPath(node->input_value(i)) || !isBroadcastedAlongHeight(node->input_value(i))))
+            return false;
+    }
+    return true;
+}
+
+bool describeOp(const std::shared_ptr<ov::Node>& node, size_t dataPort, ChainOp& op) {
+    const auto& inShape = node->get_input_partial_shape(dataPort);
+    const auto& outShape = node->get_output_partial_shape(0);
+    if (inShape.is_dynamic() || outShape.is_dynamic() || inShape.size() != 4 || outShape.size() != 4)
+        return false;
+    if (node->get_output_size() > 1 && !ov::is_type<opset8::MaxPool>(node))
+        return false;
+
+    op.node = node;
+    op.dataPort = dataPort;
+    if (dataPort == 0 && describeSpatialOp(node, op)) {
+        op.spatial = true;
+    } else if (!describePointwiseOp(node, dataPort)) {
+        return false;
+    }
+
+    const auto& in = inShape.to_shape();
+    const auto& out = outShape.to_shape();
+    if (in[0] != out[0] || shape_size(in) == 0 || shape_size(out) == 0)
+        return false;
+    op.inHeight = static_cast<int64_t>(in[heightAxis]);
+    op.outHeight = static_cast<int64_t>(out[heightAxis]);
+    op.inRowSize = shape_size(in) / in[heightAxis];
+    op.outRowSize = shape_size(out) / out[heightAxis];
+    op.rowCost = op.outRowSize * std::max(op.rowCost, 1.);
+    op.elemSize = node->get_output_element_type(0).size();
+    return true;
+}
+
+// Computes rows of every chain operation output and input required to produce the given rows of the chain output.
+// Returns false if some operation of the tile would read only the padding.
+bool backpropagateRows(const std::vector<ChainOp>& chain, Rows rows, std::vector<Rows>& outRows, std::vector<Rows>& inRows) {
+    outRows.resize(chain.size());
+    inRows.resize(chain.size());
+    for (size_t j = chain.size(); j-- > 0;) {
+        const auto& op = chain[j];
+        outRows[j] = rows;
+        if (op.spatial) {
+            rows = {std::max<int64_t>(0, rows.begin - op.padBegin),
+                    std::min<int64_t>(op.inHeight, rows.end - op.padBegin + op.kernel - 1)};
+            if (rows.size() <= 0)
+                return false;
+        }
+        inRows[j] = rows;
+    }
+    return true;
+}
+
+std::vector<Rows> splitRows(int64_t height, size_t tiles) {
+    const int64_t rowsPerTile = (height + tiles - 1) / tiles;
+    std::vector<Rows> result;
+    for (int64_t begin = 0; begin < height; begin += rowsPerTile) {
+        result.push_back({begin, std::min(begin + rowsPerTile, height)});
+    }
+    return result;
+}
+
+void setPads(const std::shared_ptr<ov::Node>& node, int64_t padBegin, int64_t padEnd) {
+    if (const auto conv = ov::as_type_ptr<ov::op::util::ConvolutionFwdPropBase>(node)) {
+        auto begin = conv->get_pads_begin();
+        auto end = conv->get_pads_end();
+        begin[0] = padBegin;
+        end[0] = padEnd;
+        conv->set_pads_begin(begin);
+        conv->set_pads_end(end);
+        conv->set_auto_pad(ov::op::PadType::EXPLICIT);
+    } else if (const auto pool = ov::as_type_ptr<ov::op::util::MaxPoolBase>(node)) {
+        auto begin = pool->get_pads_begin();
+        auto end = pool->get_pads_end();
+        begin[0] = static_cast<size_t>(padBegin);
+        end[0] = static_cast<size_t>(padEnd);
+        pool->set_pads_begin(begin);
+        pool->set_pads_end(end);
+        pool->set_auto_pad(ov::op::PadType::EXPLICIT);
+    } else if (const auto pool = ov::as_type_ptr<opset1::AvgPool>(node)) {
+        auto begin = pool->get_pads_begin();
+        auto end = pool->get_pads_end();
+        begin[0] = static_cast<size_t>(padBegin);
+        end[0] = static_cast<size_t>(padEnd);
+        pool->set_pads_begin(begin);
+        pool->set_pads_end(end);
+        pool->set_auto_pad(ov::op::PadType::EXPLICIT);
+    }
+    node->validate_and_infer_types();
+}
+
+bool tileChain(const std::vector<ChainOp>& chain, size_t cacheBudget) {
+    const int64_t height = chain.back().outHeight;
+    std::vector<Rows> outRows, inRows;
+
+    // The largest tile which intermediates fit the cache budget
+    std::vector<Rows> tiles;
+    for (size_t numTiles = 1; numTiles <= maxTiles && static_cast<int64_t>(numTiles) <= height; numTiles++) {
+        const auto candidate = splitRows(height, numTiles);
+        size_t workingSet = 0;
+        bool valid = true;
+        for (const auto& tile : candidate) {
+            if (!backpropagateRows(chain, tile, outRows, inRows)) {
+                valid = false;
+                break;
+            }
+            for (size_t j = 0; j < chain.size(); j++) {
+                const auto& op = chain[j];
+                const size_t tileSize = inRows[j].size() * op.inRowSize + outRows[j].size() * op.outRowSize;
+                workingSet = std::max(workingSet, tileSize * op.elemSize);
+            }
+        }
+        // smaller tiles would read only the padding too
+        if (!valid)
+            break;
+        if (workingSet <= cacheBudget) {
+            tiles = candidate;
+            break;
+        }
+    }
+    // Nothing to gain if the whole chain fits the cache, fallback if the tiles have to be too small
+    if (tiles.size() < 2)
+        return false;
+
+    double originalCost = 0., tiledCost = 0.;
+    for (const auto& op : chain) {
+        originalCost += op.outHeight * op.rowCost;
+    }
+    for (const auto& tile : tiles) {
+        backpropagateRows(chain, tile, outRows, inRows);
+        for (size_t j = 0; j < chain.size(); j++) {
+            tiledCost += outRows[j].size() * chain[j].rowCost;
+        }
+    }
+    if (tiledCost > originalCost * (1. + maxRecomputationOverhead))
+        return false;
+
+    const auto source = chain.front().node->input_value(0);
+    const auto axes = opset1::Constant::create(element::i64, Shape{1}, {heightAxis});
+    const auto step = opset1::Constant::create(element::i64, Shape{1}, {1});
+    ov::NodeVector newOps{axes, step};
+    ov::NodeVector oldOps;
+    for (const auto& op : chain) {
+        oldOps.push_back(op.node);
+    }
+
+    ov::OutputVector tileOutputs;
+    for (size_t t = 0; t < tiles.size(); t++) {
+        backpropagateRows(chain, tiles[t], outRows, inRows);
+        const auto suffix = "/tile_" + std::to_string(t);
+        const auto start = opset1::Constant::create(element::i64, Shape{1}, {inRows[0].begin});
+        const auto stop = opset1::Constant::create(element::i64, Shape{1}, {inRows[0].end});
+        const auto slice = std::make_shared<opset8::Slice>(source, start, stop, step, axes);
+        slice->set_friendly_name(chain.front().node->get_friendly_name() + suffix + "/slice");
+        newOps.insert(newOps.end(), {start, stop, slice});
+
+        ov::Output<ov::Node> data = slice;
+        for (size_t j = 0; j < chain.size(); j++) {
+            const auto& op = chain[j];
+            auto args = op.node->input_values();
+            args[op.dataPort] = data;
+            const auto clone = op.node->clone_with_new_inputs(args);
+            if (op.spatial) {
+                // The tile keeps the original padding only on the borders of the tensor,
+                // inner borders are covered by the halo rows
+                const int64_t padBegin = inRows[j].begin - (outRows[j].begin - op.padBegin);
+                const int64_t padEnd = outRows[j].size() - inRows[j].size() - padBegin + op.kernel - 1;
+                setPads(clone, padBegin, padEnd);
+            }
+            clone->set_friendly_name(op.node->get_friendly_name() + suffix);
+            newOps.push_back(clone);
+            data = clone->output(0);
+        }
+        tileOutputs.push_back(data);
+    }
+
+    const auto concat = std::make_shared<opset1::Concat>(tileOutputs, heightAxis);
+    concat->set_friendly_name(chain.back().node->get_friendly_name());
+    newOps.push_back(concat);
+    ov::copy_runtime_info(oldOps, newOps);
+    chain.back().node->output(0).replace(concat->output(0));
+    return true;
+}
+}   // namespace
+
+bool DepthFirstTiling::run_on_model(const std::shared_ptr<ov::Model>& model) {
+    RUN_ON_MODEL_SCOPE(DepthFirstTiling);
+    bool modified = false;
+    std::unordered_set<ov::Node*> visited;
+    for (const auto& node : model->get_ordered_ops()) {
+        if (visited.count(node.get()))
+            continue;
+
+        // A chain starts from a spatial operation and continues while the operations have a single consumer
+        ChainOp first;
+        if (!describeOp(node, 0, first) || !first.spatial)
+            continue;
+        std::vector<ChainOp> chain{first};
+        size_t numSpatial = 1;
+        while (chain.back().node->get_output_target_inputs(0).size() == 1) {
+            const auto consumer = *chain.back().node->get_output_target_inputs(0).begin();
+            ChainOp op;
+            if (!describeOp(consumer.get_node()->shared_from_this(), consumer.get_index(), op))
+                break;
+            numSpatial += op.spatial ? 1 : 0;
+            chain.push_back(op);
+        }
+        for (const auto& op : chain) {
+            visited.insert(op.node.get());
+        }
+
+        // Intermediates of a single spatial operation are consumed by its fused post operations
+        if (numSpatial < 2)
+            continue;
+        modified |= tileChain(chain, cacheBudget);
+    }
+    return modified;
+}
+
+}   // namespace intel_cpu
+}   // namespace ov
@@ -0,0 +1,32 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include "openvino/pass/graph_rewrite.hpp"
+
+namespace ov {
+namespace intel_cpu {
+
+/**
+ * @interface DepthFirstTiling
+ * @brief Splits chains of spatial operations (Convolution, GroupConvolution, MaxPool, AvgPool with unit stride along
+ * the height and elementwise operations between them) into horizontal stripes, which are computed one after another.
+ * Each stripe reads its input rows together with the halo required by the kernels of the chain, so the stripes are
+ * independent and their intermediate tensors are small enough to stay in cache. The stripes are concatenated back.
+ * The stripe height is selected to fit the intermediates of the stripe into the cache budget, chains which fit
+ * the budget without tiling or would spend too much time on the halo recomputation are left untouched.
+ */
+class DepthFirstTiling : public ov::pass::ModelPass {
+public:
+    OPENVINO_RTTI("DepthFirstTiling", "0");
+    explicit DepthFirstTiling(size_t cacheBudget) : ModelPass(), cacheBudget(cacheBudget) {}
+    bool run_on_model(const std::shared_ptr<ov::Model>& model) override;
+
+private:
+    size_t cacheBudget;
+};
+
+}   // namespace intel_cpu
+}   // namespace ov
@@ -0,0 +1,276 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "fc_horizontal_fusion.hpp"
+
+#include <algorithm>
+#include <cstring>
+#include <unordered_map>
+
+#include "transformations/cpu_opset/common/op/fully_connected.hpp"
+#include "openvino/core/rt_info.hpp"
+#include "openvino/opsets/opset1.hpp"
+#include "transformations/utils/utils.hpp"
+
+#include "itt.hpp"
+
+namespace ov {
+namespace intel_cpu {
+
+namespace {
+struct Branch {
+    std::shared_ptr<FullyConnectedNode> fc;
+    size_t outChannels = 0;
+    // per-channel operations following the FullyConnected, common for all the branches
+    std::vector<std::shared_ptr<ov::Node>> tail;
+    std::vector<int> tailDataPorts;
+
+    ov::Output<ov::Node> end() const {
+        return tail.empty() ? fc->output(0) : tail.back()->output(0);
+    }
+};
+
+bool isSuitableFullyConnected(const std::shared_ptr<FullyConnectedNode>& fc) {
+    for (size_t i = 1; i < fc->get_input_size(); i++) {
+        if (!ov::is_type<opset1::Constant>(fc->get_input_node_ptr(i)))
+            return false;
+    }
+    const auto& outShape = fc->get_output_partial_shape(0);
+    return fc->get_input_shape(1).size() == 2 && outShape.rank().is_static() && outShape.rank().get_length() > 0 &&
+           outShape[outShape.rank().get_length() - 1].is_static();
+}
+
+bool canBeMerged(const std::shared_ptr<FullyConnectedNode>& a, const std::shared_ptr<FullyConnectedNode>& b) {
+    if (a->get_input_size() != b->get_input_size() || a->get_output_type() != b->get_output_type() ||
+        a->get_output_rank() != b->get_output_rank() || a->get_output_element_type(0) != b->get_output_element_type(0))
+        return false;
+    for (size_t i = 1; i < a->get_input_size(); i++) {
+        if (a->get_input_element_type(i) != b->get_input_element_type(i))
+            return false;
+    }
+    return a->get_input_shape(1)[1] == b->get_input_shape(1)[1];
+}
+
+// A constant which is broadcasted only along the output channels of FullyConnected: [1, ..., 1, OC] or [1, ..., 1]
+bool isPerChannelConstant(const ov::Output<ov::Node>& value, size_t outChannels, size_t rank) {
+    if (!ov::is_type<opset1::Constant>(value.get_node()))
+        return false;
+    const auto& shape = value.get_shape();
+    if (shape.size() > rank)
+        return false;
+    if (shape.empty())
+        return true;
+    if (!std::all_of(shape.begin(), shape.end() - 1, [](size_t dim) { return dim == 1; }))
+        return false;
+    return shape.back() == 1 || shape.back() == outChannels;
+}
+
+// Returns the port of the operation, which takes the output of the branch, or -1 if the operation can't be merged
+int getTailDataPort(const std::shared_ptr<ov::Node>& op, const ov::Output<ov::Node>& data, size_t outChannels) {
+    const auto rank = static_cast<size_t>(data.get_partial_shape().rank().get_length());
+    if (ov::is_type<opset1::Multiply>(op) || ov::is_type<opset1::Add>(op)) {
+        if (op->get_autob() != ov::op::AutoBroadcastType::NUMPY)
+            return -1;
+        const int dataPort = op->input_value(0) == data ? 0 : 1;
+        return isPerChannelConstant(op->input_value(1 - dataPort), outChannels, rank) ? dataPort : -1;
+    }
+    if (const auto fq = ov::as_type_ptr<opset1::FakeQuantize>(op)) {
+        if (fq->get_auto_broadcast() != ov::op::AutoBroadcastType::NUMPY || fq->input_value(0) != data)
+            return -1;
+        for (size_t i = 1; i < fq->get_input_size(); i++) {
+            if (!isPerChannelConstant(fq->input_value(i), outChannels, rank))
+                return -1;
+        }
+        return 0;
+    }
+    return -1;
+}
+
+bool isSameTailOp(const std::shared_ptr<ov::Node>& a, const std::shared_ptr<ov::Node>& b) {
+    if (a->get_type_info() != b->get_type_info() || a->get_output_element_type(0) != b->get_output_element_type(0))
+        return false;
+    for (size_t i = 0; i < a->get_input_size(); i++) {
+        if (a->get_input_element_type(i) != b->get_input_element_type(i))
+            return false;
+    }
+    const auto fqA = ov::as_type_ptr<opset1::FakeQuantize>(a);
+    const auto fqB = ov::as_type_ptr<opset1::FakeQuantize>(b);
+    return !fqA || fqA->get_levels() == fqB->get_levels();
+}
+
+// Extends the tails of the branches while all of them are followed by the same per-channel operation
+void collectTails(std::vector<Branch>& branches) {
+    for (auto& branch : branches) {
+        branch.tail.clear();
+        branch.tailDataPorts.clear();
+    }
+    while (true) {
+        std::vector<std::shared_ptr<ov::Node>> next;
+        std::vector<int> ports;
+        for (const auto& branch : branches) {
+            const auto end = branch.end();
+            const auto consumers = end.get_target_inputs();
+            if (consumers.size() != 1)
+                return;
+            const auto op = consumers.begin()->get_node()->shared_from_this();
+            const int port = getTailDataPort(op, end, branch.outChannels);
+            if (port < 0 || (!next.empty() && !isSameTailOp(next.front(), op)))
+                return;
+            next.push_back(op);
+            ports.push_back(port);
+        }
+        for (size_t i = 0; i < branches.size(); i++) {
+            branches[i].tail.push_back(next[i]);
+            branches[i].tailDataPorts.push_back(ports[i]);
+        }
+    }
+}
+
+ov::Output<ov::Node> mergeConstants(const ov::OutputVector& constants, const std::vector<size_t>& outChannels) {
+    // The same per-tensor value for all the branches is kept per-tensor
+    const auto first = ov::as_type_ptr<opset1::Constant>(constants.front().get_node_shared_ptr());
+    const bool sameScalars = std::all_of(constants.begin(), constants.end(), [&](const ov::Output<ov::Node>& value) {
+        const auto constant = ov::as_type_ptr<opset1::Constant>(value.get_node_shared_ptr());
+        return ov::shape_size(constant->get_shape()) == 1 && ov::shape_size(first->get_shape()) == 1 &&
+               constant->get_shape() == first->get_shape() &&
+               std::memcmp(constant->get_data_ptr(), first->get_data_ptr(), constant->get_byte_size()) == 0;
+    });
+    if (sameScalars)
+        return constants.front();
+
+    size_t rank = 1;
+    for (const auto& constant : constants) {
+        rank = std::max(rank, constant.get_shape().size());
+    }
+    ov::OutputVector parts;
+    for (size_t i = 0; i < constants.size(); i++) {
+        ov::Shape targetShape(rank, 1);
+        targetShape.back() = outChannels[i];
+        const auto target = opset1::Constant::create(ov::element::i64, ov::Shape{rank}, targetShape);
+        parts.push_back(ov::op::util::make_try_fold<opset1::Broadcast>(constants[i], target));
+    }
+    return ov::op::util::make_try_fold<opset1::Concat>(parts, static_cast<int64_t>(rank - 1));
+}
+
+bool feedsResult(const Branch& branch) {
+    for (const auto& input : branch.end().get_target_inputs()) {
+        if (ov::is_type<opset1::Result>(input.get_node()))
+            return true;
+    }
+    return false;
+}
+
+bool fuseBranches(std::vector<Branch> branches) {
+    // Legacy output names are taken from the producers, so the outputs of the model are kept as is
+    while (true) {
+        collectTails(branches);
+        const auto it = std::remove_if(branches.begin(), branches.end(), feedsResult);
+        if (it == branches.end())
+            break;
+        branches.erase(it, branches.end());
+        if (branches.size() < 2)
+            return false;
+    }
+
+    const auto& proto = branches.front().fc;
+    std::vector<size_t> outChannels;
+    ov::NodeVector oldOps;
+    for (const auto& branch : branches) {
+        outChannels.push_back(branch.outChannels);
+        oldOps.push_back(branch.fc);
+        oldOps.insert(oldOps.end(), branch.tail.begin(), branch.tail.end());
+    }
+
+    ov::OutputVector args{proto->input_value(0)};
+    for (size_t i = 1; i < proto->get_input_size(); i++) {
+        ov::OutputVector parts;
+        for (const auto& branch : branches) {
+            parts.push_back(branch.fc->input_value(i));
+        }
+        args.push_back(ov::op::util::make_try_fold<opset1::Concat>(parts, 0));
+    }
+    const auto fc = proto->clone_with_new_inputs(args);
+    fc->set_friendly_name(proto->get_friendly_name() + "/horizontal_fusion");
+    ov::NodeVector newOps{fc};
+
+    ov::Output<ov::Node> data = fc;
+    for (size_t k = 0; k < branches.front().tail.size(); k++) {
+        const auto& tailProto = branches.front().tail[k];
+        ov::OutputVector tailArgs{data};
+        for (size_t port = 1; port < tailProto->get_input_size(); port++) {
+            ov::OutputVector constants;
+            for (const auto& branch : branches) {
+                const auto& op = branch.tail[k];
+                // Multiply and Add are commutative, the data is always moved to the first input
+                const size_t constPort = op->get_input_size() == 2 ? 1 - branch.tailDataPorts[k] : port;
+                constants.push_back(op->input_value(constPort));
+            }
+            tailArgs.push_back(mergeConstants(constants, outChannels));
+        }
+        const auto tailOp = tailProto->clone_with_new_inputs(tailArgs);
+        tailOp->set_friendly_name(tailProto->get_friendly_name() + "/horizontal_fusion");
+        newOps.push_back(tailOp);
+        data = tailOp;
+    }
+
+    const auto axis = static_cast<int64_t>(data.get_partial_shape().rank().get_length() - 1);
+    const auto split = std::make_shared<opset1::VariadicSplit>(
+        data,
+        opset1::Constant::create(ov::element::i64, ov::Shape{}, {axis}),
+        opset1::Constant::create(ov::element::i64, ov::Shape{outChannels.size()}, outChannels));
+    split->set_friendly_name(proto->get_friendly_name() + "/split");
+    newOps.push_back(split);
+
+    ov::copy_runtime_info(oldOps, newOps);
+    for (size_t i = 0; i < branches.size(); i++) {
+        branches[i].end().replace(split->output(i));
+    }
+    return true;
+}
+}   // namespace
+
+bool FullyConnectedHorizontalFusion::run_on_model(const std::shared_ptr<ov::Model>& model) {
+    RUN_ON_MODEL_SCOPE(FullyConnectedHorizontalFusion);
+    bool modified = false;
+    const auto orderedOps = model->get_ordered_ops();
+    // branches are merged in the topological order to keep the compiled model deterministic
+    std::unordered_map<const ov::Node*, size_t> topologicalIndex;
+    for (size_t i = 0; i < orderedOps.size(); i++) {
+        topologicalIndex[orderedOps[i].get()] = i;
+    }
+    for (const auto& node : orderedOps) {
+        for (const auto& output : node->outputs()) {
+            std::vector<std::vector<Branch>> groups;
+            for (const auto& input : output.get_target_inputs()) {
+                const auto fc = ov::as_type_ptr<FullyConnectedNode>(input.get_node()->shared_from_this());
+                if (!fc || input.get_index() != 0 || !isSuitableFullyConnected(fc) || transformation_callback(fc))
+                    continue;
+
+                Branch branch;
+                branch.fc = fc;
+                branch.outChannels = fc->get_input_shape(1)[0];
+                auto group = std::find_if(groups.begin(), groups.end(), [&](const std::vector<Branch>& candidates) {
+                    return canBeMerged(candidates.front().fc, fc);
+                });
+                if (group == groups.end())
+                    groups.push_back({branch});
+                else
+                    group->push_back(branch);
+            }
+
+            for (auto& group : groups) {
+                if (group.size() < 2)
+                    continue;
+                std::sort(group.begin(), group.end(), [&](const Branch& a, const Branch& b) {
+                    return topologicalIndex.at(a.fc.get()) < topologicalIndex.at(b.fc.get());
+                });
+                modified |= fuseBranches(group);
+            }
+        }
+    }
+    return modified;
+}
+
+}   // namespace intel_cpu
+}   // namespace ov
@@ -0,0 +1,35 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include "openvino/pass/graph_rewrite.hpp"
+
+namespace ov {
+namespace intel_cpu {
+
+/**
+ * @interface FullyConnectedHorizontalFusion
+ * @brief Merges FullyConnected nodes which read the same activations (e.g. Q, K and V projections of attention or
+ * gate and up projections of MLP) into a single FullyConnected with concatenated weights and biases, which output
+ * is split back with VariadicSplit. Per-channel Multiply, Add and FakeQuantize operations which follow all
+ * the branches in the same order are merged as well, so they are still fused into the FullyConnected:
+ *
+ *        Input                            Input
+ *      /   |   \                            |
+ *   FC1   FC2   FC3                  FC(W1|W2|W3, B1|B2|B3)
+ *    |     |     |          =>                |
+ *  Mul1  Mul2  Mul3                    Mul(S1|S2|S3)
+ *    |     |     |                            |
+ *                                       VariadicSplit
+ *                                       /     |     \
+ */
+class FullyConnectedHorizontalFusion : public ov::pass::ModelPass {
+public:
+    OPENVINO_RTTI("FullyConnectedHorizontalFusion", "0");
+    bool run_on_model(const std::shared_ptr<ov::Model>& model) override;
+};
+
+}   // namespace intel_cpu
+}   // namespace ov
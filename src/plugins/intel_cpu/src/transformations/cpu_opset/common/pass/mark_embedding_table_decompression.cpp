@@ -0,0 +1,66 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "mark_embedding_table_decompression.hpp"
+
+#include <openvino/opsets/opset3.hpp>
+#include <openvino/pass/pattern/op/wrap_type.hpp>
+#include <transformations/rt_info/dequantization_node.hpp>
+#include <transformations/rt_info/disable_constant_folding.hpp>
+
+#include "itt.hpp"
+
+namespace {
+// [N, 1, ..., 1] constant for the table with N rows, the per-tensor constants are converted to PowerStatic
+bool isPerRowConstant(const ov::Output<ov::Node>& value, const ov::Shape& tableShape) {
+    if (!ov::is_type<ov::opset3::Constant>(value.get_node()))
+        return false;
+    const auto& shape = value.get_shape();
+    return tableShape[0] > 1 && shape.size() == tableShape.size() && shape[0] == tableShape[0] &&
+           ov::shape_size(shape) == tableShape[0];
+}
+}   // namespace
+
+ov::intel_cpu::MarkEmbeddingTableDecompression::MarkEmbeddingTableDecompression() {
+    MATCHER_SCOPE(MarkEmbeddingTableDecompression);
+    auto embeddingBag = ov::pass::pattern::wrap_type<ov::opset3::EmbeddingBagOffsetsSum,
+                                                     ov::opset3::EmbeddingBagPackedSum,
+                                                     ov::opset3::EmbeddingSegmentsSum>();
+
+    ov::matcher_pass_callback callback = [=](ov::pass::pattern::Matcher& m) {
+        const auto node = m.get_match_root();
+        const auto multiplyNode = node->get_input_node_shared_ptr(0);
+        if (!ov::is_type<ov::opset3::Multiply>(multiplyNode) || multiplyNode->get_output_target_inputs(0).size() != 1)
+            return false;
+        auto convertNode = multiplyNode->get_input_node_shared_ptr(0);
+        const auto subtractNode = ov::as_type_ptr<ov::opset3::Subtract>(convertNode);
+        if (subtractNode) {
+            if (subtractNode->get_output_target_inputs(0).size() != 1)
+                return false;
+            convertNode = subtractNode->get_input_node_shared_ptr(0);
+        }
+        if (!ov::is_type<ov::opset3::Convert>(convertNode) || convertNode->get_output_target_inputs(0).size() != 1 ||
+            !ov::is_type<ov::opset3::Constant>(convertNode->get_input_node_ptr(0)) ||
+            convertNode->get_output_element_type(0) != ov::element::f32)
+            return false;
+        // U4 tables are unpacked to U8 by the precision conversion
+        const auto tablePrecision = convertNode->get_input_element_type(0);
+        if (tablePrecision != ov::element::u8 && tablePrecision != ov::element::i8 && tablePrecision != ov::element::u4)
+            return false;
+
+        const auto& tableShape = convertNode->get_input_shape(0);
+        if (!isPerRowConstant(multiplyNode->input_value(1), tableShape) ||
+            (subtractNode && !isPerRowConstant(subtractNode->input_value(1), tableShape)))
+            return false;
+
+        ov::disable_constant_folding(convertNode);
+        // keeps Subtract from the decomposition, as for the other dequantization subgraphs
+        if (subtractNode)
+            ov::mark_as_dequantization_node(subtractNode);
+        return false;
+    };
+
+    auto m = std::make_shared<ov::pass::pattern::Matcher>(embeddingBag, matcher_name);
+    this->register_matcher(m, callback);
+}
@@ -0,0 +1,33 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <ngraph/pass/graph_rewrite.hpp>
+
+namespace ov {
+namespace intel_cpu {
+
+/**
+ * Disables constant folding of the dequantization of U8 / I8 embedding tables, so the tables are kept
+ * in the low precision and the rows are dequantized by the EmbeddingBag kernel:
+ *
+ *    Constant[U8/I8]
+ *        |
+ *     Convert   Constant (per-row zero point)
+ *         \     /
+ *        [Subtract]   Constant (per-row scale)
+ *              \     /
+ *              Multiply
+ *                 |
+ *            EmbeddingBag
+ */
+class MarkEmbeddingTableDecompression: public ngraph::pass::MatcherPass {
+public:
+    OPENVINO_RTTI("MarkEmbeddingTableDecompression", "0");
+    MarkEmbeddingTableDecompression();
+};
+
+}   // namespace intel_cpu
+}   // namespace ov
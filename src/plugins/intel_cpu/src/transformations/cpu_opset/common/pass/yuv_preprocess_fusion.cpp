@@ -0,0 +1,149 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "yuv_preprocess_fusion.hpp"
+#include "transformations/cpu_opset/common/op/yuv_preprocess.hpp"
+#include <openvino/opsets/opset1.hpp>
+#include <openvino/opsets/opset8.hpp>
+#include <openvino/op/util/interpolate_base.hpp>
+#include <openvino/core/rt_info.hpp>
+#include <openvino/pass/pattern/op/wrap_type.hpp>
+
+#include <algorithm>
+
+#include "transformations/itt.hpp"
+#include "utils/general_utils.h"
+
+using namespace ov::pass::pattern;
+using InterpolateBase = ov::op::util::InterpolateBase;
+
+namespace {
+// the only consumer of the node, which takes it as the first input, or nullptr
+std::shared_ptr<ov::Node> getSingleConsumer(const std::shared_ptr<ov::Node>& node) {
+    const auto& consumers = node->get_output_target_inputs(0);
+    if (consumers.size() != 1 || consumers.begin()->get_index() != 0)
+        return nullptr;
+    return consumers.begin()->get_node()->shared_from_this();
+}
+
+// per channel values of the NHWC image, the scalar is broadcasted to all the channels
+bool getChannelValues(const ov::Output<ov::Node>& output, std::vector<float>& values) {
+    const auto constant = ov::as_type_ptr<ov::opset1::Constant>(output.get_node_shared_ptr());
+    if (!constant || constant->get_element_type() != ov::element::f32)
+        return false;
+    const auto& shape = constant->get_shape();
+    const auto size = ov::shape_size(shape);
+    if (shape.size() > 4 || (size != 1 && size != 3) || (size == 3 && shape.back() != 3))
+        return false;
+    values = constant->cast_vector<float>();
+    values.resize(3, values[0]);
+    return true;
+}
+
+bool isSupportedInterpolate(const std::shared_ptr<InterpolateBase>& interpolate) {
+    const auto& attrs = interpolate->get_attrs();
+    const bool isSupportedMode =
+        ov::intel_cpu::one_of(attrs.mode, InterpolateBase::InterpolateMode::LINEAR, InterpolateBase::InterpolateMode::LINEAR_ONNX) ||
+        (attrs.mode == InterpolateBase::InterpolateMode::NEAREST &&
+         attrs.nearest_mode == InterpolateBase::NearestMode::ROUND_PREFER_FLOOR);
+    auto isZero = [](size_t pad) {
+        return pad == 0;
+    };
+    return isSupportedMode &&
+           attrs.shape_calculation_mode == InterpolateBase::ShapeCalcMode::SIZES &&
+           attrs.coordinate_transformation_mode == InterpolateBase::CoordinateTransformMode::HALF_PIXEL &&
+           !attrs.antialias &&
+           std::all_of(attrs.pads_begin.begin(), attrs.pads_begin.end(), isZero) &&
+           std::all_of(attrs.pads_end.begin(), attrs.pads_end.end(), isZero);
+}
+}   // namespace
+
+ov::intel_cpu::YUVPreprocessFusion::YUVPreprocessFusion() {
+    MATCHER_SCOPE(YUVPreprocessFusion);
+    auto color_convert_m = wrap_type<ov::opset8::NV12toRGB, ov::opset8::NV12toBGR,
+                                     ov::opset8::I420toRGB, ov::opset8::I420toBGR>(rank_equals(4));
+
+    ov::matcher_pass_callback callback = [=](Matcher& m) {
+        const auto colorConvert = m.get_match_root();
+        YUVPreprocessNode::Attributes attrs;
+        attrs.i420 = ov::is_type<ov::opset8::I420toRGB>(colorConvert) || ov::is_type<ov::opset8::I420toBGR>(colorConvert);
+        attrs.bgr = ov::is_type<ov::opset8::NV12toBGR>(colorConvert) || ov::is_type<ov::opset8::I420toBGR>(colorConvert);
+
+        ov::NodeVector fusedNodes{colorConvert};
+        // the resize and the normalization must be computed in f32
+        bool isFloat = colorConvert->get_output_element_type(0) == ov::element::f32;
+        auto node = getSingleConsumer(colorConvert);
+
+        if (node && ov::is_type<ov::opset1::Convert>(node)) {
+            if (node->get_output_element_type(0) != ov::element::f32)
+                return false;
+            isFloat = true;
+            fusedNodes.push_back(node);
+            node = getSingleConsumer(node);
+        }
+        if (!isFloat)
+            return false;
+
+        if (const auto interpolate = ov::as_type_ptr<InterpolateBase>(node)) {
+            if (!isSupportedInterpolate(interpolate))
+                return false;
+            const size_t axesPort = ov::is_type<ov::op::v4::Interpolate>(interpolate) ? 3 : 2;
+            if (interpolate->get_input_size() <= axesPort)
+                return false;
+            const auto sizes = ov::as_type_ptr<ov::opset1::Constant>(interpolate->get_input_node_shared_ptr(1));
+            const auto axes = ov::as_type_ptr<ov::opset1::Constant>(interpolate->get_input_node_shared_ptr(axesPort));
+            if (!sizes || !axes || axes->cast_vector<int64_t>() != std::vector<int64_t>{1, 2})
+                return false;
+            const auto sizesValues = sizes->cast_vector<int64_t>();
+            if (sizesValues.size() != 2 || sizesValues[0] <= 0 || sizesValues[1] <= 0)
+                return false;
+            attrs.nearest = interpolate->get_attrs().mode == InterpolateBase::InterpolateMode::NEAREST;
+            attrs.out_height = static_cast<size_t>(sizesValues[0]);
+            attrs.out_width = static_cast<size_t>(sizesValues[1]);
+            fusedNodes.push_back(node);
+            node = getSingleConsumer(node);
+        }
+
+        if (node && ov::is_type<ov::opset1::Subtract>(node)) {
+            if (!getChannelValues(node->input_value(1), attrs.mean))
+                return false;
+            fusedNodes.push_back(node);
+            node = getSingleConsumer(node);
+        }
+
+        if (node && ov::is_type<ov::opset1::Multiply>(node)) {
+            if (!getChannelValues(node->input_value(1), attrs.scale))
+                return false;
+            fusedNodes.push_back(node);
+            node = getSingleConsumer(node);
+        } else if (node && ov::is_type<ov::opset1::Divide>(node)) {
+            std::vector<float> divisors;
+            if (!getChannelValues(node->input_value(1), divisors) ||
+                std::any_of(divisors.begin(), divisors.end(), [](float val) { return val == 0.f; }))
+                return false;
+            for (size_t c = 0; c < attrs.scale.size(); c++)
+                attrs.scale[c] = 1.f / divisors[c];
+            fusedNodes.push_back(node);
+            node = getSingleConsumer(node);
+        }
+
+        // the planar output is the reason of the fusion, the interleaved one is produced by ColorConvert itself
+        const auto transpose = ov::as_type_ptr<ov::opset1::Transpose>(node);
+        if (!transpose)
+            return false;
+        const auto order = ov::as_type_ptr<ov::opset1::Constant>(transpose->get_input_node_shared_ptr(1));
+        if (!order || order->cast_vector<int64_t>() != std::vector<int64_t>{0, 3, 1, 2})
+            return false;
+        fusedNodes.push_back(transpose);
+
+        const auto preprocess = std::make_shared<YUVPreprocessNode>(colorConvert->input_values(), attrs);
+        preprocess->set_friendly_name(transpose->get_friendly_name());
+        ov::copy_runtime_info(fusedNodes, preprocess);
+        ov::replace_node(transpose, preprocess);
+        return true;
+    };
+
+    auto m = std::make_shared<Matcher>(color_convert_m, matcher_name);
+    this->register_matcher(m, callback);
+}
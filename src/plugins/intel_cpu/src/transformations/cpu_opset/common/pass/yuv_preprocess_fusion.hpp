@@ -0,0 +1,38 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <openvino/pass/graph_rewrite.hpp>
+
+namespace ov {
+namespace intel_cpu {
+
+/*
+ * Description:
+ *     Fuses the preprocessing of NV12 / I420 images into the single YUVPreprocess operation,
+ *     so the image is converted, resized and normalized without the full size intermediate tensors.
+ *
+ *        NV12toRGB / NV12toBGR / I420toRGB / I420toBGR
+ *                           |
+ *                     [Convert to f32]
+ *                           |
+ *           [Interpolate over H, W: linear / nearest]
+ *                           |
+ *                [Subtract per channel mean]
+ *                           |
+ *            [Multiply / Divide by per channel scale]
+ *                           |
+ *                 Transpose NHWC -> NCHW
+ *
+ *     The pass must be applied before the common optimizations, which move the Transpose and the Interpolate.
+ */
+class YUVPreprocessFusion: public ov::pass::MatcherPass {
+public:
+    OPENVINO_RTTI("YUVPreprocessFusion", "0");
+    YUVPreprocessFusion();
+};
+
+}   // namespace intel_cpu
+}   // namespace ov
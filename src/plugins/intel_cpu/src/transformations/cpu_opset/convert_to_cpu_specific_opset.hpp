@@ -4,6 +4,7 @@
 
 #include <ngraph/pass/constant_folding.hpp>
 #include "common/pass/fc_bias_fusion.hpp"
+#include "common/pass/fc_horizontal_fusion.hpp"
 #include "ngraph/op/fake_quantize.hpp"
 #include "ngraph/pass/manager.hpp"
 #include "common/pass/reshape_fc_fusion.hpp"
@@ -36,6 +37,7 @@ inline void ConvertToCPUSpecificOpset(std::shared_ptr<ngraph::Function> &nGraphF
     CPU_REGISTER_PASS_COMMON(manager, AlignMatMulInputRanks);
     CPU_REGISTER_PASS_COMMON(manager, ConvertTileToSeqTiles);
     CPU_REGISTER_PASS_COMMON(manager, FullyConnectedBiasFusion);
+    CPU_REGISTER_PASS_COMMON(manager, FullyConnectedHorizontalFusion);
     CPU_REGISTER_PASS_X64(manager, ConvertToPowerStatic);
     CPU_REGISTER_PASS_COMMON(manager, ConvertToLeakyRelu);
     CPU_REGISTER_PASS_COMMON(manager, ConvertToSwishCPU);
@@ -105,6 +105,9 @@
 #include "transformations/cpu_opset/common/pass/move_eltwise_up_data_movement.hpp"
 #include "transformations/cpu_opset/common/pass/ref_convert_i64_i32.hpp"
 #include "transformations/cpu_opset/common/pass/swap_convert_transpose.hpp"
+#include "transformations/cpu_opset/common/pass/depth_first_tiling.hpp"
+#include "transformations/cpu_opset/common/pass/mark_embedding_table_decompression.hpp"
+#include "transformations/cpu_opset/common/pass/yuv_preprocess_fusion.hpp"
 
 // Snippets
 #include "snippets/pass/tokenization.hpp"
@@ -199,11 +202,17 @@ void Transformations::PreLpt(const std::vector<ov::element::Type>& defaultPrecis
     ov::pass::Manager manager;
     manager.set_per_pass_validation(false);
     CPU_REGISTER_PASS_COMMON(manager, ov::pass::InitNodeInfo);
+    // the camera frame preprocessing must be matched before the common optimizations move the Transpose
+    CPU_REGISTER_PASS_COMMON(manager, YUVPreprocessFusion);
 
     const bool useLpt = !defaultPrecisions.empty();
     if (useLpt) {
         CPU_REGISTER_PASS_COMMON(manager, ov::pass::MarkDequantizationSubgraph, defaultPrecisions);
     }
+    // U8 / I8 embedding tables are dequantized by the EmbeddingBag JIT kernel
+    if (dnnl::impl::cpu::x64::mayiuse(dnnl::impl::cpu::x64::avx2)) {
+        CPU_REGISTER_PASS_X64(manager, MarkEmbeddingTableDecompression);
+    }
 
     auto get_convert_precisions = []() {
         precisions_map map = {
@@ -610,6 +619,14 @@ void Transformations::PostLpt() {
 
     // Execute before snippets. Otherwise FQ will be converted to Subgraph
     CPU_REGISTER_PASS_COMMON(postLPTPassManager, ConvertFqRnnToQuantizedRnn);
+
+    if (config.depthFirstTiling) {
+        // Convolutions are executed by all threads, so intermediates of a stripe are spread over L2 caches of the cores.
+        // Half of the cache is left for weights and kernel scratchpads.
+        const auto cacheBudget = config.depthFirstTilingCacheBudget ? config.depthFirstTilingCacheBudget
+                                                                    : dnnl::utils::get_cache_size(2, true) * parallel_get_max_threads() / 2;
+        CPU_REGISTER_PASS_COMMON(postLPTPassManager, DepthFirstTiling, cacheBudget);
+    }
     postLPTPassManager.run_passes(model);
 }
 
@@ -117,9 +117,11 @@ public:
 
     struct : PropertyGroup {
         TransformationFilter transformations;
+        bool layoutPlanning = false;
 
         std::vector<PropertySetterPtr> getPropertySetters(void) override {
-            return { transformations.getPropertySetter() };
+            return { transformations.getPropertySetter(),
+                     PropertySetterPtr(new BoolPropertySetter("layout_planning", layoutPlanning, "graph-wide layout planning")) };
         }
     } disable;
 
@@ -160,6 +162,29 @@ private:
         std::string& property;
         const std::string propertyValueDescription;
     };
+    struct BoolPropertySetter : PropertySetter {
+        BoolPropertySetter(const std::string&& name, bool& ref, const std::string&& valueDescription)
+            : PropertySetter(std::move(name)), property(ref), propertyValueDescription(valueDescription) {}
+        bool parseAndSet(const std::string& str) override {
+            const auto& value = ov::util::to_lower(str);
+            if (value.empty() || value == "1" || value == "yes" || value == "true") {
+                property = true;
+            } else if (value == "0" || value == "no" || value == "false") {
+                property = false;
+            } else {
+                return false;
+            }
+            return true;
+        }
+        std::string getPropertyValueDescription(void) const override {
+            return propertyValueDescription + ": yes/true/1 (default if no value), no/false/0";
+        }
+
+    private:
+        bool& property;
+        const std::string propertyValueDescription;
+    };
+
     template<std::size_t NumOfBits>
 
     struct BitsetFilterPropertySetter : PropertySetter {
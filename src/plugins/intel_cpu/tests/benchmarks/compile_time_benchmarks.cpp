@@ -0,0 +1,179 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+/**
+ * Compile time benchmarks of the CPU plugin.
+ *
+ * Each model of the zoo is compiled on a single stream with the growing number of threads, once with the primitives
+ * created node by node and once with the primitives created in parallel (ov::intel_cpu::parallel_compilation).
+ * The compiled model is destroyed before the next compilation, so the JIT kernels are generated every time.
+ *
+ * Usage: ov_cpu_compile_benchmarks --models=<file.xml|dir>[,...] [--threads=<n>[,...]] [--repeats=<n>] [--json=<file>]
+ */
+
+#include <algorithm>
+#include <chrono>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "openvino/openvino.hpp"
+#include "openvino/runtime/intel_cpu/properties.hpp"
+#include "openvino/util/common_util.hpp"
+#include "openvino/util/file_util.hpp"
+
+namespace {
+
+struct BenchmarkResult {
+    std::string model;
+    size_t nodes = 0;
+    int threads = 0;
+    double serialMs = 0.0;
+    double parallelMs = 0.0;
+};
+
+// the IR files of the listed files and directories, the directories are searched recursively
+std::vector<std::string> collectModels(const std::string& paths) {
+    std::vector<std::string> models;
+    for (const auto& path : ov::util::split(paths, ',', true)) {
+        if (ov::util::ends_with(path, ".xml")) {
+            models.push_back(path);
+            continue;
+        }
+        ov::util::iterate_files(
+            path,
+            [&models](const std::string& file, bool isDir) {
+                if (!isDir && ov::util::ends_with(file, ".xml"))
+                    models.push_back(file);
+            },
+            true);
+    }
+    std::sort(models.begin(), models.end());
+    return models;
+}
+
+// 1, 2, 4, ... up to the number of the logical cores, the last one is always included
+std::vector<int> defaultThreads() {
+    const int cores = std::max(1, static_cast<int>(std::thread::hardware_concurrency()));
+    std::vector<int> threads;
+    for (int n = 1; n < cores; n *= 2)
+        threads.push_back(n);
+    threads.push_back(cores);
+    return threads;
+}
+
+// the median compilation time in milliseconds
+double measureCompileTime(ov::Core& core,
+                          const std::shared_ptr<ov::Model>& model,
+                          int threads,
+                          bool parallelCompilation,
+                          int repeats) {
+    std::vector<double> times;
+    for (int i = 0; i < repeats; i++) {
+        const auto start = std::chrono::steady_clock::now();
+        {
+            auto compiledModel = core.compile_model(model,
+                                                    "CPU",
+                                                    ov::num_streams(1),
+                                                    ov::inference_num_threads(threads),
+                                                    ov::intel_cpu::parallel_compilation(parallelCompilation));
+        }
+        times.push_back(std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count());
+    }
+    std::sort(times.begin(), times.end());
+    return times[times.size() / 2];
+}
+
+void writeJson(const std::vector<BenchmarkResult>& results, std::ostream& os) {
+    os << "{\n  \"benchmarks\": [";
+    for (size_t i = 0; i < results.size(); i++) {
+        const auto& r = results[i];
+        os << (i ? ",\n" : "\n") << "    {\"model\": \"" << r.model << "\", \"nodes\": " << r.nodes
+           << ", \"threads\": " << r.threads << ", \"serial_ms\": " << r.serialMs
+           << ", \"parallel_ms\": " << r.parallelMs << "}";
+    }
+    os << "\n  ]\n}\n";
+}
+
+bool parseArg(const std::string& arg, const std::string& name, std::string& value) {
+    const std::string prefix = "--" + name + "=";
+    if (arg.compare(0, prefix.size(), prefix) != 0)
+        return false;
+    value = arg.substr(prefix.size());
+    return true;
+}
+
+}  // namespace
+
+int main(int argc, char* argv[]) {
+    std::string modelPaths, jsonPath, value;
+    std::vector<int> threadCounts = defaultThreads();
+    int repeats = 3;
+    for (int i = 1; i < argc; i++) {
+        const std::string arg = argv[i];
+        if (parseArg(arg, "models", value)) {
+            modelPaths = value;
+        } else if (parseArg(arg, "threads", value)) {
+            threadCounts.clear();
+            for (const auto& count : ov::util::split(value, ',', true))
+                threadCounts.push_back(std::stoi(count));
+        } else if (parseArg(arg, "repeats", value)) {
+            repeats = std::max(1, std::stoi(value));
+        } else if (parseArg(arg, "json", value)) {
+            jsonPath = value;
+        } else {
+            modelPaths.clear();
+            break;
+        }
+    }
+    if (modelPaths.empty()) {
+        std::cerr << "Usage: " << argv[0]
+                  << " --models=<file.xml|dir>[,...] [--threads=<n>[,...]] [--repeats=<n>] [--json=<file>]"
+                  << std::endl;
+        return 1;
+    }
+
+    ov::Core core;
+    std::vector<BenchmarkResult> results;
+    std::cout << std::left << std::setw(48) << "Model" << std::right << std::setw(8) << "nodes" << std::setw(9)
+              << "threads" << std::setw(12) << "serial ms" << std::setw(14) << "parallel ms" << std::setw(10)
+              << "speedup" << std::endl;
+    for (const auto& path : collectModels(modelPaths)) {
+        std::shared_ptr<ov::Model> model;
+        try {
+            model = core.read_model(path);
+        } catch (const std::exception& ex) {
+            std::cerr << "Skipped " << path << ": " << ex.what() << std::endl;
+            continue;
+        }
+        for (const auto threads : threadCounts) {
+            BenchmarkResult result;
+            result.model = ov::util::get_file_name(path);
+            result.nodes = model->get_ops().size();
+            result.threads = threads;
+            try {
+                result.serialMs = measureCompileTime(core, model, threads, false, repeats);
+                result.parallelMs = measureCompileTime(core, model, threads, true, repeats);
+            } catch (const std::exception& ex) {
+                std::cerr << "Skipped " << path << ": " << ex.what() << std::endl;
+                break;
+            }
+            std::cout << std::left << std::setw(48) << result.model << std::right << std::setw(8) << result.nodes
+                      << std::setw(9) << threads << std::fixed << std::setprecision(1) << std::setw(12)
+                      << result.serialMs << std::setw(14) << result.parallelMs << std::setprecision(2)
+                      << std::setw(10) << result.serialMs / result.parallelMs << std::endl;
+            results.push_back(result);
+        }
+    }
+
+    if (!jsonPath.empty()) {
+        std::ofstream json(jsonPath);
+        writeJson(results, json);
+    }
+    return 0;
+}
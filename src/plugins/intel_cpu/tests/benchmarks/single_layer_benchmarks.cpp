@@ -0,0 +1,320 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+/**
+ * Single-layer microbenchmarks of the CPU plugin kernels.
+ *
+ * Each case is a single operation model built for a point of the shape / precision / layout grid, which is compiled
+ * with the requested implementation type (PrimitivesPriority) and executed in a loop on a single stream.
+ * The cases with the implementation type which is not available on the host are skipped.
+ *
+ * Usage: ov_cpu_microbenchmarks [--filter=<substring>] [--json=<file>] [--min_time_ms=<ms>] [--threads=<n>]
+ */
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstring>
+#include <fstream>
+#include <functional>
+#include <iomanip>
+#include <iostream>
+#include <random>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "openvino/openvino.hpp"
+#include "openvino/opsets/opset11.hpp"
+#include "openvino/runtime/exec_model_info.hpp"
+#include "utils/rt_info/memory_formats_attribute.hpp"
+
+namespace {
+
+struct BenchmarkCase {
+    std::string op;
+    ov::Shape shape;
+    ov::element::Type precision;
+    // memory format of the 4D data, empty means the plugin default
+    std::string layout;
+    std::string implType;
+};
+
+struct BenchmarkResult {
+    BenchmarkCase params;
+    std::string actualImplType;
+    uint64_t iterations = 0;
+    double nsPerIteration = 0.0;
+    double gbPerSecond = 0.0;
+    double gflopPerSecond = 0.0;
+};
+
+struct OpModel {
+    std::shared_ptr<ov::Node> op;
+    ov::ParameterVector params;
+    // number of arithmetic operations per iteration, used to report GFLOP/s
+    double flops = 0.0;
+};
+
+using OpBuilder = std::function<OpModel(const ov::Shape&, const ov::element::Type&)>;
+
+std::shared_ptr<ov::opset11::Parameter> makeParam(const ov::element::Type& precision, const ov::Shape& shape) {
+    return std::make_shared<ov::opset11::Parameter>(precision, shape);
+}
+
+std::shared_ptr<ov::Node> axesConst(const std::vector<int64_t>& axes) {
+    return ov::opset11::Constant::create(ov::element::i64, ov::Shape{axes.size()}, axes);
+}
+
+const std::vector<std::pair<std::string, OpBuilder>>& opBuilders() {
+    static const std::vector<std::pair<std::string, OpBuilder>> builders = {
+        {"Eltwise_Add", [](const ov::Shape& shape, const ov::element::Type& prc) {
+            auto a = makeParam(prc, shape);
+            auto b = makeParam(prc, shape);
+            return OpModel{std::make_shared<ov::opset11::Add>(a, b), {a, b}, static_cast<double>(ov::shape_size(shape))};
+        }},
+        {"Eltwise_Swish", [](const ov::Shape& shape, const ov::element::Type& prc) {
+            auto a = makeParam(prc, shape);
+            // exp, add, div and mul per element
+            return OpModel{std::make_shared<ov::opset11::Swish>(a), {a}, 4.0 * ov::shape_size(shape)};
+        }},
+        {"ReduceSum", [](const ov::Shape& shape, const ov::element::Type& prc) {
+            auto a = makeParam(prc, shape);
+            auto op = std::make_shared<ov::opset11::ReduceSum>(a, axesConst({static_cast<int64_t>(shape.size()) - 1}), true);
+            return OpModel{op, {a}, static_cast<double>(ov::shape_size(shape))};
+        }},
+        {"Interpolate_Linear_x2", [](const ov::Shape& shape, const ov::element::Type& prc) {
+            auto a = makeParam(prc, shape);
+            ov::op::util::InterpolateBase::InterpolateAttrs attrs;
+            attrs.mode = ov::op::util::InterpolateBase::InterpolateMode::LINEAR_ONNX;
+            attrs.shape_calculation_mode = ov::op::util::InterpolateBase::ShapeCalcMode::SCALES;
+            attrs.pads_begin = attrs.pads_end = std::vector<size_t>(shape.size(), 0);
+            auto scales = ov::opset11::Constant::create(ov::element::f32, ov::Shape{2}, {2.f, 2.f});
+            auto op = std::make_shared<ov::opset11::Interpolate>(a, scales, axesConst({2, 3}), attrs);
+            // 4 points weighted with 2 additions and 4 multiplications per output element
+            return OpModel{op, {a}, 8.0 * ov::shape_size(op->get_output_shape(0))};
+        }},
+        {"TopK_10", [](const ov::Shape& shape, const ov::element::Type& prc) {
+            auto a = makeParam(prc, shape);
+            auto k = ov::opset11::Constant::create(ov::element::i64, ov::Shape{}, {10});
+            auto op = std::make_shared<ov::opset11::TopK>(a, k, static_cast<int64_t>(shape.size()) - 1,
+                                                          ov::op::TopKMode::MAX, ov::op::TopKSortType::SORT_VALUES);
+            // a comparison per element for each of log2(k) levels of the heap
+            return OpModel{op, {a}, std::log2(10.0) * ov::shape_size(shape)};
+        }},
+        {"Gather_axis1", [](const ov::Shape& shape, const ov::element::Type& prc) {
+            auto a = makeParam(prc, shape);
+            std::vector<int64_t> indices(shape[1]);
+            for (size_t i = 0; i < indices.size(); i++)
+                indices[i] = static_cast<int64_t>((i * 7) % shape[1]);
+            auto idx = ov::opset11::Constant::create(ov::element::i64, ov::Shape{indices.size()}, indices);
+            auto op = std::make_shared<ov::opset11::Gather>(a, idx, axesConst({1}));
+            return OpModel{op, {a}, 0.0};
+        }},
+        {"MVN_spatial", [](const ov::Shape& shape, const ov::element::Type& prc) {
+            auto a = makeParam(prc, shape);
+            std::vector<int64_t> axes;
+            for (size_t i = 2; i < shape.size(); i++)
+                axes.push_back(static_cast<int64_t>(i));
+            auto op = std::make_shared<ov::opset11::MVN>(a, axesConst(axes), true, 1e-9f, ov::op::MVNEpsMode::INSIDE_SQRT);
+            // mean, variance and normalization passes
+            return OpModel{op, {a}, 5.0 * ov::shape_size(shape)};
+        }},
+    };
+    return builders;
+}
+
+std::vector<BenchmarkCase> benchmarkGrid() {
+    const std::vector<ov::Shape> shapes = {{1, 64, 56, 56}, {1, 256, 14, 14}, {8, 32, 64, 64}};
+    const std::vector<ov::element::Type> precisions = {ov::element::f32, ov::element::bf16};
+    const std::vector<std::string> layouts = {"nchw", "nhwc"};
+    const std::vector<std::string> implTypes = {"jit_avx512", "jit_avx2", "jit_sse42", "ref"};
+
+    std::vector<BenchmarkCase> cases;
+    for (const auto& op : opBuilders())
+        for (const auto& shape : shapes)
+            for (const auto& precision : precisions)
+                for (const auto& layout : layouts)
+                    for (const auto& implType : implTypes)
+                        cases.push_back({op.first, shape, precision, layout, implType});
+    return cases;
+}
+
+std::string caseName(const BenchmarkCase& params) {
+    std::ostringstream os;
+    os << params.op << "/" << params.shape << "/" << params.precision << "/" << params.layout << "/" << params.implType;
+    return os.str();
+}
+
+std::shared_ptr<ov::Model> buildModel(const BenchmarkCase& params) {
+    const auto& builders = opBuilders();
+    const auto builder = std::find_if(builders.begin(), builders.end(), [&](const std::pair<std::string, OpBuilder>& b) {
+        return b.first == params.op;
+    });
+    // bf16 is executed with the inference precision hint, so the model itself is f32
+    auto opModel = builder->second(params.shape, ov::element::f32);
+    auto& rtInfo = opModel.op->get_rt_info();
+    rtInfo["PrimitivesPriority"] = "cpu:" + params.implType;
+    if (!params.layout.empty()) {
+        std::string inFormats;
+        for (size_t i = 0; i < opModel.params.size(); i++)
+            inFormats += (i ? ",cpu:" : "cpu:") + params.layout;
+        rtInfo[ov::intel_cpu::InputMemoryFormats::get_type_info_static()] = ov::intel_cpu::InputMemoryFormats(inFormats);
+        rtInfo[ov::intel_cpu::OutputMemoryFormats::get_type_info_static()] =
+            ov::intel_cpu::OutputMemoryFormats("cpu:" + params.layout);
+    }
+    auto model = std::make_shared<ov::Model>(opModel.op->outputs(), opModel.params, params.op);
+    model->get_rt_info()["flops"] = opModel.flops;
+    return model;
+}
+
+std::string selectedImplType(const ov::CompiledModel& compiledModel) {
+    for (const auto& node : compiledModel.get_runtime_model()->get_ordered_ops()) {
+        const auto& rtInfo = node->get_rt_info();
+        const auto layerType = rtInfo.find(ov::exec_model_info::LAYER_TYPE);
+        if (layerType == rtInfo.end())
+            continue;
+        const auto type = layerType->second.as<std::string>();
+        if (type == "Parameter" || type == "Result" || type == "Const" || type == "Reorder" || type == "Convert")
+            continue;
+        return rtInfo.at(ov::exec_model_info::IMPL_TYPE).as<std::string>();
+    }
+    return "unknown";
+}
+
+void fillRandom(ov::Tensor& tensor) {
+    std::mt19937 gen(42);
+    std::uniform_real_distribution<float> dist(-1.f, 1.f);
+    if (tensor.get_element_type() == ov::element::f32) {
+        auto* data = tensor.data<float>();
+        for (size_t i = 0; i < tensor.get_size(); i++)
+            data[i] = dist(gen);
+    } else {
+        std::memset(tensor.data(), 0, tensor.get_byte_size());
+    }
+}
+
+bool runCase(ov::Core& core, const BenchmarkCase& params, double minTimeMs, int threads, BenchmarkResult& result) {
+    const auto model = buildModel(params);
+    ov::AnyMap config = {ov::num_streams(1),
+                         ov::hint::inference_precision(params.precision),
+                         ov::hint::performance_mode(ov::hint::PerformanceMode::LATENCY)};
+    if (threads > 0)
+        config.insert(ov::inference_num_threads(threads));
+
+    ov::CompiledModel compiledModel;
+    try {
+        compiledModel = core.compile_model(model, "CPU", config);
+    } catch (const std::exception&) {
+        // the precision is not supported on the host
+        return false;
+    }
+    result.params = params;
+    result.actualImplType = selectedImplType(compiledModel);
+    // the plugin falls back to another implementation if the requested one is not available on the host
+    if (result.actualImplType.find(params.implType) == std::string::npos)
+        return false;
+
+    auto request = compiledModel.create_infer_request();
+    size_t bytes = 0;
+    for (const auto& input : compiledModel.inputs()) {
+        auto tensor = request.get_tensor(input);
+        fillRandom(tensor);
+        bytes += tensor.get_byte_size();
+    }
+    for (const auto& output : compiledModel.outputs())
+        bytes += request.get_tensor(output).get_byte_size();
+
+    // warm up: primitive creation and caches
+    for (int i = 0; i < 3; i++)
+        request.infer();
+
+    using clock = std::chrono::steady_clock;
+    const auto start = clock::now();
+    auto elapsed = clock::duration::zero();
+    uint64_t iterations = 0;
+    while (std::chrono::duration<double, std::milli>(elapsed).count() < minTimeMs) {
+        request.infer();
+        iterations++;
+        elapsed = clock::now() - start;
+    }
+
+    const double ns = std::chrono::duration<double, std::nano>(elapsed).count() / static_cast<double>(iterations);
+    const double flops = model->get_rt_info()["flops"].as<double>();
+    result.iterations = iterations;
+    result.nsPerIteration = ns;
+    result.gbPerSecond = static_cast<double>(bytes) / ns;
+    result.gflopPerSecond = flops / ns;
+    return true;
+}
+
+void writeJson(const std::vector<BenchmarkResult>& results, std::ostream& os) {
+    os << "{\n  \"benchmarks\": [";
+    for (size_t i = 0; i < results.size(); i++) {
+        const auto& r = results[i];
+        std::ostringstream shape;
+        shape << r.params.shape;
+        os << (i ? ",\n" : "\n") << "    {\"name\": \"" << caseName(r.params) << "\", \"op\": \"" << r.params.op
+           << "\", \"shape\": \"" << shape.str() << "\", \"precision\": \"" << r.params.precision
+           << "\", \"layout\": \"" << r.params.layout << "\", \"impl_type\": \"" << r.actualImplType
+           << "\", \"iterations\": " << r.iterations << ", \"ns_per_iteration\": " << r.nsPerIteration
+           << ", \"gb_per_second\": " << r.gbPerSecond << ", \"gflop_per_second\": " << r.gflopPerSecond << "}";
+    }
+    os << "\n  ]\n}\n";
+}
+
+bool parseArg(const std::string& arg, const std::string& name, std::string& value) {
+    const std::string prefix = "--" + name + "=";
+    if (arg.compare(0, prefix.size(), prefix) != 0)
+        return false;
+    value = arg.substr(prefix.size());
+    return true;
+}
+
+}  // namespace
+
+int main(int argc, char* argv[]) {
+    std::string filter, jsonPath, value;
+    double minTimeMs = 200.0;
+    int threads = 0;
+    for (int i = 1; i < argc; i++) {
+        const std::string arg = argv[i];
+        if (parseArg(arg, "filter", value)) {
+            filter = value;
+        } else if (parseArg(arg, "json", value)) {
+            jsonPath = value;
+        } else if (parseArg(arg, "min_time_ms", value)) {
+            minTimeMs = std::stod(value);
+        } else if (parseArg(arg, "threads", value)) {
+            threads = std::stoi(value);
+        } else {
+            std::cerr << "Usage: " << argv[0]
+                      << " [--filter=<substring>] [--json=<file>] [--min_time_ms=<ms>] [--threads=<n>]" << std::endl;
+            return 1;
+        }
+    }
+
+    ov::Core core;
+    std::vector<BenchmarkResult> results;
+    std::cout << std::left << std::setw(72) << "Benchmark" << std::right << std::setw(14) << "ns/iter"
+              << std::setw(10) << "GB/s" << std::setw(10) << "GFLOP/s" << std::endl;
+    for (const auto& params : benchmarkGrid()) {
+        const auto name = caseName(params);
+        if (!filter.empty() && name.find(filter) == std::string::npos)
+            continue;
+        BenchmarkResult result;
+        if (!runCase(core, params, minTimeMs, threads, result))
+            continue;
+        std::cout << std::left << std::setw(72) << name << std::right << std::fixed << std::setprecision(1)
+                  << std::setw(14) << result.nsPerIteration << std::setprecision(2) << std::setw(10)
+                  << result.gbPerSecond << std::setw(10) << result.gflopPerSecond << std::endl;
+        results.push_back(result);
+    }
+
+    if (!jsonPath.empty()) {
+        std::ofstream json(jsonPath);
+        writeJson(results, json);
+    }
+    return 0;
+}
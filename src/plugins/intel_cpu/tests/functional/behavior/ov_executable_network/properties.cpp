@@ -3,6 +3,9 @@
 //
 
 #include <gtest/gtest.h>
+#include <chrono>
+#include <functional>
+#include <future>
 
 #include "test_utils/properties_test.hpp"
 #include <common_test_utils/test_assertions.hpp>
@@ -12,6 +15,7 @@
 #include "openvino/runtime/compiled_model.hpp"
 #include "openvino/runtime/properties.hpp"
 #include "openvino/runtime/intel_cpu/properties.hpp"
+#include "openvino/opsets/opset10.hpp"
 #include "functional_test_utils/skip_tests_config.hpp"
 
 namespace {
@@ -20,19 +24,21 @@ TEST_F(OVClassConfigTestCPU, smoke_CpuExecNetworkSupportedPropertiesAreAvailable
     auto RO_property = [](const std::string& propertyName) {
         return ov::PropertyName(propertyName, ov::PropertyMutability::RO);
     };
+    auto RW_property = [](const std::string& propertyName) {
+        return ov::PropertyName(propertyName, ov::PropertyMutability::RW);
+    };
 
     std::vector<ov::PropertyName> expectedSupportedProperties{
         // read only
         RO_property(ov::supported_properties.name()),
         RO_property(ov::model_name.name()),
         RO_property(ov::optimal_number_of_infer_requests.name()),
-        RO_property(ov::num_streams.name()),
         RO_property(ov::affinity.name()),
-        RO_property(ov::inference_num_threads.name()),
         RO_property(ov::enable_profiling.name()),
         RO_property(ov::hint::inference_precision.name()),
         RO_property(ov::hint::performance_mode.name()),
         RO_property(ov::hint::execution_mode.name()),
+        RO_property(ov::hint::model_priority.name()),
         RO_property(ov::hint::num_requests.name()),
         RO_property(ov::hint::enable_cpu_pinning.name()),
         RO_property(ov::hint::scheduling_core_type.name()),
@@ -40,6 +46,22 @@ TEST_F(OVClassConfigTestCPU, smoke_CpuExecNetworkSupportedPropertiesAreAvailable
         RO_property(ov::execution_devices.name()),
         RO_property(ov::intel_cpu::denormals_optimization.name()),
         RO_property(ov::intel_cpu::sparse_weights_decompression_rate.name()),
+        RO_property(ov::intel_cpu::profiling_sampling_rate.name()),
+        RO_property(ov::intel_cpu::profiling_report.name()),
+        RO_property(ov::intel_cpu::profiling_trace.name()),
+        RO_property(ov::intel_cpu::warmup_shapes.name()),
+        RO_property(ov::intel_cpu::resource_usage.name()),
+        RO_property(ov::intel_cpu::huge_pages.name()),
+        RO_property(ov::intel_cpu::numa_aware_allocation.name()),
+        RO_property(ov::intel_cpu::prefault_memory.name()),
+        RO_property(ov::intel_cpu::allocation_stats.name()),
+        RO_property(ov::intel_cpu::lazy_compilation.name()),
+        RO_property(ov::intel_cpu::parallel_compilation.name()),
+        RO_property(ov::intel_cpu::continuous_batching.name()),
+        RO_property(ov::intel_cpu::continuous_batching_stats.name()),
+        // read write
+        RW_property(ov::num_streams.name()),
+        RW_property(ov::inference_num_threads.name()),
     };
 
     ov::Core ie;
@@ -76,11 +98,78 @@ TEST_F(OVClassConfigTestCPU, smoke_CpuExecNetworkSetROPropertiesThrow) {
 
     for (auto it = properties.begin(); it != properties.end(); ++it) {
         ASSERT_TRUE(it != properties.end());
-        ASSERT_FALSE(it->is_mutable());
+        if (it->is_mutable())
+            continue;
         ASSERT_THROW(compiledModel.set_property({{*it, "DUMMY VALUE"}}), ov::Exception);
     }
 }
 
+TEST_F(OVClassConfigTestCPU, smoke_CpuExecNetworkReconfigureStreams) {
+    ov::Core ie;
+    ov::CompiledModel compiledModel = ie.compile_model(model, deviceName, ov::num_streams(2));
+    ov::Tensor input(model->input().get_element_type(), model->input().get_shape());
+    for (size_t i = 0; i < input.get_size(); i++)
+        input.data<float>()[i] = static_cast<float>(i % 7) - 3.f;
+    auto inferRequest = compiledModel.create_infer_request();
+    inferRequest.set_input_tensor(input);
+    inferRequest.infer();
+    auto expected = inferRequest.get_output_tensor();
+    std::vector<float> reference(expected.data<float>(), expected.data<float>() + expected.get_size());
+
+    // the request created before the change is still usable
+    inferRequest.start_async();
+    ASSERT_NO_THROW(compiledModel.set_property(ov::num_streams(1)));
+    inferRequest.wait();
+    ASSERT_EQ(compiledModel.get_property(ov::num_streams), 1);
+    ASSERT_EQ(compiledModel.get_property(ov::optimal_number_of_infer_requests), 1u);
+    inferRequest.infer();
+    auto output = inferRequest.get_output_tensor();
+    ASSERT_EQ(std::vector<float>(output.data<float>(), output.data<float>() + output.get_size()), reference);
+
+    ASSERT_NO_THROW(compiledModel.set_property(ov::num_streams(3), ov::inference_num_threads(3)));
+    ASSERT_EQ(compiledModel.get_property(ov::num_streams), 3);
+    std::vector<ov::InferRequest> requests;
+    for (size_t i = 0; i < 3; i++) {
+        requests.push_back(compiledModel.create_infer_request());
+        requests.back().set_input_tensor(input);
+        requests.back().start_async();
+    }
+    for (auto& request : requests) {
+        request.wait();
+        output = request.get_output_tensor();
+        ASSERT_EQ(std::vector<float>(output.data<float>(), output.data<float>() + output.get_size()), reference);
+    }
+
+    ASSERT_THROW(compiledModel.set_property(ov::num_streams(0)), ov::Exception);
+    ASSERT_THROW(compiledModel.set_property(ov::enable_profiling(true)), ov::Exception);
+}
+
+TEST_F(OVClassConfigTestCPU, smoke_CpuExecNetworkReconfigureStreamsFromCallback) {
+    ov::Core ie;
+    ov::CompiledModel compiledModel = ie.compile_model(model, deviceName, ov::num_streams(2));
+    auto inferRequest = compiledModel.create_infer_request();
+    std::promise<std::exception_ptr> reconfigured;
+    inferRequest.set_callback([&](std::exception_ptr exception) {
+        try {
+            if (exception)
+                std::rethrow_exception(exception);
+            compiledModel.set_property(ov::num_streams(1));
+            reconfigured.set_value(nullptr);
+        } catch (...) {
+            reconfigured.set_value(std::current_exception());
+        }
+    });
+    inferRequest.start_async();
+    // the callbacks are executed by the callback executor, so the change doesn't wait for the callback itself
+    auto future = reconfigured.get_future();
+    ASSERT_EQ(future.wait_for(std::chrono::seconds(60)), std::future_status::ready);
+    ASSERT_EQ(future.get(), nullptr);
+    inferRequest.wait();
+    ASSERT_EQ(compiledModel.get_property(ov::num_streams), 1);
+    inferRequest.set_callback([](std::exception_ptr) {});
+    ASSERT_NO_THROW(inferRequest.infer());
+}
+
 TEST_F(OVClassConfigTestCPU, smoke_CpuExecNetworkCheckCoreStreamsHasHigherPriorityThanThroughputHint) {
     ov::Core ie;
     int32_t streams = 1; // throughput hint should apply higher number of streams
@@ -144,6 +233,540 @@ TEST_F(OVClassConfigTestCPU, smoke_CpuExecNetworkCheckSparseWeigthsDecompression
     ASSERT_NO_THROW(ov::CompiledModel compiledModel = core.compile_model(model, deviceName));
 }
 
+TEST_F(OVClassConfigTestCPU, smoke_CpuExecNetworkCheckProfilingReportAndTrace) {
+    ov::Core core;
+
+    ov::CompiledModel compiledModel = core.compile_model(model, deviceName,
+                                                         ov::enable_profiling(true),
+                                                         ov::intel_cpu::profiling_sampling_rate(2));
+    ASSERT_EQ(compiledModel.get_property(ov::intel_cpu::profiling_sampling_rate), 2);
+    auto inferRequest = compiledModel.create_infer_request();
+    for (size_t i = 0; i < 4; i++) {
+        inferRequest.infer();
+    }
+
+    const std::string report = compiledModel.get_property(ov::intel_cpu::profiling_report);
+    // only each second inference is profiled
+    ASSERT_NE(report.find("\"count\":2,"), std::string::npos);
+    ASSERT_NE(report.find("\"p99_us\":"), std::string::npos);
+    const std::string trace = compiledModel.get_property(ov::intel_cpu::profiling_trace);
+    ASSERT_NE(trace.find("\"ph\":\"X\""), std::string::npos);
+}
+
+TEST_F(OVClassConfigTestCPU, smoke_CpuExecNetworkCheckModelPriorityAndResourceUsage) {
+    ov::Core core;
+
+    ov::CompiledModel criticalModel = core.compile_model(model, deviceName, ov::hint::model_priority(ov::hint::Priority::HIGH));
+    ov::CompiledModel backgroundModel = core.compile_model(model, deviceName, ov::hint::model_priority(ov::hint::Priority::LOW));
+    ASSERT_EQ(criticalModel.get_property(ov::hint::model_priority), ov::hint::Priority::HIGH);
+    ASSERT_EQ(backgroundModel.get_property(ov::hint::model_priority), ov::hint::Priority::LOW);
+    ASSERT_EQ(core.compile_model(model, deviceName).get_property(ov::hint::model_priority), ov::hint::Priority::MEDIUM);
+
+    // both models use all the cores, so their inferences are arbitrated
+    std::vector<ov::InferRequest> requests;
+    for (auto compiledModel : {criticalModel, backgroundModel}) {
+        for (size_t i = 0; i < 2; i++)
+            requests.push_back(compiledModel.create_infer_request());
+    }
+    for (size_t iteration = 0; iteration < 4; iteration++) {
+        for (auto& request : requests)
+            request.start_async();
+        for (auto& request : requests)
+            ASSERT_NO_THROW(request.wait());
+    }
+
+    const std::string usage = criticalModel.get_property(ov::intel_cpu::resource_usage);
+    ASSERT_NE(usage.find("\"priority\":\"HIGH\""), std::string::npos);
+    ASSERT_NE(usage.find("\"inferences\":8,"), std::string::npos);
+    ASSERT_NE(usage.find("\"utilization\":"), std::string::npos);
+
+    ASSERT_THROW(core.compile_model(model, deviceName, ov::AnyMap{{ov::hint::model_priority.name(), "URGENT"}}), ov::Exception);
+}
+
+TEST_F(OVClassConfigTestCPU, smoke_CpuExecNetworkCheckWarmupShapes) {
+    ov::Core core;
+
+    auto param = std::make_shared<ov::opset10::Parameter>(ov::element::f32, ov::PartialShape{-1, 3, -1, -1});
+    param->set_friendly_name("data");
+    auto relu = std::make_shared<ov::opset10::Relu>(param);
+    auto dynamicModel = std::make_shared<ov::Model>(ov::OutputVector{relu}, ov::ParameterVector{param});
+
+    const std::string shapes = "data[1,3,16,16];data[1..4,3,32,32]";
+    ov::CompiledModel compiledModel;
+    ASSERT_NO_THROW(compiledModel = core.compile_model(dynamicModel, deviceName, ov::intel_cpu::warmup_shapes(shapes)));
+    ASSERT_EQ(compiledModel.get_property(ov::intel_cpu::warmup_shapes), shapes);
+    auto inferRequest = compiledModel.create_infer_request();
+    inferRequest.set_input_tensor(ov::Tensor(ov::element::f32, {4, 3, 32, 32}));
+    ASSERT_NO_THROW(inferRequest.infer());
+
+    // the shapes must be static or bounded and compatible with the inputs of the model
+    ASSERT_THROW(core.compile_model(dynamicModel, deviceName, ov::intel_cpu::warmup_shapes("data[1,4,16,16]")),
+                 ov::Exception);
+    ASSERT_THROW(core.compile_model(dynamicModel, deviceName, ov::intel_cpu::warmup_shapes("data[1,3,?,16]")),
+                 ov::Exception);
+}
+
+TEST_F(OVClassConfigTestCPU, smoke_CpuExecNetworkCheckWarmupShapesPrepareKernels) {
+    if (!InferenceEngine::with_cpu_x86_sse42())
+        GTEST_SKIP() << "The MVN kernels are JIT generated on x64 only";
+    ov::Core core;
+
+    // the JIT kernels of MVN are specialized for the input shape and shared through the process wide kernel cache
+    auto param = std::make_shared<ov::opset10::Parameter>(ov::element::f32, ov::PartialShape{1, 3, -1, -1});
+    param->set_friendly_name("data");
+    auto axes = ov::opset10::Constant::create(ov::element::i64, ov::Shape{2}, {2, 3});
+    auto mvn = std::make_shared<ov::opset10::MVN>(param, axes, true, 1e-9f, ov::op::MVNEpsMode::INSIDE_SQRT);
+    auto dynamicModel = std::make_shared<ov::Model>(ov::OutputVector{mvn}, ov::ParameterVector{param});
+
+    auto getKernelMisses = [&] {
+        const std::string stats = core.get_property(deviceName, ov::intel_cpu::jit_kernel_cache_stats);
+        const std::string key = "\"misses\":";
+        const auto pos = stats.find(key);
+        EXPECT_NE(pos, std::string::npos) << stats;
+        return pos == std::string::npos ? 0ull : std::stoull(stats.substr(pos + key.size()));
+    };
+
+    auto compiledModel = core.compile_model(dynamicModel, deviceName, ov::num_streams(1),
+                                            ov::intel_cpu::warmup_shapes("data[1,3,20,20]"));
+    auto inferRequest = compiledModel.create_infer_request();
+    inferRequest.set_input_tensor(ov::Tensor(ov::element::f32, {1, 3, 20, 20}));
+    const auto misses = getKernelMisses();
+    ASSERT_NO_THROW(inferRequest.infer());
+    // the kernels of the warmed up shape are generated on the compilation
+    ASSERT_EQ(getKernelMisses(), misses);
+
+    inferRequest.set_input_tensor(ov::Tensor(ov::element::f32, {1, 3, 24, 24}));
+    ASSERT_NO_THROW(inferRequest.infer());
+    ASSERT_GT(getKernelMisses(), misses);
+}
+
+TEST_F(OVClassConfigTestCPU, smoke_CpuExecNetworkCheckMemoryPlacement) {
+    ov::Core core;
+
+    // the weights of the big MatMul exceed the huge page size
+    auto param = std::make_shared<ov::opset10::Parameter>(ov::element::f32, ov::Shape{1, 1024});
+    auto weights = ov::opset10::Constant::create(ov::element::f32, {1024, 1024}, std::vector<float>(1024 * 1024, 0.5f));
+    auto matMul = std::make_shared<ov::opset10::MatMul>(param, weights);
+    auto bigModel = std::make_shared<ov::Model>(ov::OutputVector{matMul}, ov::ParameterVector{param});
+    std::vector<float> input(1024, 1.0f);
+
+    for (const auto hugePages : {ov::intel_cpu::HugePages::DISABLED,
+                                 ov::intel_cpu::HugePages::TRANSPARENT_HUGE_PAGES,
+                                 ov::intel_cpu::HugePages::EXPLICIT_HUGE_PAGES}) {
+        ov::CompiledModel compiledModel;
+        ASSERT_NO_THROW(compiledModel = core.compile_model(bigModel,
+                                                           deviceName,
+                                                           ov::intel_cpu::huge_pages(hugePages),
+                                                           ov::intel_cpu::numa_aware_allocation(true),
+                                                           ov::intel_cpu::prefault_memory(true)));
+        ASSERT_EQ(compiledModel.get_property(ov::intel_cpu::huge_pages), hugePages);
+        ASSERT_TRUE(compiledModel.get_property(ov::intel_cpu::numa_aware_allocation));
+        ASSERT_TRUE(compiledModel.get_property(ov::intel_cpu::prefault_memory));
+
+        auto inferRequest = compiledModel.create_infer_request();
+        inferRequest.set_input_tensor(ov::Tensor(ov::element::f32, {1, 1024}, input.data()));
+        ASSERT_NO_THROW(inferRequest.infer());
+        ASSERT_EQ(inferRequest.get_output_tensor().data<float>()[0], 512.0f);
+
+        const std::string stats = compiledModel.get_property(ov::intel_cpu::allocation_stats);
+        ASSERT_NE(stats.find("\"allocations\":"), std::string::npos);
+        ASSERT_NE(stats.find("\"huge_page_bytes\":"), std::string::npos);
+        ASSERT_NE(stats.find("\"numa_bound_bytes\":"), std::string::npos);
+        ASSERT_EQ(stats.find("\"allocations\":0,"), std::string::npos);
+    }
+
+    ASSERT_THROW(core.compile_model(model, deviceName, ov::AnyMap{{ov::intel_cpu::huge_pages.name(), "1GB"}}),
+                 ov::Exception);
+}
+
+TEST_F(OVClassConfigTestCPU, smoke_CpuExecNetworkCheckDynamicResizeIsNotPrefaulted) {
+    ov::Core core;
+
+    // the intermediate buffer of the fused eltwise exceeds the huge page size and is allocated by the inference
+    auto param = std::make_shared<ov::opset10::Parameter>(ov::element::f32, ov::PartialShape{1, -1});
+    auto relu = std::make_shared<ov::opset10::Relu>(param);
+    auto scale = ov::opset10::Constant::create(ov::element::f32, {}, {2.0f});
+    auto multiply = std::make_shared<ov::opset10::Multiply>(relu, scale);
+    auto reduce = std::make_shared<ov::opset10::ReduceSum>(multiply,
+                                                           ov::opset10::Constant::create(ov::element::i64, {1}, {1}));
+    auto dynamicModel = std::make_shared<ov::Model>(ov::OutputVector{reduce}, ov::ParameterVector{param});
+
+    auto compiledModel = core.compile_model(dynamicModel, deviceName, ov::intel_cpu::prefault_memory(true));
+    auto getStat = [&](const std::string& name) {
+        const std::string stats = compiledModel.get_property(ov::intel_cpu::allocation_stats);
+        const std::string key = "\"" + name + "\":";
+        const auto pos = stats.find(key);
+        EXPECT_NE(pos, std::string::npos) << stats;
+        return pos == std::string::npos ? 0ull : std::stoull(stats.substr(pos + key.size()));
+    };
+
+    const size_t size = 1024 * 1024;
+    std::vector<float> input(size, 1.0f);
+    auto inferRequest = compiledModel.create_infer_request();
+    inferRequest.set_input_tensor(ov::Tensor(ov::element::f32, {1, size}, input.data()));
+    const auto allocatedBytes = getStat("allocated_bytes");
+    const auto prefaultedBytes = getStat("prefaulted_bytes");
+    ASSERT_NO_THROW(inferRequest.infer());
+    ASSERT_EQ(inferRequest.get_output_tensor().data<float>()[0], 2.0f * size);
+
+    ASSERT_GE(getStat("allocated_bytes"), allocatedBytes + size * sizeof(float));
+    // the pages of the resized buffers are committed by the inference itself
+    ASSERT_EQ(getStat("prefaulted_bytes"), prefaultedBytes);
+}
+
+TEST_F(OVClassConfigTestCPU, smoke_CpuExecNetworkCheckLazyCompilation) {
+    ov::Core core;
+
+    auto convModel = ngraph::builder::subgraph::makeConvPoolRelu({1, 1, 32, 32});
+    ov::Tensor input(ov::element::f32, {1, 1, 32, 32});
+    for (size_t i = 0; i < input.get_size(); i++)
+        input.data<float>()[i] = static_cast<float>(i % 7) - 3.0f;
+
+    auto eagerRequest = core.compile_model(convModel, deviceName).create_infer_request();
+    eagerRequest.set_input_tensor(input);
+    eagerRequest.infer();
+    const auto expected = eagerRequest.get_output_tensor();
+
+    for (const auto streams : {1, 2}) {
+        ov::CompiledModel compiledModel;
+        ASSERT_NO_THROW(compiledModel = core.compile_model(convModel,
+                                                           deviceName,
+                                                           ov::intel_cpu::lazy_compilation(true),
+                                                           ov::num_streams(streams)));
+        ASSERT_TRUE(compiledModel.get_property(ov::intel_cpu::lazy_compilation));
+        // the inference right after the compilation creates the primitives, which are not created in the background
+        auto inferRequest = compiledModel.create_infer_request();
+        inferRequest.set_input_tensor(input);
+        for (size_t i = 0; i < 3; i++) {
+            ASSERT_NO_THROW(inferRequest.infer());
+            const auto output = inferRequest.get_output_tensor();
+            ASSERT_EQ(output.get_shape(), expected.get_shape());
+            for (size_t j = 0; j < output.get_size(); j++)
+                ASSERT_EQ(output.data<float>()[j], expected.data<float>()[j]);
+        }
+    }
+
+    ASSERT_THROW(core.compile_model(model, deviceName, ov::AnyMap{{ov::intel_cpu::lazy_compilation.name(), "LAZY"}}),
+                 ov::Exception);
+}
+
+TEST_F(OVClassConfigTestCPU, smoke_CpuExecNetworkCheckLazyCompilationOfManyNodes) {
+    ov::Core core;
+
+    auto convModel = ngraph::builder::subgraph::makeSplitMultiConvConcat({1, 4, 20, 20});
+    ov::Tensor input(ov::element::f32, {1, 4, 20, 20});
+    for (size_t i = 0; i < input.get_size(); i++)
+        input.data<float>()[i] = static_cast<float>(i % 7) - 3.0f;
+
+    auto eagerRequest = core.compile_model(convModel, deviceName).create_infer_request();
+    eagerRequest.set_input_tensor(input);
+    eagerRequest.infer();
+    const auto expected = eagerRequest.get_output_tensor();
+
+    // the requests started right after the compilation take over the creation of the primitives from the background
+    for (const auto streams : {1, 2}) {
+        auto compiledModel = core.compile_model(convModel,
+                                                deviceName,
+                                                ov::intel_cpu::lazy_compilation(true),
+                                                ov::num_streams(streams));
+        std::vector<ov::InferRequest> requests;
+        for (int i = 0; i < streams; i++) {
+            requests.push_back(compiledModel.create_infer_request());
+            requests.back().set_input_tensor(input);
+        }
+        for (auto& request : requests)
+            request.start_async();
+        for (auto& request : requests) {
+            ASSERT_NO_THROW(request.wait());
+            const auto output = request.get_output_tensor();
+            ASSERT_EQ(output.get_shape(), expected.get_shape());
+            for (size_t i = 0; i < output.get_size(); i++)
+                ASSERT_EQ(output.data<float>()[i], expected.data<float>()[i]);
+        }
+    }
+}
+
+TEST_F(OVClassConfigTestCPU, smoke_CpuExecNetworkCheckLazyCompilationWithWarmup) {
+    ov::Core core;
+
+    auto param = std::make_shared<ov::opset10::Parameter>(ov::element::f32, ov::PartialShape{-1, 3, -1, -1});
+    param->set_friendly_name("data");
+    std::vector<float> weightsData(8 * 3 * 3 * 3);
+    for (size_t i = 0; i < weightsData.size(); i++)
+        weightsData[i] = static_cast<float>(i % 5) - 2.0f;
+    auto weights = ov::opset10::Constant::create(ov::element::f32, {8, 3, 3, 3}, weightsData);
+    auto conv = std::make_shared<ov::opset10::Convolution>(param,
+                                                           weights,
+                                                           ov::Strides{1, 1},
+                                                           ov::CoordinateDiff{1, 1},
+                                                           ov::CoordinateDiff{1, 1},
+                                                           ov::Strides{1, 1});
+    auto relu = std::make_shared<ov::opset10::Relu>(conv);
+    auto dynamicModel = std::make_shared<ov::Model>(ov::OutputVector{relu}, ov::ParameterVector{param});
+
+    ov::Tensor input(ov::element::f32, {2, 3, 16, 16});
+    for (size_t i = 0; i < input.get_size(); i++)
+        input.data<float>()[i] = static_cast<float>(i % 7) - 3.0f;
+
+    auto eagerRequest = core.compile_model(dynamicModel, deviceName).create_infer_request();
+    eagerRequest.set_input_tensor(input);
+    eagerRequest.infer();
+    const auto expected = eagerRequest.get_output_tensor();
+
+    // the warmup runs on the graph while its primitives are still created in the background
+    for (const auto streams : {1, 2}) {
+        ov::CompiledModel compiledModel;
+        ASSERT_NO_THROW(compiledModel = core.compile_model(dynamicModel,
+                                                           deviceName,
+                                                           ov::intel_cpu::lazy_compilation(true),
+                                                           ov::intel_cpu::warmup_shapes("data[1..2,3,16,16]"),
+                                                           ov::num_streams(streams)));
+        auto inferRequest = compiledModel.create_infer_request();
+        inferRequest.set_input_tensor(input);
+        ASSERT_NO_THROW(inferRequest.infer());
+        const auto output = inferRequest.get_output_tensor();
+        ASSERT_EQ(output.get_shape(), expected.get_shape());
+        for (size_t i = 0; i < output.get_size(); i++)
+            ASSERT_EQ(output.data<float>()[i], expected.data<float>()[i]);
+    }
+}
+
+TEST_F(OVClassConfigTestCPU, smoke_CpuExecNetworkCheckParallelCompilation) {
+    ov::Core core;
+
+    auto convModel = ngraph::builder::subgraph::makeSplitMultiConvConcat({1, 4, 20, 20});
+    ov::Tensor input(ov::element::f32, {1, 4, 20, 20});
+    for (size_t i = 0; i < input.get_size(); i++)
+        input.data<float>()[i] = static_cast<float>(i % 7) - 3.0f;
+
+    ov::CompiledModel serialModel;
+    ASSERT_NO_THROW(serialModel = core.compile_model(convModel, deviceName));
+    ASSERT_FALSE(serialModel.get_property(ov::intel_cpu::parallel_compilation));
+    auto serialRequest = serialModel.create_infer_request();
+    serialRequest.set_input_tensor(input);
+    serialRequest.infer();
+    const auto expected = serialRequest.get_output_tensor();
+
+    for (const auto streams : {1, 2}) {
+        ov::CompiledModel compiledModel;
+        ASSERT_NO_THROW(compiledModel = core.compile_model(convModel,
+                                                           deviceName,
+                                                           ov::intel_cpu::parallel_compilation(true),
+                                                           ov::num_streams(streams)));
+        ASSERT_TRUE(compiledModel.get_property(ov::intel_cpu::parallel_compilation));
+        auto inferRequest = compiledModel.create_infer_request();
+        inferRequest.set_input_tensor(input);
+        ASSERT_NO_THROW(inferRequest.infer());
+        const auto output = inferRequest.get_output_tensor();
+        ASSERT_EQ(output.get_shape(), expected.get_shape());
+        for (size_t j = 0; j < output.get_size(); j++)
+            ASSERT_EQ(output.data<float>()[j], expected.data<float>()[j]);
+    }
+
+    ASSERT_THROW(core.compile_model(model, deviceName, ov::AnyMap{{ov::intel_cpu::parallel_compilation.name(), "2"}}),
+                 ov::Exception);
+}
+
+TEST_F(OVClassConfigTestCPU, smoke_CpuExecNetworkCheckParallelCompilationSharedScratchpad) {
+    ov::Core core;
+
+    // the FullyConnected, Softmax and Pooling nodes of the branches request scratchpads of different sizes from the
+    // shared scratchpad while their primitives are created in parallel, the test is meant for the ThreadSanitizer runs
+    auto fcInput = std::make_shared<ov::opset10::Parameter>(ov::element::f32, ov::Shape{4, 256});
+    auto poolInput = std::make_shared<ov::opset10::Parameter>(ov::element::f32, ov::Shape{1, 16, 32, 32});
+    ov::OutputVector outputs;
+    for (size_t i = 0; i < 8; i++) {
+        const size_t outputSize = 64 * (i + 1);
+        std::vector<float> weightsData(256 * outputSize);
+        for (size_t j = 0; j < weightsData.size(); j++)
+            weightsData[j] = static_cast<float>((i + j) % 11) / 11.0f - 0.5f;
+        auto weights = ov::opset10::Constant::create(ov::element::f32, {256, outputSize}, weightsData);
+        auto matMul = std::make_shared<ov::opset10::MatMul>(fcInput, weights);
+        outputs.push_back(std::make_shared<ov::opset10::Softmax>(matMul, 1));
+        const size_t kernel = i + 2;
+        outputs.push_back(std::make_shared<ov::opset10::MaxPool>(poolInput,
+                                                                 ov::Strides{1, 1},
+                                                                 ov::Strides{1, 1},
+                                                                 ov::Shape{0, 0},
+                                                                 ov::Shape{0, 0},
+                                                                 ov::Shape{kernel, kernel})
+                              ->output(0));
+    }
+    auto branchesModel = std::make_shared<ov::Model>(outputs, ov::ParameterVector{fcInput, poolInput});
+
+    auto fillInput = [](ov::InferRequest& request, size_t port) {
+        auto tensor = request.get_input_tensor(port);
+        for (size_t i = 0; i < tensor.get_size(); i++)
+            tensor.data<float>()[i] = static_cast<float>(i % 13) - 6.0f;
+    };
+
+    auto serialRequest = core.compile_model(branchesModel, deviceName).create_infer_request();
+    fillInput(serialRequest, 0);
+    fillInput(serialRequest, 1);
+    serialRequest.infer();
+
+    for (const auto streams : {1, 2}) {
+        auto compiledModel = core.compile_model(branchesModel,
+                                                deviceName,
+                                                ov::intel_cpu::parallel_compilation(true),
+                                                ov::num_streams(streams));
+        auto inferRequest = compiledModel.create_infer_request();
+        fillInput(inferRequest, 0);
+        fillInput(inferRequest, 1);
+        ASSERT_NO_THROW(inferRequest.infer());
+        for (size_t i = 0; i < outputs.size(); i++) {
+            const auto expected = serialRequest.get_output_tensor(i);
+            const auto output = inferRequest.get_output_tensor(i);
+            ASSERT_EQ(output.get_shape(), expected.get_shape());
+            for (size_t j = 0; j < output.get_size(); j++)
+                ASSERT_EQ(output.data<float>()[j], expected.data<float>()[j]) << "output " << i;
+        }
+    }
+}
+
+TEST_F(OVClassConfigTestCPU, smoke_CpuExecNetworkCheckContinuousBatching) {
+    ov::Core core;
+
+    // state += input, output = state * 2
+    const ov::Shape shape{1, 8};
+    auto input = std::make_shared<ov::opset10::Parameter>(ov::element::f32, shape);
+    input->set_friendly_name("input");
+    auto variable = std::make_shared<ov::op::util::Variable>(
+        ov::op::util::VariableInfo{shape, ov::element::f32, "state"});
+    auto readValue = std::make_shared<ov::opset10::ReadValue>(
+        ov::opset10::Constant::create(ov::element::f32, shape, {0}), variable);
+    auto add = std::make_shared<ov::opset10::Add>(readValue, input);
+    auto assign = std::make_shared<ov::opset10::Assign>(add, variable);
+    auto multiply = std::make_shared<ov::opset10::Multiply>(add, ov::opset10::Constant::create(ov::element::f32, {1}, {2}));
+    auto result = std::make_shared<ov::opset10::Result>(multiply);
+    auto statefulModel = std::make_shared<ov::Model>(ov::ResultVector{result},
+                                                     ov::SinkVector{assign},
+                                                     ov::ParameterVector{input},
+                                                     ov::op::util::VariableVector{variable});
+
+    const size_t sequences = 6;
+    const size_t steps = 4;
+    auto makeInput = [&](size_t sequence, size_t step) {
+        ov::Tensor tensor(ov::element::f32, shape);
+        for (size_t i = 0; i < tensor.get_size(); i++)
+            tensor.data<float>()[i] = static_cast<float>(sequence * 10 + step) + 0.5f * static_cast<float>(i);
+        return tensor;
+    };
+    auto expected = [&](size_t sequence, size_t step, size_t i) {
+        float state = 0.0f;
+        for (size_t s = 0; s <= step; s++)
+            state += static_cast<float>(sequence * 10 + s) + 0.5f * static_cast<float>(i);
+        return state * 2.0f;
+    };
+
+    for (const auto streams : {1, 2}) {
+        ov::CompiledModel compiledModel;
+        ASSERT_NO_THROW(compiledModel = core.compile_model(statefulModel,
+                                                           deviceName,
+                                                           ov::intel_cpu::continuous_batching(4),
+                                                           ov::num_streams(streams)));
+        ASSERT_EQ(compiledModel.get_property(ov::intel_cpu::continuous_batching), 4u);
+
+        std::vector<ov::InferRequest> requests;
+        for (size_t i = 0; i < sequences; i++)
+            requests.push_back(compiledModel.create_infer_request());
+        for (size_t step = 0; step < steps; step++) {
+            // the requests started together are gathered into the batched steps
+            for (size_t i = 0; i < sequences; i++) {
+                requests[i].set_input_tensor(makeInput(i, step));
+                requests[i].start_async();
+            }
+            for (size_t i = 0; i < sequences; i++) {
+                ASSERT_NO_THROW(requests[i].wait());
+                const auto output = requests[i].get_output_tensor();
+                ASSERT_EQ(output.get_shape(), shape);
+                for (size_t j = 0; j < output.get_size(); j++)
+                    ASSERT_EQ(output.data<float>()[j], expected(i, step, j));
+            }
+        }
+        // the states are kept by the requests and the synchronous inference joins the steps as well
+        requests[0].query_state().front().reset();
+        requests[0].set_input_tensor(makeInput(0, 0));
+        ASSERT_NO_THROW(requests[0].infer());
+        for (size_t j = 0; j < shape[1]; j++)
+            ASSERT_EQ(requests[0].get_output_tensor().data<float>()[j], expected(0, 0, j));
+        const auto state = requests[1].query_state().front().get_state();
+        for (size_t j = 0; j < shape[1]; j++)
+            ASSERT_EQ(state.data<float>()[j], expected(1, steps - 1, j) / 2.0f);
+
+        const std::string stats = compiledModel.get_property(ov::intel_cpu::continuous_batching_stats);
+        ASSERT_NE(stats.find("\"sequences\":" + std::to_string(sequences * steps + 1)), std::string::npos) << stats;
+    }
+
+    // the batched graphs are created for the streams of the compilation, so the streams can't be changed
+    {
+        auto compiledModel = core.compile_model(statefulModel,
+                                                deviceName,
+                                                ov::intel_cpu::continuous_batching(4),
+                                                ov::num_streams(1));
+        ASSERT_THROW(compiledModel.set_property(ov::num_streams(4)), ov::Exception);
+        ASSERT_EQ(compiledModel.get_property(ov::num_streams), 1);
+        std::vector<ov::InferRequest> requests;
+        for (size_t i = 0; i < sequences; i++) {
+            requests.push_back(compiledModel.create_infer_request());
+            requests.back().set_input_tensor(makeInput(i, 0));
+            requests.back().start_async();
+        }
+        for (size_t i = 0; i < sequences; i++) {
+            ASSERT_NO_THROW(requests[i].wait());
+            for (size_t j = 0; j < shape[1]; j++)
+                ASSERT_EQ(requests[i].get_output_tensor().data<float>()[j], expected(i, 0, j));
+        }
+    }
+
+    // the rows of the sequences would be mixed by the ops along the batch axis, which keep the shapes
+    using MixingOp = std::function<ov::Output<ov::Node>(const ov::Output<ov::Node>&)>;
+    std::vector<MixingOp> mixingOps{
+        [](const ov::Output<ov::Node>& data) {
+            return std::make_shared<ov::opset10::Softmax>(data, 0)->output(0);
+        },
+        [](const ov::Output<ov::Node>& data) {
+            auto indices = std::make_shared<ov::opset10::Convert>(data, ov::element::i32);
+            return std::make_shared<ov::opset10::GatherElements>(data, indices, 0)->output(0);
+        },
+        [&shape](const ov::Output<ov::Node>& data) {
+            // the row of the first sequence is overwritten
+            return std::make_shared<ov::opset10::ScatterUpdate>(
+                       data,
+                       ov::opset10::Constant::create(ov::element::i32, {1}, {0}),
+                       ov::opset10::Constant::create(ov::element::f32, shape, {1}),
+                       ov::opset10::Constant::create(ov::element::i32, {}, {0}))
+                ->output(0);
+        },
+    };
+    for (const auto& mixingOp : mixingOps) {
+        auto mixingInput = std::make_shared<ov::opset10::Parameter>(ov::element::f32, shape);
+        auto mixingVariable = std::make_shared<ov::op::util::Variable>(
+            ov::op::util::VariableInfo{shape, ov::element::f32, "mixing_state"});
+        auto mixingRead = std::make_shared<ov::opset10::ReadValue>(
+            ov::opset10::Constant::create(ov::element::f32, shape, {0}), mixingVariable);
+        auto mixingAdd = std::make_shared<ov::opset10::Add>(mixingRead, mixingInput);
+        auto mixing = mixingOp(mixingAdd);
+        auto mixingAssign = std::make_shared<ov::opset10::Assign>(mixing, mixingVariable);
+        auto mixingModel = std::make_shared<ov::Model>(ov::ResultVector{std::make_shared<ov::opset10::Result>(mixing)},
+                                                       ov::SinkVector{mixingAssign},
+                                                       ov::ParameterVector{mixingInput},
+                                                       ov::op::util::VariableVector{mixingVariable});
+        ov::CompiledModel mixingCompiledModel;
+        ASSERT_NO_THROW(mixingCompiledModel = core.compile_model(mixingModel, deviceName, ov::intel_cpu::continuous_batching(4)));
+        ASSERT_EQ(mixingCompiledModel.get_property(ov::intel_cpu::continuous_batching), 0u)
+            << mixing.get_node()->get_type_name();
+    }
+
+    // the batch is not found in the model without the states
+    ov::CompiledModel statelessModel;
+    ASSERT_NO_THROW(statelessModel = core.compile_model(model, deviceName, ov::intel_cpu::continuous_batching(4)));
+    ASSERT_EQ(statelessModel.get_property(ov::intel_cpu::continuous_batching), 0u);
+
+    ASSERT_THROW(core.compile_model(model, deviceName, ov::AnyMap{{ov::intel_cpu::continuous_batching.name(), "-1"}}),
+                 ov::Exception);
+}
+
 const auto bf16_if_can_be_emulated = InferenceEngine::with_cpu_x86_avx512_core() ? ov::element::bf16 : ov::element::f32;
 
 TEST_F(OVClassConfigTestCPU, smoke_CpuExecNetworkCheckExecutionModeIsAvailableInCoreAndModel) {
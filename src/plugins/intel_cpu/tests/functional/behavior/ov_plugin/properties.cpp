@@ -33,6 +33,7 @@ TEST_F(OVClassConfigTestCPU, smoke_PluginAllSupportedPropertiesAreAvailable) {
         RO_property(ov::device::full_name.name()),
         RO_property(ov::device::capabilities.name()),
         RO_property(ov::caching_properties.name()),
+        RO_property(ov::intel_cpu::jit_kernel_cache_stats.name()),
         // read write
         RW_property(ov::num_streams.name()),
         RW_property(ov::affinity.name()),
@@ -41,6 +42,7 @@ TEST_F(OVClassConfigTestCPU, smoke_PluginAllSupportedPropertiesAreAvailable) {
         RW_property(ov::hint::inference_precision.name()),
         RW_property(ov::hint::performance_mode.name()),
         RW_property(ov::hint::execution_mode.name()),
+        RW_property(ov::hint::model_priority.name()),
         RW_property(ov::hint::num_requests.name()),
         RW_property(ov::hint::enable_cpu_pinning.name()),
         RW_property(ov::hint::scheduling_core_type.name()),
@@ -48,6 +50,14 @@ TEST_F(OVClassConfigTestCPU, smoke_PluginAllSupportedPropertiesAreAvailable) {
         RW_property(ov::device::id.name()),
         RW_property(ov::intel_cpu::denormals_optimization.name()),
         RW_property(ov::intel_cpu::sparse_weights_decompression_rate.name()),
+        RW_property(ov::intel_cpu::profiling_sampling_rate.name()),
+        RW_property(ov::intel_cpu::warmup_shapes.name()),
+        RW_property(ov::intel_cpu::huge_pages.name()),
+        RW_property(ov::intel_cpu::numa_aware_allocation.name()),
+        RW_property(ov::intel_cpu::prefault_memory.name()),
+        RW_property(ov::intel_cpu::lazy_compilation.name()),
+        RW_property(ov::intel_cpu::parallel_compilation.name()),
+        RW_property(ov::intel_cpu::continuous_batching.name()),
     };
 
     ov::Core ie;
@@ -261,4 +271,27 @@ TEST_F(OVClassConfigTestCPU, smoke_PluginSetConfigExecutionModeAndInferencePreci
     expect_inference_precision(bf16_if_can_be_emulated);
 }
 
+TEST_F(OVClassConfigTestCPU, smoke_PluginJitKernelCacheSharesKernelsBetweenModels) {
+    ov::Core ie;
+    auto getStat = [&](const std::string& name) {
+        const std::string stats = ie.get_property("CPU", ov::intel_cpu::jit_kernel_cache_stats);
+        const auto pos = stats.find("\"" + name + "\":");
+        EXPECT_NE(pos, std::string::npos) << stats;
+        return std::stoull(stats.substr(pos + name.size() + 3));
+    };
+
+    auto subtractModel = ngraph::builder::subgraph::make2InputSubtract();
+    auto first = ie.compile_model(subtractModel, "CPU", ov::num_streams(1));
+    const auto hits = getStat("hits");
+    const auto misses = getStat("misses");
+
+    // the kernels of the first model are alive, so the same model doesn't generate any kernel
+    auto second = ie.compile_model(subtractModel, "CPU", ov::num_streams(1));
+    if (InferenceEngine::with_cpu_x86_sse42()) {
+        ASSERT_GT(getStat("kernels"), 0);
+        ASSERT_GT(getStat("hits"), hits);
+        ASSERT_EQ(getStat("misses"), misses);
+    }
+}
+
 } // namespace
@@ -74,7 +74,16 @@ public:
         size_t defaultIndex;
         std::tie(inputShapes, indices, offsets, defaultIndex, withWeights, withDefIndex) = embParams;
 
-        selectedType = makeSelectedTypeStr("ref", inType);
+        // floating point tables are processed by the JIT kernel on AVX2 and newer hosts,
+        // FP16 tables and BF16 tables on the hosts without AVX-512 are converted to FP32 by the plugin
+        auto tablePrecision = inType;
+        if (inType == ElementType::f16 || (inType == ElementType::bf16 && !InferenceEngine::with_cpu_x86_avx512_core()))
+            tablePrecision = ElementType::f32;
+        const bool isJit = (tablePrecision == ElementType::f32 || tablePrecision == ElementType::bf16) &&
+                           InferenceEngine::with_cpu_x86_avx2();
+        selectedType = makeSelectedTypeStr(isJit ? getPrimitiveType() : "ref", tablePrecision);
+        if (inType == ElementType::bf16 || inType == ElementType::f16)
+            rel_threshold = 1e-2f;
         targetDevice = CommonTestUtils::DEVICE_CPU;
 
         init_input_shapes({ inputShapes });
@@ -163,5 +172,19 @@ INSTANTIATE_TEST_SUITE_P(smoke, EmbeddingBagOffsetsSumLayerCPUTest,
                 ::testing::ValuesIn(indPrecisions),
                 ::testing::Values(CommonTestUtils::DEVICE_CPU)),
         EmbeddingBagOffsetsSumLayerCPUTest::getTestCaseName);
+
+// BF16 and FP16 tables are accumulated in FP32
+const std::vector<ElementType> lowPrecisionTables = {
+        ElementType::bf16,
+        ElementType::f16
+};
+
+INSTANTIATE_TEST_SUITE_P(smoke_LowPrecisionTable, EmbeddingBagOffsetsSumLayerCPUTest,
+        ::testing::Combine(
+                embBagOffsetSumArgSet,
+                ::testing::ValuesIn(lowPrecisionTables),
+                ::testing::Values(ElementType::i32),
+                ::testing::Values(CommonTestUtils::DEVICE_CPU)),
+        EmbeddingBagOffsetsSumLayerCPUTest::getTestCaseName);
 }  // namespace
 }  // namespace CPULayerTestsDefinitions
@@ -67,7 +67,16 @@ protected:
         bool withWeights;
         std::tie(inputShapes, indices, withWeights) = embParams;
 
-        selectedType = makeSelectedTypeStr("ref", inType);
+        // floating point tables are processed by the JIT kernel on AVX2 and newer hosts,
+        // FP16 tables and BF16 tables on the hosts without AVX-512 are converted to FP32 by the plugin
+        auto tablePrecision = inType;
+        if (inType == ElementType::f16 || (inType == ElementType::bf16 && !InferenceEngine::with_cpu_x86_avx512_core()))
+            tablePrecision = ElementType::f32;
+        const bool isJit = (tablePrecision == ElementType::f32 || tablePrecision == ElementType::bf16) &&
+                           InferenceEngine::with_cpu_x86_avx2();
+        selectedType = makeSelectedTypeStr(isJit ? getPrimitiveType() : "ref", tablePrecision);
+        if (inType == ElementType::bf16 || inType == ElementType::f16)
+            rel_threshold = 1e-2f;
         targetDevice = CommonTestUtils::DEVICE_CPU;
 
         init_input_shapes({ inputShapes });
@@ -147,5 +156,19 @@ INSTANTIATE_TEST_SUITE_P(smoke, EmbeddingBagPackedSumLayerCPUTest,
                 ::testing::ValuesIn(indPrecisions),
                 ::testing::Values(CommonTestUtils::DEVICE_CPU)),
         EmbeddingBagPackedSumLayerCPUTest::getTestCaseName);
+
+// BF16 and FP16 tables are accumulated in FP32
+const std::vector<ElementType> lowPrecisionTables = {
+        ElementType::bf16,
+        ElementType::f16
+};
+
+INSTANTIATE_TEST_SUITE_P(smoke_LowPrecisionTable, EmbeddingBagPackedSumLayerCPUTest,
+        ::testing::Combine(
+                embBagPackedSumArgSet,
+                ::testing::ValuesIn(lowPrecisionTables),
+                ::testing::Values(ElementType::i32),
+                ::testing::Values(CommonTestUtils::DEVICE_CPU)),
+        EmbeddingBagPackedSumLayerCPUTest::getTestCaseName);
 }  // namespace
 }  // namespace CPULayerTestsDefinitions
@@ -77,7 +77,16 @@ protected:
         size_t numSegments, defaultIndex;
         std::tie(inputShapes, indices, segmentIds, numSegments, defaultIndex, withWeights, withDefIndex) = embParams;
 
-        selectedType = makeSelectedTypeStr("ref", inType);
+        // floating point tables are processed by the JIT kernel on AVX2 and newer hosts,
+        // FP16 tables and BF16 tables on the hosts without AVX-512 are converted to FP32 by the plugin
+        auto tablePrecision = inType;
+        if (inType == ElementType::f16 || (inType == ElementType::bf16 && !InferenceEngine::with_cpu_x86_avx512_core()))
+            tablePrecision = ElementType::f32;
+        const bool isJit = (tablePrecision == ElementType::f32 || tablePrecision == ElementType::bf16) &&
+                           InferenceEngine::with_cpu_x86_avx2();
+        selectedType = makeSelectedTypeStr(isJit ? getPrimitiveType() : "ref", tablePrecision);
+        if (inType == ElementType::bf16 || inType == ElementType::f16)
+            rel_threshold = 1e-2f;
         targetDevice = CommonTestUtils::DEVICE_CPU;
 
         init_input_shapes({ inputShapes });
@@ -168,5 +177,19 @@ INSTANTIATE_TEST_SUITE_P(smoke, EmbeddingSegmentsSumLayerCPUTest,
          ::testing::ValuesIn(indPrecisions),
          ::testing::Values(CommonTestUtils::DEVICE_CPU)),
          EmbeddingSegmentsSumLayerCPUTest::getTestCaseName);
+
+// BF16 and FP16 tables are accumulated in FP32
+const std::vector<ElementType> lowPrecisionTables = {
+        ElementType::bf16,
+        ElementType::f16
+};
+
+INSTANTIATE_TEST_SUITE_P(smoke_LowPrecisionTable, EmbeddingSegmentsSumLayerCPUTest,
+     ::testing::Combine(
+         embSegmentsSumArgSet,
+         ::testing::ValuesIn(lowPrecisionTables),
+         ::testing::Values(ElementType::i32),
+         ::testing::Values(CommonTestUtils::DEVICE_CPU)),
+         EmbeddingSegmentsSumLayerCPUTest::getTestCaseName);
 }  // namespace
 }  // namespace CPULayerTestsDefinitions
@@ -0,0 +1,156 @@
+// Copyright (C) 2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <openvino/opsets/opset1.hpp>
+
+#include "ngraph_functions/builders.hpp"
+#include "shared_test_classes/base/ov_subgraph.hpp"
+#include "test_utils/cpu_test_utils.hpp"
+#include "cpp_interfaces/interface/ie_internal_plugin_config.hpp"
+
+using namespace ov::test;
+using namespace CPUTestUtils;
+
+namespace SubgraphTestsDefinitions {
+
+enum class TiledChain {
+    ConvReluConv,       // stride-1 convolutions with symmetric padding
+    ConvPoolAsymmetric, // pooling with asymmetric padding, the halo differs above and below the stripe
+    UnevenStripes       // the last stripe is shorter and the second convolution has no padding
+};
+
+std::ostream& operator<<(std::ostream& os, TiledChain chain) {
+    switch (chain) {
+    case TiledChain::ConvReluConv:
+        return os << "ConvReluConv";
+    case TiledChain::ConvPoolAsymmetric:
+        return os << "ConvPoolAsymmetric";
+    case TiledChain::UnevenStripes:
+        return os << "UnevenStripes";
+    }
+    return os;
+}
+
+using DepthFirstTilingParams = std::tuple<
+    TiledChain, // subgraph
+    ov::Shape,  // input shape
+    size_t      // cache budget in bytes
+>;
+
+/*
+ * The model is compiled with CPU_DEPTH_FIRST_TILING=YES and a cache budget small enough to split the chain
+ * into several stripes, the result is compared with the reference computed on the untiled model.
+ */
+class DepthFirstTilingTest : virtual public SubgraphBaseTest,
+                             public CPUTestsBase,
+                             public testing::WithParamInterface<DepthFirstTilingParams> {
+public:
+    static std::string getTestCaseName(const testing::TestParamInfo<DepthFirstTilingParams>& obj) {
+        TiledChain chain;
+        ov::Shape inputShape;
+        size_t cacheBudget;
+        std::tie(chain, inputShape, cacheBudget) = obj.param;
+
+        std::ostringstream result;
+        result << chain << "_IS=" << CommonTestUtils::vec2str(inputShape) << "_budget=" << cacheBudget;
+        return result.str();
+    }
+
+protected:
+    static std::shared_ptr<ov::Node> makeConv(const ov::Output<ov::Node>& in, size_t kernel, size_t pad) {
+        const auto channels = in.get_shape()[1];
+        return ngraph::builder::makeConvolution(in, ov::element::f32, {kernel, kernel}, {1, 1},
+                                                {static_cast<ptrdiff_t>(pad), static_cast<ptrdiff_t>(pad)},
+                                                {static_cast<ptrdiff_t>(pad), static_cast<ptrdiff_t>(pad)},
+                                                {1, 1}, ov::op::PadType::EXPLICIT, channels);
+    }
+
+    void SetUp() override {
+        TiledChain chain;
+        ov::Shape inputShape;
+        size_t cacheBudget;
+        std::tie(chain, inputShape, cacheBudget) = GetParam();
+        targetDevice = CommonTestUtils::DEVICE_CPU;
+        configuration.insert({InferenceEngine::PluginConfigInternalParams::KEY_CPU_DEPTH_FIRST_TILING,
+                              InferenceEngine::PluginConfigParams::YES});
+        configuration.insert({InferenceEngine::PluginConfigInternalParams::KEY_CPU_DEPTH_FIRST_TILING_CACHE_BUDGET,
+                              std::to_string(cacheBudget)});
+
+        init_input_shapes(static_shapes_to_test_representation(std::vector<ov::Shape>{inputShape}));
+        auto params = ngraph::builder::makeDynamicParams(ov::element::f32, inputDynamicShapes);
+        std::shared_ptr<ov::Node> last;
+        switch (chain) {
+        case TiledChain::ConvReluConv: {
+            auto conv = makeConv(params[0], 3, 1);
+            auto relu = std::make_shared<ov::opset1::Relu>(conv);
+            last = makeConv(relu, 3, 1);
+            break;
+        }
+        case TiledChain::ConvPoolAsymmetric: {
+            auto conv = makeConv(params[0], 3, 1);
+            auto maxPool = std::make_shared<ov::opset1::MaxPool>(conv, ov::Strides{1, 1}, ov::Shape{2, 1}, ov::Shape{0, 1},
+                                                                 ov::Shape{3, 3}, ov::op::RoundingType::FLOOR);
+            last = std::make_shared<ov::opset1::AvgPool>(maxPool, ov::Strides{1, 1}, ov::Shape{0, 1}, ov::Shape{2, 1},
+                                                         ov::Shape{3, 3}, true, ov::op::RoundingType::FLOOR);
+            break;
+        }
+        case TiledChain::UnevenStripes: {
+            auto conv = makeConv(params[0], 5, 2);
+            auto relu = std::make_shared<ov::opset1::Relu>(makeConv(conv, 3, 0));
+            last = relu;
+            break;
+        }
+        }
+        function = std::make_shared<ov::Model>(ov::ResultVector{std::make_shared<ov::opset1::Result>(last)}, params,
+                                               "DepthFirstTiling");
+        for (const auto& op : function->get_ops()) {
+            untiledConvolutions += ov::is_type<ov::opset1::Convolution>(op) ? 1 : 0;
+        }
+    }
+
+    // the chain has to be split by stripes, otherwise the test compares the untiled model with itself
+    void checkTiled() const {
+        size_t convolutions = 0;
+        for (const auto& node : compiledModel.get_runtime_model()->get_ops()) {
+            const auto& rtInfo = node->get_rt_info();
+            const auto it = rtInfo.find("layerType");
+            ASSERT_NE(it, rtInfo.end());
+            convolutions += it->second.as<std::string>() == "Convolution" ? 1 : 0;
+        }
+        EXPECT_GT(convolutions, untiledConvolutions);
+    }
+
+private:
+    size_t untiledConvolutions = 0;
+};
+
+TEST_P(DepthFirstTilingTest, CompareWithRefs) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+
+    run();
+    checkTiled();
+}
+
+namespace {
+// The budgets are selected for the listed shapes: 4 stripes of 16 rows for the convolutions, 3 stripes with
+// asymmetric halo for the pooling, 3 stripes of 12, 12 and 11 rows for the chain reducing the height.
+INSTANTIATE_TEST_SUITE_P(smoke_DepthFirstTiling_ConvReluConv, DepthFirstTilingTest,
+                         ::testing::Combine(::testing::Values(TiledChain::ConvReluConv),
+                                            ::testing::Values(ov::Shape{1, 16, 64, 64}),
+                                            ::testing::Values(size_t(160 * 1024))),
+                         DepthFirstTilingTest::getTestCaseName);
+
+INSTANTIATE_TEST_SUITE_P(smoke_DepthFirstTiling_ConvPoolAsymmetric, DepthFirstTilingTest,
+                         ::testing::Combine(::testing::Values(TiledChain::ConvPoolAsymmetric),
+                                            ::testing::Values(ov::Shape{1, 16, 64, 64}),
+                                            ::testing::Values(size_t(220 * 1024))),
+                         DepthFirstTilingTest::getTestCaseName);
+
+INSTANTIATE_TEST_SUITE_P(smoke_DepthFirstTiling_UnevenStripes, DepthFirstTilingTest,
+                         ::testing::Combine(::testing::Values(TiledChain::UnevenStripes),
+                                            ::testing::Values(ov::Shape{1, 16, 37, 128}),
+                                            ::testing::Values(size_t(300 * 1024))),
+                         DepthFirstTilingTest::getTestCaseName);
+}  // namespace
+}  // namespace SubgraphTestsDefinitions
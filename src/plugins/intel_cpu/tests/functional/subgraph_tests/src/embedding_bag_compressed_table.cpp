@@ -0,0 +1,148 @@
+// Copyright (C) 2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <openvino/opsets/opset3.hpp>
+#include "ngraph_functions/builders.hpp"
+#include "shared_test_classes/base/ov_subgraph.hpp"
+#include "test_utils/cpu_test_utils.hpp"
+
+using namespace ov::test;
+using namespace ngraph;
+using namespace CPUTestUtils;
+
+namespace SubgraphTestsDefinitions {
+enum class EmbeddingBagType {
+    OffsetsSum,
+    PackedSum,
+    SegmentsSum
+};
+
+std::ostream& operator<<(std::ostream& os, EmbeddingBagType type) {
+    switch (type) {
+    case EmbeddingBagType::OffsetsSum:
+        return os << "OffsetsSum";
+    case EmbeddingBagType::PackedSum:
+        return os << "PackedSum";
+    case EmbeddingBagType::SegmentsSum:
+        return os << "SegmentsSum";
+    }
+    return os;
+}
+
+// embedding bag operation, table precision, embedding depth, with zero points
+using EmbeddingBagCompressedTableParams = std::tuple<EmbeddingBagType, ElementType, size_t, bool>;
+
+/*  Const[u8/i8]
+        |
+     Convert
+        |
+    [Subtract]  <- per-row zero points
+        |
+     Multiply   <- per-row scales
+        |
+ EmbeddingBag*Sum <- per sample weights
+        |
+      Result
+*/
+class EmbeddingBagCompressedTableCPUTest : public testing::WithParamInterface<EmbeddingBagCompressedTableParams>,
+                                           virtual public SubgraphBaseTest,
+                                           public CPUTestsBase {
+public:
+    static std::string getTestCaseName(const testing::TestParamInfo<EmbeddingBagCompressedTableParams>& obj) {
+        EmbeddingBagType opType;
+        ElementType tableType;
+        size_t embDepth;
+        bool withZeroPoints;
+        std::tie(opType, tableType, embDepth, withZeroPoints) = obj.param;
+        std::ostringstream result;
+        result << opType << "_";
+        result << "TablePrc=" << tableType << "_";
+        result << "Depth=" << embDepth << "_";
+        result << "ZP=" << withZeroPoints;
+        return result.str();
+    }
+
+protected:
+    void SetUp() override {
+        EmbeddingBagType opType;
+        ElementType tableType;
+        size_t embDepth;
+        bool withZeroPoints;
+        std::tie(opType, tableType, embDepth, withZeroPoints) = this->GetParam();
+        targetDevice = CommonTestUtils::DEVICE_CPU;
+
+        const size_t rowsNum = 64;
+        const std::vector<int32_t> indices = {0, 5, 63, 2, 2, 17, 40, 1, 9, 33, 12, 0};
+        // the packed bags are of the same size, the other operations have empty bags filled by the default index
+        const ov::Shape indicesShape = opType == EmbeddingBagType::PackedSum ? ov::Shape{4, 3} : ov::Shape{indices.size()};
+
+        init_input_shapes({InputShape{{}, {indicesShape}}});
+        auto params = builder::makeDynamicParams(ElementType::f32, inputDynamicShapes);
+
+        const bool isSigned = tableType == ElementType::i8;
+        auto table = builder::makeConstant<int32_t>(tableType, {rowsNum, embDepth}, {}, true,
+                                                    isSigned ? 127 : 255, isSigned ? -128 : 0);
+        std::shared_ptr<ov::Node> decompression = std::make_shared<ov::opset3::Convert>(table, ElementType::f32);
+        if (withZeroPoints) {
+            auto zeroPoints = builder::makeConstant<float>(ElementType::f32, {rowsNum, 1}, {}, true, 10, -10);
+            decompression = std::make_shared<ov::opset3::Subtract>(decompression, zeroPoints);
+        }
+        auto scales = builder::makeConstant<float>(ElementType::f32, {rowsNum, 1}, {}, true, 1, 0);
+        decompression = std::make_shared<ov::opset3::Multiply>(decompression, scales);
+
+        auto indicesNode = builder::makeConstant<int32_t>(ElementType::i32, indicesShape, indices);
+        auto defaultIndex = builder::makeConstant<int32_t>(ElementType::i32, {}, {0});
+        std::shared_ptr<ov::Node> embBag;
+        switch (opType) {
+        case EmbeddingBagType::OffsetsSum: {
+            auto offsets = builder::makeConstant<int32_t>(ElementType::i32, {4}, {0, 3, 3, 7});
+            embBag = std::make_shared<ov::opset3::EmbeddingBagOffsetsSum>(decompression, indicesNode, offsets,
+                                                                          defaultIndex, params[0]);
+            break;
+        }
+        case EmbeddingBagType::PackedSum:
+            embBag = std::make_shared<ov::opset3::EmbeddingBagPackedSum>(decompression, indicesNode, params[0]);
+            break;
+        case EmbeddingBagType::SegmentsSum: {
+            auto segmentIds = builder::makeConstant<int32_t>(ElementType::i32, {indices.size()},
+                                                             {0, 0, 0, 2, 2, 2, 2, 3, 3, 3, 3, 3});
+            auto numSegments = builder::makeConstant<int32_t>(ElementType::i32, {}, {5});
+            embBag = std::make_shared<ov::opset3::EmbeddingSegmentsSum>(decompression, indicesNode, segmentIds,
+                                                                        numSegments, defaultIndex, params[0]);
+            break;
+        }
+        }
+        function = makeNgraphFunction(ElementType::f32, params, embBag, "EmbeddingBagCompressedTable");
+    }
+};
+
+TEST_P(EmbeddingBagCompressedTableCPUTest, CompareWithRefs) {
+    if (!InferenceEngine::with_cpu_x86_avx2())
+        GTEST_SKIP() << "Table decompression is fused into the JIT kernel only";
+    run();
+    // the decompression subgraph is fused into the embedding bag node
+    CheckNumberOfNodesWithTypes(compiledModel, {"Convert", "Eltwise"}, 0);
+}
+
+namespace {
+const std::vector<size_t> embDepths = {
+    // tail only
+    5,
+    // vectors and tail
+    37,
+    // several chunks of accumulators
+    300,
+};
+
+INSTANTIATE_TEST_SUITE_P(smoke_EmbeddingBagCompressedTable,
+                         EmbeddingBagCompressedTableCPUTest,
+                         ::testing::Combine(::testing::Values(EmbeddingBagType::OffsetsSum,
+                                                              EmbeddingBagType::PackedSum,
+                                                              EmbeddingBagType::SegmentsSum),
+                                            ::testing::Values(ElementType::u8, ElementType::i8),
+                                            ::testing::ValuesIn(embDepths),
+                                            ::testing::Bool()),
+                         EmbeddingBagCompressedTableCPUTest::getTestCaseName);
+}  // namespace
+}  // namespace SubgraphTestsDefinitions
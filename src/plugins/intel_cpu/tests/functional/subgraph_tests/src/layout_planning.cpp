@@ -0,0 +1,159 @@
+// Copyright (C) 2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <sstream>
+
+#include <openvino/opsets/opset10.hpp>
+
+#include "ngraph_functions/builders.hpp"
+#include "shared_test_classes/base/ov_subgraph.hpp"
+#include "test_utils/cpu_test_utils.hpp"
+
+using namespace ov::test;
+using namespace CPUTestUtils;
+
+namespace SubgraphTestsDefinitions {
+
+class LayoutPlanningTest : virtual public SubgraphBaseTest, public CPUTestsBase {
+protected:
+    void SetUp() override {
+        targetDevice = CommonTestUtils::DEVICE_CPU;
+    }
+
+    static std::shared_ptr<ov::Node> makeConv(const ov::Output<ov::Node>& in, size_t outChannels) {
+        return ngraph::builder::makeConvolution(in, ov::element::f32, {3, 3}, {1, 1}, {1, 1}, {1, 1}, {1, 1},
+                                                ov::op::PadType::EXPLICIT, outChannels);
+    }
+
+    static std::string getRtString(const std::shared_ptr<ov::Node>& node, const std::string& key) {
+        const auto& rtInfo = node->get_rt_info();
+        const auto it = rtInfo.find(key);
+        OPENVINO_ASSERT(it != rtInfo.end(), "Node ", node->get_friendly_name(), " has no ", key, " runtime info");
+        return it->second.as<std::string>();
+    }
+
+    static std::string getLayerType(const std::shared_ptr<ov::Node>& node) {
+        return getRtString(node, "layerType");
+    }
+
+    // checks that all outputs of the nodes with the given type have the expected layout
+    void checkOutputLayouts(const std::string& layerType, const std::string& expected, size_t expectedNodes) const {
+        size_t nodes = 0;
+        for (const auto& node : compiledModel.get_runtime_model()->get_ops()) {
+            if (getLayerType(node) != layerType)
+                continue;
+            nodes++;
+            std::stringstream layouts(getRtString(node, "outputLayouts"));
+            std::string layout;
+            while (std::getline(layouts, layout, ','))
+                EXPECT_EQ(layout, expected) << "Unexpected layout of " << node->get_friendly_name();
+        }
+        EXPECT_EQ(nodes, expectedNodes) << "Unexpected number of " << layerType << " nodes";
+    }
+};
+
+/*
+ *            Parameter
+ *                |
+ *               Relu
+ *              /    \
+ *    Convolution    Convolution
+ *             |      |
+ *         Result    Result
+ *
+ * The greedy selection makes the Relu planar as its input, so each Convolution which prefers a blocked
+ * or channels-last layout gets its own reorder. The planning moves the Relu to the Convolution layout, which
+ * leaves a single reorder on the graph input.
+ */
+TEST_F(LayoutPlanningTest, smoke_LayoutPlanning_RemovesConsumerReorders_CPU) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+
+    init_input_shapes(static_shapes_to_test_representation(std::vector<ov::Shape>{{1, 32, 16, 16}}));
+    auto params = ngraph::builder::makeDynamicParams(ov::element::f32, inputDynamicShapes);
+    auto relu = std::make_shared<ov::opset10::Relu>(params[0]);
+    ov::ResultVector results{std::make_shared<ov::opset10::Result>(makeConv(relu, 32)),
+                             std::make_shared<ov::opset10::Result>(makeConv(relu, 32))};
+    function = std::make_shared<ov::Model>(results, params, "LayoutPlanning");
+
+    run();
+
+    size_t convolutions = 0;
+    size_t reorders = 0;
+    for (const auto& node : compiledModel.get_runtime_model()->get_ops()) {
+        if (getLayerType(node) == "Reorder")
+            reorders++;
+        if (getLayerType(node) != "Convolution")
+            continue;
+        convolutions++;
+        EXPECT_NE(getLayerType(node->get_input_node_shared_ptr(0)), "Reorder")
+            << "Reorder is not removed before " << node->get_friendly_name();
+    }
+    EXPECT_EQ(convolutions, 2u);
+    // one reorder on the input and one per output, the greedy selection leaves four: two per convolution
+    EXPECT_LE(reorders, 3u);
+}
+
+/*
+ *   Parameter  Parameter          Parameter
+ *          \    /                     |
+ *          Concat                   Split
+ *          /    \                  /     \
+ * Convolution  Convolution  Convolution  Convolution
+ *
+ * Moving the reorders above the Concat and the Split would be cheaper, but the nodes with specific
+ * selection logic keep the layout selected by the greedy pass.
+ */
+TEST_F(LayoutPlanningTest, smoke_LayoutPlanning_KeepsConcatSplitLayouts_CPU) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+
+    init_input_shapes(static_shapes_to_test_representation(
+        std::vector<ov::Shape>{{1, 16, 16, 16}, {1, 16, 16, 16}, {1, 32, 16, 16}}));
+    auto params = ngraph::builder::makeDynamicParams(ov::element::f32, inputDynamicShapes);
+    auto concat = std::make_shared<ov::opset10::Concat>(ov::OutputVector{params[0], params[1]}, 1);
+    auto split = ngraph::builder::makeSplit(params[2], ov::element::f32, 2, 1);
+    ov::ResultVector results{std::make_shared<ov::opset10::Result>(makeConv(concat, 32)),
+                             std::make_shared<ov::opset10::Result>(makeConv(concat, 32)),
+                             std::make_shared<ov::opset10::Result>(makeConv(split->output(0), 16)),
+                             std::make_shared<ov::opset10::Result>(makeConv(split->output(1), 16))};
+    function = std::make_shared<ov::Model>(results, params, "LayoutPlanningConcatSplit");
+
+    run();
+
+    checkOutputLayouts("Input", "abcd", 3);
+    checkOutputLayouts("Concatenation", "abcd", 1);
+    checkOutputLayouts("Split", "abcd", 1);
+}
+
+/*
+ *   Parameter
+ *       |
+ *   ReadValue
+ *       |
+ *  Convolution
+ *     /    \
+ *  Assign  Result
+ */
+TEST_F(LayoutPlanningTest, smoke_LayoutPlanning_KeepsMemoryLayouts_CPU) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+
+    init_input_shapes(static_shapes_to_test_representation(std::vector<ov::Shape>{{1, 32, 16, 16}}));
+    auto params = ngraph::builder::makeDynamicParams(ov::element::f32, inputDynamicShapes);
+    auto variable = std::make_shared<ov::op::util::Variable>(
+        ov::op::util::VariableInfo{inputDynamicShapes[0], ov::element::f32, "state"});
+    auto readValue = std::make_shared<ov::opset10::ReadValue>(params[0], variable);
+    auto conv = makeConv(readValue, 32);
+    auto assign = std::make_shared<ov::opset10::Assign>(conv, variable);
+    function = std::make_shared<ov::Model>(ov::ResultVector{std::make_shared<ov::opset10::Result>(conv)},
+                                           ov::SinkVector{assign}, params, "LayoutPlanningMemory");
+
+    compile_model();
+    auto inferRequest = compiledModel.create_infer_request();
+    for (size_t i = 0; i < 2; i++)
+        inferRequest.infer();
+
+    checkOutputLayouts("Input", "abcd", 1);
+    checkOutputLayouts("MemoryInput", "abcd", 1);
+}
+
+}  // namespace SubgraphTestsDefinitions
@@ -0,0 +1,120 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <ngraph_functions/builders.hpp>
+#include "ie_common.h"
+#include "ie_system_conf.h"
+#include "openvino/runtime/properties.hpp"
+#include "ngraph_functions/utils/ngraph_helpers.hpp"
+#include "test_utils/cpu_test_utils.hpp"
+
+using namespace InferenceEngine;
+using namespace CPUTestUtils;
+
+namespace CPULayerTestsDefinitions {
+
+// the node between the MVNs, which loads and stores FP16, and the threshold of its comparison with FP32
+using FP16StorageTestParams = std::tuple<std::string, float>;
+
+class MvnEltwiseFP16Storage : public testing::WithParamInterface<FP16StorageTestParams>,
+                              virtual public LayerTestsUtils::LayerTestsCommon,
+                              public CPUTestsBase {
+public:
+    static std::string getTestCaseName(const testing::TestParamInfo<FP16StorageTestParams>& obj) {
+        std::string node;
+        float threshold;
+        std::tie(node, threshold) = obj.param;
+        return "node=" + node;
+    }
+
+protected:
+    void SetUp() override {
+        auto netPrecision = inPrc = outPrc = Precision::FP32;
+        targetDevice = CommonTestUtils::DEVICE_CPU;
+        configuration.insert({ov::hint::inference_precision.name(), "f16"});
+        // the activations between the nodes are rounded to FP16, the reference is computed in FP32
+        std::tie(node, threshold) = GetParam();
+
+        std::vector<size_t> inputShape {1, 16, 8, 8};
+        auto ngPrc = FuncTestUtils::PrecisionUtils::convertIE2nGraphPrc(netPrecision);
+        auto input = ngraph::builder::makeParams(ngPrc, {inputShape});
+        auto mvn1 = ngraph::builder::makeMVN(input[0], false, true, 1e-9);
+
+        std::shared_ptr<ngraph::Node> middle;
+        if (node == "Multiply") {
+            auto scale = ngraph::builder::makeConstant<float>(ngPrc, {1, 16, 1, 1}, {}, true);
+            middle = ngraph::builder::makeEltwise(mvn1, scale, ngraph::helpers::EltwiseTypes::MULTIPLY);
+        } else if (node == "Add") {
+            auto shift = ngraph::builder::makeConstant<float>(ngPrc, {1, 16, 1, 1}, {}, true);
+            middle = ngraph::builder::makeEltwise(mvn1, shift, ngraph::helpers::EltwiseTypes::ADD);
+        } else if (node == "Sigmoid") {
+            middle = ngraph::builder::makeActivation(mvn1, ngPrc, ngraph::helpers::ActivationTypes::Sigmoid);
+        } else if (node == "Concat") {
+            auto mvn = ngraph::builder::makeMVN(input[0], true, true, 1e-9);
+            middle = ngraph::builder::makeConcat({mvn1, mvn}, 1);
+        } else if (node == "Transpose") {
+            auto order = ngraph::builder::makeConstant<int64_t>(ngraph::element::i64, {4}, {0, 1, 3, 2});
+            middle = std::make_shared<ngraph::opset1::Transpose>(mvn1, order);
+        } else if (node == "Reshape") {
+            auto shape = ngraph::builder::makeConstant<int64_t>(ngraph::element::i64, {4}, {1, 16, 4, 16});
+            middle = std::make_shared<ngraph::opset1::Reshape>(mvn1, shape, false);
+        } else if (node == "Convert") {
+            // the values are truncated to the integers, so the FP16 rounding may move them by one
+            auto scale = ngraph::builder::makeConstant<float>(ngPrc, {1}, {16.f});
+            auto multiply = ngraph::builder::makeEltwise(mvn1, scale, ngraph::helpers::EltwiseTypes::MULTIPLY);
+            auto toInt = std::make_shared<ngraph::opset1::Convert>(multiply, ngraph::element::i32);
+            middle = std::make_shared<ngraph::opset1::Convert>(toInt, ngPrc);
+        } else {
+            FAIL() << "Unexpected node " << node;
+        }
+        auto mvn2 = ngraph::builder::makeMVN(middle, false, true, 1e-9);
+
+        function = makeNgraphFunction(ngPrc, input, mvn2, "MvnEltwiseMvn");
+    }
+
+    std::string node;
+};
+
+/* FP32 network with FP16 activation storage.
+ * The edges around the node between the MVN nodes are stored in FP16, the nodes convert the values in registers,
+ * so no Reorder (or Convert) is inserted. The outputs are compared with the FP32 reference.
+
+    Input[FP32]
+         |
+    MVN[FP32->FP16]
+         |
+    Node[FP16->FP16]
+         |
+    MVN[FP16->FP32]
+         |
+    Output[FP32]
+*/
+TEST_P(MvnEltwiseFP16Storage, CompareWithRefs) {
+    if (!InferenceEngine::with_cpu_x86_avx2())
+        GTEST_SKIP();
+
+    Run();
+
+    CheckNumberOfNodesWithType(executableNetwork, "Reorder", 0);
+    CheckNumberOfNodesWithType(executableNetwork, "Convert", node == "Convert" ? 2 : 0);
+}
+
+namespace {
+
+const std::vector<FP16StorageTestParams> fp16StorageParams = {
+    {"Multiply", 0.01f},
+    {"Add", 0.01f},
+    {"Sigmoid", 0.01f},
+    {"Concat", 0.01f},
+    {"Transpose", 0.01f},
+    {"Reshape", 0.01f},
+    {"Convert", 0.1f},
+};
+
+INSTANTIATE_TEST_SUITE_P(smoke_FP16Storage, MvnEltwiseFP16Storage,
+                         ::testing::ValuesIn(fp16StorageParams),
+                         MvnEltwiseFP16Storage::getTestCaseName);
+
+}  // namespace
+} // namespace CPULayerTestsDefinitions
@@ -0,0 +1,186 @@
+// Copyright (C) 2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <openvino/opsets/opset11.hpp>
+#include "ngraph_functions/builders.hpp"
+#include "shared_test_classes/base/ov_subgraph.hpp"
+#include <common_test_utils/ov_tensor_utils.hpp>
+#include "test_utils/cpu_test_utils.hpp"
+
+using namespace ov::test;
+using namespace ngraph;
+using namespace CPUTestUtils;
+
+namespace SubgraphTestsDefinitions {
+// image precision, I420 or NV12, planes number, output size (empty - no resize), nearest resize, pooled output
+using YUVPreprocessFusionParams = std::tuple<ElementType, bool, size_t, std::vector<int64_t>, bool, bool>;
+
+/*  Y, UV / Y, U, V / YUV
+            |
+    NV12toBGR / I420toRGB
+            |
+        [Convert]
+            |
+      [Interpolate]
+            |
+        Subtract   <- per channel mean
+            |
+         Divide    <- per channel std
+            |
+        Transpose  <- NHWC -> NCHW
+            |
+        [MaxPool]  <- takes the blocked nChw8c / nChw16c output
+            |
+          Result
+*/
+class YUVPreprocessFusionCPUTest : public testing::WithParamInterface<YUVPreprocessFusionParams>,
+                                   virtual public SubgraphBaseTest,
+                                   public CPUTestsBase {
+public:
+    static std::string getTestCaseName(const testing::TestParamInfo<YUVPreprocessFusionParams>& obj) {
+        ElementType imageType;
+        bool isI420;
+        size_t planesNum;
+        std::vector<int64_t> outSize;
+        bool nearest;
+        bool pooled;
+        std::tie(imageType, isI420, planesNum, outSize, nearest, pooled) = obj.param;
+        std::ostringstream result;
+        result << "ImagePrc=" << imageType << "_";
+        result << (isI420 ? "I420" : "NV12") << "_";
+        result << "Planes=" << planesNum << "_";
+        result << "OutSize=" << CommonTestUtils::vec2str(outSize) << "_";
+        result << "Nearest=" << nearest << "_";
+        result << "Pooled=" << pooled;
+        return result.str();
+    }
+
+protected:
+    void SetUp() override {
+        ElementType imageType;
+        bool isI420;
+        size_t planesNum;
+        std::vector<int64_t> outSize;
+        bool nearest;
+        bool pooled;
+        std::tie(imageType, isI420, planesNum, outSize, nearest, pooled) = this->GetParam();
+        targetDevice = CommonTestUtils::DEVICE_CPU;
+
+        // the width is not a multiple of the vector length, so the tails are processed as well
+        const size_t height = 64, width = 70;
+        std::vector<ov::Shape> planeShapes;
+        if (planesNum == 1) {
+            planeShapes = {{1, height * 3 / 2, width, 1}};
+        } else if (isI420) {
+            planeShapes = {{1, height, width, 1}, {1, height / 2, width / 2, 1}, {1, height / 2, width / 2, 1}};
+        } else {
+            planeShapes = {{1, height, width, 1}, {1, height / 2, width / 2, 2}};
+        }
+        std::vector<InputShape> inputShapes;
+        for (const auto& shape : planeShapes)
+            inputShapes.push_back(InputShape{{}, {shape}});
+        init_input_shapes(inputShapes);
+        auto params = builder::makeDynamicParams(imageType, inputDynamicShapes);
+        auto planes = helpers::convert2OutputVector(helpers::castOps2Nodes<op::Parameter>(params));
+
+        std::shared_ptr<ov::Node> image;
+        if (isI420) {
+            image = planesNum == 1 ? std::make_shared<ov::opset11::I420toRGB>(planes[0])
+                                   : std::make_shared<ov::opset11::I420toRGB>(planes[0], planes[1], planes[2]);
+        } else {
+            image = planesNum == 1 ? std::make_shared<ov::opset11::NV12toBGR>(planes[0])
+                                   : std::make_shared<ov::opset11::NV12toBGR>(planes[0], planes[1]);
+        }
+        if (imageType != ElementType::f32)
+            image = std::make_shared<ov::opset11::Convert>(image, ElementType::f32);
+
+        if (!outSize.empty()) {
+            ov::opset11::Interpolate::InterpolateAttrs attrs;
+            attrs.mode = nearest ? ov::opset11::Interpolate::InterpolateMode::NEAREST
+                                 : ov::opset11::Interpolate::InterpolateMode::LINEAR;
+            attrs.shape_calculation_mode = ov::opset11::Interpolate::ShapeCalcMode::SIZES;
+            attrs.coordinate_transformation_mode = ov::opset11::Interpolate::CoordinateTransformMode::HALF_PIXEL;
+            attrs.nearest_mode = ov::opset11::Interpolate::NearestMode::ROUND_PREFER_FLOOR;
+            auto sizes = ov::opset11::Constant::create(ElementType::i64, {2}, outSize);
+            auto axes = ov::opset11::Constant::create(ElementType::i64, {2}, {1, 2});
+            image = std::make_shared<ov::opset11::Interpolate>(image, sizes, axes, attrs);
+        }
+
+        auto mean = ov::opset11::Constant::create(ElementType::f32, {1, 1, 1, 3}, {123.7f, 116.3f, 103.5f});
+        auto stdDev = ov::opset11::Constant::create(ElementType::f32, {1, 1, 1, 3}, {58.4f, 57.1f, 57.4f});
+        image = std::make_shared<ov::opset11::Subtract>(image, mean);
+        image = std::make_shared<ov::opset11::Divide>(image, stdDev);
+        auto order = ov::opset11::Constant::create(ElementType::i64, {4}, {0, 3, 1, 2});
+        image = std::make_shared<ov::opset11::Transpose>(image, order);
+        if (pooled) {
+            image = std::make_shared<ov::opset11::MaxPool>(image,
+                                                           ov::Strides{2, 2},
+                                                           ov::Strides{1, 1},
+                                                           ov::Shape{0, 0},
+                                                           ov::Shape{0, 0},
+                                                           ov::Shape{2, 2});
+        }
+        function = makeNgraphFunction(ElementType::f32, params, image, "YUVPreprocessFusion");
+
+        // the colors of the U8 image may be rounded differently, which is at most 1 / 57 after the normalization
+        abs_threshold = 0.02f;
+    }
+
+    void generate_inputs(const std::vector<ov::Shape>& targetInputStaticShapes) override {
+        inputs.clear();
+        const auto& funcInputs = function->inputs();
+        for (size_t i = 0; i < funcInputs.size(); i++) {
+            auto tensor = ov::test::utils::create_and_fill_tensor(funcInputs[i].get_element_type(), targetInputStaticShapes[i], 255, 0);
+            inputs.insert({funcInputs[i].get_node_shared_ptr(), tensor});
+        }
+    }
+};
+
+TEST_P(YUVPreprocessFusionCPUTest, CompareWithRefs) {
+    run();
+    // the whole chain is executed by the single node
+    CheckNumberOfNodesWithTypes(compiledModel, {"YUVPreprocess"}, 1);
+    CheckNumberOfNodesWithTypes(compiledModel, {"ColorConvert", "Interpolate", "Transpose", "Eltwise"}, 0);
+}
+
+namespace {
+const std::vector<std::vector<int64_t>> outSizes = {
+    {},
+    // downscale
+    {48, 37},
+    // upscale
+    {80, 100},
+};
+
+INSTANTIATE_TEST_SUITE_P(smoke_YUVPreprocessFusion_NV12,
+                         YUVPreprocessFusionCPUTest,
+                         ::testing::Combine(::testing::Values(ElementType::u8, ElementType::f32),
+                                            ::testing::Values(false),
+                                            ::testing::Values(1, 2),
+                                            ::testing::ValuesIn(outSizes),
+                                            ::testing::Bool(),
+                                            ::testing::Values(false)),
+                         YUVPreprocessFusionCPUTest::getTestCaseName);
+
+INSTANTIATE_TEST_SUITE_P(smoke_YUVPreprocessFusion_I420,
+                         YUVPreprocessFusionCPUTest,
+                         ::testing::Combine(::testing::Values(ElementType::u8, ElementType::f32),
+                                            ::testing::Values(true),
+                                            ::testing::Values(1, 3),
+                                            ::testing::ValuesIn(outSizes),
+                                            ::testing::Bool(),
+                                            ::testing::Values(false)),
+                         YUVPreprocessFusionCPUTest::getTestCaseName);
+
+INSTANTIATE_TEST_SUITE_P(smoke_YUVPreprocessFusion_Pooled,
+                         YUVPreprocessFusionCPUTest,
+                         ::testing::Combine(::testing::Values(ElementType::u8),
+                                            ::testing::Bool(),
+                                            ::testing::Values(1),
+                                            ::testing::ValuesIn(outSizes),
+                                            ::testing::Values(false),
+                                            ::testing::Values(true)),
+                         YUVPreprocessFusionCPUTest::getTestCaseName);
+}  // namespace
+}  // namespace SubgraphTestsDefinitions
@@ -0,0 +1,158 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <stdexcept>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "continuous_batching.h"
+
+using namespace ov::intel_cpu;
+
+namespace {
+// keeps the submitted steps until the test runs them
+struct ManualExecutor : public InferenceEngine::ITaskExecutor {
+    void run(InferenceEngine::Task task) override {
+        tasks.push_back(std::move(task));
+    }
+    void runNext() {
+        ASSERT_FALSE(tasks.empty());
+        auto task = std::move(tasks.front());
+        tasks.erase(tasks.begin());
+        task();
+    }
+    std::vector<InferenceEngine::Task> tasks;
+};
+
+struct ExecutedStep {
+    std::vector<InferRequestBase*> sequences;
+    size_t slot;
+};
+
+// the scheduler doesn't dereference the requests, so any distinct addresses identify the sequences
+int sequenceIds[8];
+InferRequestBase* sequence(int id) {
+    return reinterpret_cast<InferRequestBase*>(&sequenceIds[id]);
+}
+
+ContinuousBatching::Completion countCompletion(int& completed, int& failed) {
+    return [&completed, &failed](std::exception_ptr exception) {
+        completed++;
+        if (exception)
+            failed++;
+    };
+}
+} // namespace
+
+TEST(ContinuousBatchingTests, StepStartsWithoutWaitingForBatch) {
+    auto executor = std::make_shared<ManualExecutor>();
+    std::vector<ExecutedStep> steps;
+    ContinuousBatching batching(4, 1, executor, [&](const std::vector<InferRequestBase*>& sequences, size_t slot, std::vector<std::exception_ptr>&) {
+        steps.push_back({sequences, slot});
+    });
+    int completed = 0, failed = 0;
+    batching.enqueue(sequence(0), countCompletion(completed, failed));
+    ASSERT_EQ(executor->tasks.size(), 1u);
+    executor->runNext();
+    ASSERT_EQ(steps.size(), 1u);
+    ASSERT_EQ(steps[0].sequences, std::vector<InferRequestBase*>({sequence(0)}));
+    ASSERT_EQ(completed, 1);
+    ASSERT_EQ(failed, 0);
+    ASSERT_TRUE(executor->tasks.empty());
+}
+
+TEST(ContinuousBatchingTests, SequencesArrivingDuringStepAreBatched) {
+    auto executor = std::make_shared<ManualExecutor>();
+    std::vector<ExecutedStep> steps;
+    ContinuousBatching batching(3, 1, executor, [&](const std::vector<InferRequestBase*>& sequences, size_t slot, std::vector<std::exception_ptr>&) {
+        steps.push_back({sequences, slot});
+    });
+    int completed = 0, failed = 0;
+    for (int i = 0; i < 5; i++)
+        batching.enqueue(sequence(i), countCompletion(completed, failed));
+    // the only slot is busy with the first sequence, the rest are queued
+    ASSERT_EQ(executor->tasks.size(), 1u);
+    executor->runNext();
+    ASSERT_EQ(completed, 1);
+    // the next step takes the queued sequences up to the batch
+    ASSERT_EQ(executor->tasks.size(), 1u);
+    executor->runNext();
+    ASSERT_EQ(steps[1].sequences, std::vector<InferRequestBase*>({sequence(1), sequence(2), sequence(3)}));
+    ASSERT_EQ(completed, 4);
+    executor->runNext();
+    ASSERT_EQ(steps[2].sequences, std::vector<InferRequestBase*>({sequence(4)}));
+    ASSERT_EQ(completed, 5);
+    ASSERT_TRUE(executor->tasks.empty());
+
+    const auto stats = batching.getStats();
+    ASSERT_EQ(stats.steps, 3u);
+    ASSERT_EQ(stats.sequences, 5u);
+    ASSERT_EQ(stats.batchedSteps, 1u);
+    ASSERT_EQ(stats.maxSequencesPerStep, 3u);
+    ASSERT_EQ(stats.toJson(), "{\"steps\":3,\"sequences\":5,\"batched_steps\":1,\"max_sequences_per_step\":3}");
+}
+
+TEST(ContinuousBatchingTests, StepsUseFreeSlots) {
+    auto executor = std::make_shared<ManualExecutor>();
+    std::vector<ExecutedStep> steps;
+    ContinuousBatching batching(2, 2, executor, [&](const std::vector<InferRequestBase*>& sequences, size_t slot, std::vector<std::exception_ptr>&) {
+        steps.push_back({sequences, slot});
+    });
+    int completed = 0, failed = 0;
+    for (int i = 0; i < 4; i++)
+        batching.enqueue(sequence(i), countCompletion(completed, failed));
+    ASSERT_EQ(executor->tasks.size(), 2u);
+    executor->runNext();
+    executor->runNext();
+    ASSERT_EQ(steps[0].slot, 0u);
+    ASSERT_EQ(steps[1].slot, 1u);
+    // the slot freed by the first step takes the queued sequences
+    executor->runNext();
+    ASSERT_EQ(steps[2].slot, 0u);
+    ASSERT_EQ(steps[2].sequences, std::vector<InferRequestBase*>({sequence(2), sequence(3)}));
+    ASSERT_EQ(completed, 4);
+}
+
+TEST(ContinuousBatchingTests, FailedStepCompletesAllItsSequences) {
+    auto executor = std::make_shared<ManualExecutor>();
+    bool fail = true;
+    ContinuousBatching batching(2, 1, executor,
+                                [&](const std::vector<InferRequestBase*>&, size_t, std::vector<std::exception_ptr>&) {
+                                    if (fail)
+                                        throw std::runtime_error("step failed");
+                                });
+    int completed = 0, failed = 0;
+    for (int i = 0; i < 3; i++)
+        batching.enqueue(sequence(i), countCompletion(completed, failed));
+    executor->runNext();
+    executor->runNext();
+    ASSERT_EQ(completed, 3);
+    ASSERT_EQ(failed, 3);
+    // the failure doesn't stop the batching
+    fail = false;
+    batching.enqueue(sequence(3), countCompletion(completed, failed));
+    executor->runNext();
+    ASSERT_EQ(completed, 4);
+    ASSERT_EQ(failed, 3);
+}
+
+TEST(ContinuousBatchingTests, FailedSequenceDoesNotFailStep) {
+    auto executor = std::make_shared<ManualExecutor>();
+    ContinuousBatching batching(
+        2, 1, executor,
+        [&](const std::vector<InferRequestBase*>& sequences, size_t, std::vector<std::exception_ptr>& exceptions) {
+            for (size_t i = 0; i < sequences.size(); i++) {
+                if (sequences[i] == sequence(2))
+                    exceptions[i] = std::make_exception_ptr(std::runtime_error("sequence failed"));
+            }
+        });
+    int completed = 0, failed = 0;
+    for (int i = 0; i < 3; i++)
+        batching.enqueue(sequence(i), countCompletion(completed, failed));
+    executor->runNext();
+    executor->runNext();
+    ASSERT_EQ(completed, 3);
+    ASSERT_EQ(failed, 1);
+}
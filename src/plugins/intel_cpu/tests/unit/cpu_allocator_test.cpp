@@ -0,0 +1,62 @@
+// Copyright (C) 2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include <cstring>
+
+#include "cpu_allocator.h"
+
+using namespace ov::intel_cpu;
+
+namespace {
+
+constexpr size_t bigSize = 3 * CpuAllocator::hugePageSize + 1;
+
+TEST(CpuAllocatorTest, PolicyIsRestoredAfterScope) {
+    AllocationStats stats;
+    {
+        CpuAllocator::PolicyScope scope({HugePages::TRANSPARENT_HUGE_PAGES, -1, false, &stats});
+        EXPECT_EQ(CpuAllocator::currentPolicy().hugePages, HugePages::TRANSPARENT_HUGE_PAGES);
+        EXPECT_EQ(CpuAllocator::currentPolicy().stats, &stats);
+    }
+    EXPECT_EQ(CpuAllocator::currentPolicy().hugePages, HugePages::DISABLED);
+    EXPECT_EQ(CpuAllocator::currentPolicy().stats, nullptr);
+}
+
+TEST(CpuAllocatorTest, SmallBuffersIgnorePolicy) {
+    AllocationStats stats;
+    CpuAllocator::PolicyScope scope({HugePages::TRANSPARENT_HUGE_PAGES, -1, true, &stats});
+    void* ptr = CpuAllocator::allocate(1024, 64);
+    ASSERT_NE(ptr, nullptr);
+    EXPECT_EQ(reinterpret_cast<uintptr_t>(ptr) % 64, 0);
+    CpuAllocator::free(ptr);
+    EXPECT_EQ(stats.allocations, 1);
+    EXPECT_EQ(stats.allocatedBytes, 1024);
+    EXPECT_EQ(stats.hugePageBytes, 0);
+    EXPECT_EQ(stats.prefaultedBytes, 0);
+}
+
+TEST(CpuAllocatorTest, BigBuffersArePrefaultedAndUsable) {
+    for (const auto hugePages :
+         {HugePages::DISABLED, HugePages::TRANSPARENT_HUGE_PAGES, HugePages::EXPLICIT_HUGE_PAGES}) {
+        AllocationStats stats;
+        void* ptr = CpuAllocator::allocate(bigSize, 64, {hugePages, -1, true, &stats});
+        ASSERT_NE(ptr, nullptr);
+        std::memset(ptr, 1, bigSize);
+        if (hugePages != HugePages::DISABLED) {
+            EXPECT_EQ(reinterpret_cast<uintptr_t>(ptr) % CpuAllocator::hugePageSize, 0);
+        }
+        CpuAllocator::free(ptr);
+        EXPECT_EQ(stats.allocations, 1);
+        EXPECT_GE(stats.allocatedBytes, bigSize);
+        EXPECT_GE(stats.prefaultedBytes, bigSize);
+        if (hugePages == HugePages::EXPLICIT_HUGE_PAGES) {
+            // the reserved pages are either used or the transparent ones are advised instead
+            EXPECT_TRUE(stats.explicitHugePageBytes >= bigSize || stats.hugePageFallbacks == 1);
+        }
+    }
+}
+
+}  // namespace
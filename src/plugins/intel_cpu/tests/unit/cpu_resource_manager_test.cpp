@@ -0,0 +1,182 @@
+// Copyright (C) 2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <chrono>
+#include <thread>
+
+#include "cpu_resource_manager.hpp"
+
+using namespace ov::intel_cpu;
+
+namespace {
+
+using Cores = CpuResourceManager::Cores;
+using Client = CpuResourceManager::Client;
+
+// waits until the thread is blocked in acquire()
+void waitForBlocked(const std::atomic<bool>& granted) {
+    std::this_thread::sleep_for(std::chrono::milliseconds(50));
+    ASSERT_FALSE(granted);
+}
+
+TEST(CpuResourceManagerTest, DisjointCoresAreGrantedAtOnce) {
+    CpuResourceManager manager(8, 8);
+    Client first(ov::hint::Priority::MEDIUM, true), second(ov::hint::Priority::MEDIUM, true);
+    const Cores firstCores{{0, 1, 2, 3}, 4}, secondCores{{4, 5, 6, 7}, 4};
+    auto firstLease = manager.acquire(first, firstCores);
+    auto secondLease = manager.acquire(second, secondCores);
+    EXPECT_NE(first.usageReport(manager.capacity()).find("\"waited_inferences\":0,"), std::string::npos);
+    EXPECT_NE(second.usageReport(manager.capacity()).find("\"waited_inferences\":0,"), std::string::npos);
+}
+
+TEST(CpuResourceManagerTest, BusyCoresAreLentAfterRelease) {
+    CpuResourceManager manager(4, 4);
+    Client owner(ov::hint::Priority::MEDIUM, true), borrower(ov::hint::Priority::MEDIUM, true);
+    const Cores cores{{0, 1}, 2};
+    std::atomic<bool> granted{false};
+    std::thread thread;
+    {
+        auto lease = manager.acquire(owner, cores);
+        thread = std::thread([&] {
+            auto borrowed = manager.acquire(borrower, cores);
+            granted = true;
+        });
+        waitForBlocked(granted);
+    }
+    thread.join();
+    EXPECT_TRUE(granted);
+    EXPECT_NE(borrower.usageReport(manager.capacity()).find("\"waited_inferences\":1,"), std::string::npos);
+}
+
+TEST(CpuResourceManagerTest, UnpinnedStreamsAreLimitedByCapacity) {
+    CpuResourceManager manager(0, 4);
+    Client client(ov::hint::Priority::MEDIUM, true);
+    const Cores cores{{}, 3};
+    std::atomic<bool> granted{false};
+    std::thread thread;
+    {
+        auto lease = manager.acquire(client, cores);
+        thread = std::thread([&] {
+            auto second = manager.acquire(client, cores);
+            granted = true;
+        });
+        waitForBlocked(granted);
+    }
+    thread.join();
+    EXPECT_TRUE(granted);
+}
+
+TEST(CpuResourceManagerTest, ModelsWithoutPriorityAreNotArbitrated) {
+    CpuResourceManager manager(4, 4);
+    Client first(ov::hint::Priority::MEDIUM, false), second(ov::hint::Priority::MEDIUM, false);
+    // e.g. two latency models, which run on all the cores
+    const Cores cores{{0, 1, 2, 3}, 4};
+    auto firstLease = manager.acquire(first, cores);
+    auto secondLease = manager.acquire(second, cores);
+    auto thirdLease = manager.acquire(second, cores);
+    EXPECT_NE(first.usageReport(manager.capacity()).find("\"waited_inferences\":0,"), std::string::npos);
+    EXPECT_NE(second.usageReport(manager.capacity()).find("\"waited_inferences\":0,"), std::string::npos);
+}
+
+TEST(CpuResourceManagerTest, ModelWithoutPriorityDoesNotWaitForPrioritizedOne) {
+    CpuResourceManager manager(4, 4);
+    Client prioritized(ov::hint::Priority::HIGH, true), other(ov::hint::Priority::MEDIUM, false);
+    const Cores cores{{0, 1, 2, 3}, 4};
+    auto prioritizedLease = manager.acquire(prioritized, cores);
+    auto otherLease = manager.acquire(other, cores);
+    EXPECT_NE(other.usageReport(manager.capacity()).find("\"waited_inferences\":0,"), std::string::npos);
+    // the inferences of the model without the priority don't hold the cores
+    std::atomic<bool> granted{false};
+    std::thread thread([&] {
+        auto lease = manager.acquire(prioritized, cores);
+        granted = true;
+    });
+    waitForBlocked(granted);
+    prioritizedLease = CpuResourceManager::Lease();
+    thread.join();
+    EXPECT_TRUE(granted);
+}
+
+TEST(CpuResourceManagerTest, SinglePrioritizedModelIsArbitrated) {
+    CpuResourceManager manager(0, 4);
+    Client client(ov::hint::Priority::HIGH, true);
+    const Cores cores{{}, 3};
+    std::atomic<bool> granted{false};
+    std::thread thread;
+    {
+        auto lease = manager.acquire(client, cores);
+        thread = std::thread([&] {
+            auto second = manager.acquire(client, cores);
+            granted = true;
+        });
+        waitForBlocked(granted);
+    }
+    thread.join();
+    EXPECT_TRUE(granted);
+}
+
+TEST(CpuResourceManagerTest, OversizedRequestIsGrantedOnIdleCpu) {
+    CpuResourceManager manager(0, 4);
+    Client client(ov::hint::Priority::MEDIUM, true);
+    const Cores cores{{}, 16};
+    auto lease = manager.acquire(client, cores);
+    EXPECT_NE(client.usageReport(manager.capacity()).find("\"inferences\":1,"), std::string::npos);
+}
+
+TEST(CpuResourceManagerTest, HighPriorityPreemptsLowPriority) {
+    CpuResourceManager manager(4, 4);
+    Client high(ov::hint::Priority::HIGH, true), low(ov::hint::Priority::LOW, true);
+    const Cores cores{{0, 1, 2, 3}, 4};
+    std::atomic<int> order{0};
+    std::atomic<int> highOrder{-1}, lowOrder{-1};
+    std::atomic<bool> highGranted{false}, lowGranted{false};
+    std::thread highThread, lowThread;
+    {
+        auto lease = manager.acquire(low, cores);
+        highThread = std::thread([&] {
+            auto highLease = manager.acquire(high, cores);
+            highGranted = true;
+            highOrder = order++;
+            std::this_thread::sleep_for(std::chrono::milliseconds(10));
+        });
+        waitForBlocked(highGranted);
+        // the next inference of the low priority model waits for the high priority one
+        lowThread = std::thread([&] {
+            auto lowLease = manager.acquire(low, cores);
+            lowGranted = true;
+            lowOrder = order++;
+        });
+        waitForBlocked(lowGranted);
+    }
+    highThread.join();
+    lowThread.join();
+    EXPECT_EQ(highOrder, 0);
+    EXPECT_EQ(lowOrder, 1);
+}
+
+TEST(CpuResourceManagerTest, HighPriorityDoesNotBlockDisjointCores) {
+    CpuResourceManager manager(8, 8);
+    Client high(ov::hint::Priority::HIGH, true), low(ov::hint::Priority::LOW, true);
+    const Cores busyCores{{0, 1, 2, 3}, 4}, freeCores{{4, 5, 6, 7}, 4};
+    std::atomic<bool> highGranted{false};
+    std::thread highThread;
+    {
+        auto lease = manager.acquire(low, busyCores);
+        highThread = std::thread([&] {
+            auto highLease = manager.acquire(high, busyCores);
+            highGranted = true;
+        });
+        waitForBlocked(highGranted);
+        // the idle cores are still lent to the low priority model
+        auto freeLease = manager.acquire(low, freeCores);
+        EXPECT_NE(low.usageReport(manager.capacity()).find("\"waited_inferences\":0,"), std::string::npos);
+    }
+    highThread.join();
+    EXPECT_TRUE(highGranted);
+}
+
+}  // namespace
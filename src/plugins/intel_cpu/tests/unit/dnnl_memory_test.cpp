@@ -80,3 +80,33 @@ TEST(MemoryTest, ConcurrentResizeGetPrimitive) {
         ASSERT_EQ(dnnl_mem.get_data_handle(), cpu_mem2.GetData());
     }
 }
+
+TEST(MemoryTest, ArenaRegionsAreStableOnResize) {
+    auto arena = std::make_shared<MemoryArena>(1024);
+    MemoryMngrInArena first(arena, 0, 512);
+    MemoryMngrInArena second(arena, 512, 512);
+
+    ASSERT_EQ(first.getRawPtr(), nullptr);
+    ASSERT_TRUE(first.resize(128));
+    ASSERT_TRUE(second.resize(256));
+    auto* firstPtr = static_cast<uint8_t*>(first.getRawPtr());
+    ASSERT_NE(firstPtr, nullptr);
+    ASSERT_EQ(static_cast<uint8_t*>(second.getRawPtr()), firstPtr + 512);
+
+    // growing within the region keeps the data in place
+    ASSERT_FALSE(first.resize(512));
+    ASSERT_EQ(first.getRawPtr(), firstPtr);
+    ASSERT_FALSE(first.hasExtBuffer());
+}
+
+TEST(MemoryTest, ArenaRegionFallsBackToOwnBuffer) {
+    auto arena = std::make_shared<MemoryArena>(1024);
+    MemoryMngrInArena region(arena, 0, 512);
+
+    ASSERT_TRUE(region.resize(256));
+    auto* regionPtr = region.getRawPtr();
+    // the requested size exceeds the planned upper bound
+    ASSERT_TRUE(region.resize(2048));
+    ASSERT_NE(region.getRawPtr(), regionPtr);
+    ASSERT_FALSE(region.resize(1024));
+}
@@ -0,0 +1,94 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <thread>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "cache/jit_kernel_registry.h"
+
+using namespace ov::intel_cpu;
+
+namespace {
+struct TestKernelParams {
+    int size;
+    bool withTail;
+
+    size_t hash() const {
+        return std::hash<int>()(size) ^ (withTail ? 1 : 0);
+    }
+    bool operator==(const TestKernelParams& rhs) const {
+        return size == rhs.size && withTail == rhs.withTail;
+    }
+};
+
+struct TestKernel {
+    explicit TestKernel(const TestKernelParams& params) : params(params) {}
+    virtual ~TestKernel() = default;
+
+    TestKernelParams params;
+};
+
+std::shared_ptr<TestKernel> buildKernel(const TestKernelParams& params) {
+    return std::make_shared<TestKernel>(params);
+}
+} // namespace
+
+TEST(JitKernelRegistryTests, SharesEqualKernels) {
+    auto& registry = JitKernelRegistry::instance();
+    const auto before = registry.getStats();
+
+    auto first = registry.getOrCreate<TestKernel>(TestKernelParams{16, false}, buildKernel);
+    auto second = registry.getOrCreate<TestKernel>(TestKernelParams{16, false}, buildKernel);
+    auto other = registry.getOrCreate<TestKernel>(TestKernelParams{16, true}, buildKernel);
+    ASSERT_EQ(first, second);
+    ASSERT_NE(first, other);
+    ASSERT_TRUE(other->params.withTail);
+
+    const auto stats = registry.getStats();
+    ASSERT_EQ(stats.hits - before.hits, 1);
+    ASSERT_EQ(stats.misses - before.misses, 2);
+    ASSERT_EQ(stats.kernels - before.kernels, 2);
+}
+
+TEST(JitKernelRegistryTests, KernelIsDestroyedWithLastUser) {
+    auto& registry = JitKernelRegistry::instance();
+    std::weak_ptr<TestKernel> released;
+    {
+        auto kernel = registry.getOrCreate<TestKernel>(TestKernelParams{32, false}, buildKernel);
+        released = kernel;
+    }
+    ASSERT_TRUE(released.expired());
+
+    const auto before = registry.getStats();
+    auto kernel = registry.getOrCreate<TestKernel>(TestKernelParams{32, false}, buildKernel);
+    ASSERT_NE(kernel, nullptr);
+    ASSERT_EQ(registry.getStats().misses - before.misses, 1);
+}
+
+TEST(JitKernelRegistryTests, FailedBuildIsNotRegistered) {
+    auto& registry = JitKernelRegistry::instance();
+    auto noKernel = [](const TestKernelParams&) { return std::shared_ptr<TestKernel>(); };
+    ASSERT_EQ(registry.getOrCreate<TestKernel>(TestKernelParams{64, false}, noKernel), nullptr);
+    ASSERT_NE(registry.getOrCreate<TestKernel>(TestKernelParams{64, false}, buildKernel), nullptr);
+}
+
+TEST(JitKernelRegistryTests, SmokeConcurrentUsers) {
+    auto& registry = JitKernelRegistry::instance();
+    constexpr size_t numThreads = 16;
+    std::vector<std::shared_ptr<TestKernel>> kernels(numThreads);
+    {
+        std::vector<std::thread> threads;
+        for (size_t i = 0; i < numThreads; i++) {
+            threads.emplace_back([&, i] {
+                kernels[i] = registry.getOrCreate<TestKernel>(TestKernelParams{128, true}, buildKernel);
+            });
+        }
+        for (auto& thread : threads)
+            thread.join();
+    }
+    for (const auto& kernel : kernels)
+        ASSERT_EQ(kernel, kernels.front());
+}
@@ -0,0 +1,91 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include <string>
+#include <memory>
+
+#include <openvino/opsets/opset1.hpp>
+#include <openvino/opsets/opset8.hpp>
+#include <openvino/pass/manager.hpp>
+#include <transformations/cpu_opset/common/pass/depth_first_tiling.hpp>
+#include <transformations/init_node_info.hpp>
+#include "common_test_utils/ngraph_test_utils.hpp"
+
+using namespace testing;
+using namespace ov::intel_cpu;
+
+namespace {
+std::shared_ptr<ov::Model> makeConvChain(const ov::Shape& inputShape) {
+    const auto input = std::make_shared<ov::opset1::Parameter>(ov::element::f32, inputShape);
+    const size_t channels = inputShape[1];
+    const auto weights1 = ov::opset1::Constant::create(ov::element::f32, ov::Shape{channels, channels, 3, 3}, {0.1f});
+    const auto conv1 = std::make_shared<ov::opset1::Convolution>(input, weights1,
+                                                                 ov::Strides{1, 1}, ov::CoordinateDiff{1, 1},
+                                                                 ov::CoordinateDiff{1, 1}, ov::Strides{1, 1});
+    const auto relu = std::make_shared<ov::opset1::Relu>(conv1);
+    const auto weights2 = ov::opset1::Constant::create(ov::element::f32, ov::Shape{channels, channels, 3, 3}, {0.2f});
+    const auto conv2 = std::make_shared<ov::opset1::Convolution>(relu, weights2,
+                                                                 ov::Strides{1, 1}, ov::CoordinateDiff{1, 1},
+                                                                 ov::CoordinateDiff{1, 1}, ov::Strides{1, 1});
+    conv2->set_friendly_name("conv2");
+    return std::make_shared<ov::Model>(ov::NodeVector{conv2}, ov::ParameterVector{input});
+}
+
+size_t countOps(const std::shared_ptr<ov::Model>& model, const ov::NodeTypeInfo& type) {
+    size_t count = 0;
+    for (const auto& op : model->get_ops()) {
+        count += op->get_type_info() == type ? 1 : 0;
+    }
+    return count;
+}
+
+void runTiling(const std::shared_ptr<ov::Model>& model, size_t cacheBudget) {
+    ov::pass::Manager m;
+    m.register_pass<ov::pass::InitNodeInfo>();
+    m.register_pass<DepthFirstTiling>(cacheBudget);
+    m.run_passes(model);
+}
+}  // namespace
+
+TEST(TransformationTests, DepthFirstTilingSplitsConvChain) {
+    const ov::Shape shape{1, 16, 128, 128};
+    const auto model = makeConvChain(shape);
+    // untiled intermediates of a convolution take 2MB
+    runTiling(model, 1200 * 1024);
+
+    EXPECT_EQ(countOps(model, ov::opset8::Slice::get_type_info_static()), 2);
+    EXPECT_EQ(countOps(model, ov::opset1::Convolution::get_type_info_static()), 4);
+    EXPECT_EQ(countOps(model, ov::opset1::Relu::get_type_info_static()), 2);
+
+    const auto result = model->get_results()[0]->get_input_node_shared_ptr(0);
+    ASSERT_TRUE(ov::is_type<ov::opset1::Concat>(result));
+    EXPECT_EQ(result->get_friendly_name(), "conv2");
+    EXPECT_EQ(result->get_output_shape(0), shape);
+    for (const auto& input : result->input_values()) {
+        EXPECT_EQ(input.get_shape(), (ov::Shape{1, 16, 64, 128}));
+    }
+}
+
+TEST(TransformationTests, DepthFirstTilingSkipsChainFittingCache) {
+    const auto model = makeConvChain(ov::Shape{1, 16, 128, 128});
+    runTiling(model, 4 * 1024 * 1024);
+
+    EXPECT_EQ(countOps(model, ov::opset8::Slice::get_type_info_static()), 0);
+    EXPECT_EQ(countOps(model, ov::opset1::Convolution::get_type_info_static()), 2);
+}
+
+TEST(TransformationTests, DepthFirstTilingSkipsSingleConv) {
+    const auto input = std::make_shared<ov::opset1::Parameter>(ov::element::f32, ov::Shape{1, 16, 128, 128});
+    const auto weights = ov::opset1::Constant::create(ov::element::f32, ov::Shape{16, 16, 3, 3}, {0.1f});
+    const auto conv = std::make_shared<ov::opset1::Convolution>(input, weights,
+                                                                ov::Strides{1, 1}, ov::CoordinateDiff{1, 1},
+                                                                ov::CoordinateDiff{1, 1}, ov::Strides{1, 1});
+    const auto relu = std::make_shared<ov::opset1::Relu>(conv);
+    const auto model = std::make_shared<ov::Model>(ov::NodeVector{relu}, ov::ParameterVector{input});
+    runTiling(model, 64 * 1024);
+
+    EXPECT_EQ(countOps(model, ov::opset8::Slice::get_type_info_static()), 0);
+}
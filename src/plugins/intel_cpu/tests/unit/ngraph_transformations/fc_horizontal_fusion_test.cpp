@@ -0,0 +1,101 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include <string>
+#include <memory>
+
+#include <openvino/opsets/opset1.hpp>
+#include <transformations/cpu_opset/common/op/fully_connected.hpp>
+#include <transformations/cpu_opset/common/pass/fc_horizontal_fusion.hpp>
+
+#include "common_test_utils/ngraph_test_utils.hpp"
+
+using namespace testing;
+using namespace ov::intel_cpu;
+
+TEST_F(TransformationTestsF, FullyConnectedHorizontalFusionQKV) {
+    {
+        auto input = std::make_shared<ov::opset1::Parameter>(ov::element::f32, ov::PartialShape{-1, -1, 16});
+        ov::NodeVector outputs;
+        for (size_t i = 0; i < 3; i++) {
+            const float value = static_cast<float>(i + 1);
+            auto weights = ov::opset1::Constant::create(ov::element::f32, ov::Shape{8, 16}, {value});
+            auto bias = ov::opset1::Constant::create(ov::element::f32, ov::Shape{8}, {value});
+            auto fc = std::make_shared<FullyConnectedNode>(input, weights, bias, ov::Rank(3));
+            auto scale = ov::opset1::Constant::create(ov::element::f32, ov::Shape{1, 1, 1}, {value});
+            auto mul = std::make_shared<ov::opset1::Multiply>(fc, scale);
+            outputs.push_back(std::make_shared<ov::opset1::Relu>(mul));
+        }
+        function = std::make_shared<ov::Model>(outputs, ov::ParameterVector{input});
+        manager.register_pass<FullyConnectedHorizontalFusion>();
+    }
+    {
+        auto input = std::make_shared<ov::opset1::Parameter>(ov::element::f32, ov::PartialShape{-1, -1, 16});
+        std::vector<float> weightsValues, biasValues, scaleValues;
+        for (size_t i = 0; i < 3; i++) {
+            const float value = static_cast<float>(i + 1);
+            weightsValues.insert(weightsValues.end(), 8 * 16, value);
+            biasValues.insert(biasValues.end(), 8, value);
+            scaleValues.insert(scaleValues.end(), 8, value);
+        }
+        auto weights = ov::opset1::Constant::create(ov::element::f32, ov::Shape{24, 16}, weightsValues);
+        auto bias = ov::opset1::Constant::create(ov::element::f32, ov::Shape{24}, biasValues);
+        auto fc = std::make_shared<FullyConnectedNode>(input, weights, bias, ov::Rank(3));
+        auto scale = ov::opset1::Constant::create(ov::element::f32, ov::Shape{1, 1, 24}, scaleValues);
+        auto mul = std::make_shared<ov::opset1::Multiply>(fc, scale);
+        auto axis = ov::opset1::Constant::create(ov::element::i64, ov::Shape{}, {2});
+        auto lengths = ov::opset1::Constant::create(ov::element::i64, ov::Shape{3}, {8, 8, 8});
+        auto split = std::make_shared<ov::opset1::VariadicSplit>(mul, axis, lengths);
+        ov::NodeVector outputs;
+        for (size_t i = 0; i < 3; i++) {
+            outputs.push_back(std::make_shared<ov::opset1::Relu>(split->output(i)));
+        }
+        function_ref = std::make_shared<ov::Model>(outputs, ov::ParameterVector{input});
+    }
+    comparator.enable(FunctionsComparator::CmpValues::CONST_VALUES);
+}
+
+TEST_F(TransformationTestsF, FullyConnectedHorizontalFusionDifferentTails) {
+    {
+        auto input = std::make_shared<ov::opset1::Parameter>(ov::element::f32, ov::Shape{1, 16});
+        auto weights1 = ov::opset1::Constant::create(ov::element::f32, ov::Shape{32, 16}, {1.f});
+        auto fc1 = std::make_shared<FullyConnectedNode>(input, weights1, ov::Rank(2));
+        auto gate = std::make_shared<ov::opset1::Sigmoid>(fc1);
+        auto weights2 = ov::opset1::Constant::create(ov::element::f32, ov::Shape{32, 16}, {2.f});
+        auto fc2 = std::make_shared<FullyConnectedNode>(input, weights2, ov::Rank(2));
+        auto mul = std::make_shared<ov::opset1::Multiply>(gate, fc2);
+        auto relu = std::make_shared<ov::opset1::Relu>(mul);
+        function = std::make_shared<ov::Model>(ov::NodeVector{relu}, ov::ParameterVector{input});
+        manager.register_pass<FullyConnectedHorizontalFusion>();
+    }
+    {
+        auto input = std::make_shared<ov::opset1::Parameter>(ov::element::f32, ov::Shape{1, 16});
+        std::vector<float> weightsValues(32 * 16, 1.f);
+        weightsValues.insert(weightsValues.end(), 32 * 16, 2.f);
+        auto weights = ov::opset1::Constant::create(ov::element::f32, ov::Shape{64, 16}, weightsValues);
+        auto fc = std::make_shared<FullyConnectedNode>(input, weights, ov::Rank(2));
+        auto axis = ov::opset1::Constant::create(ov::element::i64, ov::Shape{}, {1});
+        auto lengths = ov::opset1::Constant::create(ov::element::i64, ov::Shape{2}, {32, 32});
+        auto split = std::make_shared<ov::opset1::VariadicSplit>(fc, axis, lengths);
+        auto gate = std::make_shared<ov::opset1::Sigmoid>(split->output(0));
+        auto mul = std::make_shared<ov::opset1::Multiply>(gate, split->output(1));
+        auto relu = std::make_shared<ov::opset1::Relu>(mul);
+        function_ref = std::make_shared<ov::Model>(ov::NodeVector{relu}, ov::ParameterVector{input});
+    }
+    comparator.enable(FunctionsComparator::CmpValues::CONST_VALUES);
+}
+
+TEST_F(TransformationTestsF, FullyConnectedHorizontalFusionKeepsModelOutputs) {
+    {
+        auto input = std::make_shared<ov::opset1::Parameter>(ov::element::f32, ov::Shape{1, 16});
+        auto weights1 = ov::opset1::Constant::create(ov::element::f32, ov::Shape{32, 16}, {1.f});
+        auto fc1 = std::make_shared<FullyConnectedNode>(input, weights1, ov::Rank(2));
+        auto weights2 = ov::opset1::Constant::create(ov::element::f32, ov::Shape{32, 16}, {2.f});
+        auto fc2 = std::make_shared<FullyConnectedNode>(input, weights2, ov::Rank(2));
+        function = std::make_shared<ov::Model>(ov::NodeVector{fc1, fc2}, ov::ParameterVector{input});
+        manager.register_pass<FullyConnectedHorizontalFusion>();
+    }
+}
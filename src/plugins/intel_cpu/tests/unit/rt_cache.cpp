@@ -379,3 +379,43 @@ TEST(MultiCacheTests, SmokeTypeIdSync) {
         vecThreads.emplace_back(std::thread(testRoutine, std::ref(vecCache[i])));
     }
 }
+
+TEST(MultiCacheTests, SmokeSharedCache) {
+    using IntValueType = std::shared_ptr<int>;
+    using StrValueType = std::shared_ptr<std::string>;
+
+    constexpr int capacity = 10;
+    constexpr size_t numThreads = 30;
+    constexpr int attempts = 100;
+
+    auto intBuilder = [&](const IntKey& key) { return std::make_shared<int>(key.data); };
+    auto strBuilder = [&](const StringKey& key) { return std::make_shared<std::string>(key.data); };
+
+    // the threads share the cache like the nodes creating their primitives in parallel
+    MultiCache cache(capacity);
+
+    auto testRoutine = [&](size_t threadId) {
+        for (int i = 0; i < attempts; ++i) {
+            const int key = static_cast<int>((threadId + i) % (2 * capacity));
+            auto intResult = cache.getOrCreate(IntKey{key}, intBuilder);
+            ASSERT_NE(intResult.first, IntValueType());
+            ASSERT_EQ(*intResult.first, key);
+            auto strResult = cache.getOrCreate(StringKey{std::to_string(key)}, strBuilder);
+            ASSERT_NE(strResult.first, StrValueType());
+            ASSERT_EQ(*strResult.first, std::to_string(key));
+        }
+    };
+
+    {
+        std::vector<ScopedThread> vecThreads;
+        vecThreads.reserve(numThreads);
+        for (size_t i = 0; i < numThreads; ++i) {
+            vecThreads.emplace_back(std::thread(testRoutine, i));
+        }
+    }
+
+    for (int i = capacity; i < 2 * capacity; ++i) {
+        auto intResult = cache.getOrCreate(IntKey{i}, intBuilder);
+        ASSERT_EQ(*intResult.first, i);
+    }
+}
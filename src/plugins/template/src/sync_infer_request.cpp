@@ -11,6 +11,7 @@
 #include <utility>
 
 #include "itt.hpp"
+#include "ngraph/runtime/reference/utils/parallel.hpp"
 #include "openvino/core/except.hpp"
 #include "openvino/op/util/variable_context.hpp"
 #include "openvino/runtime/ivariable_state.hpp"
@@ -206,6 +207,8 @@ void ov::template_plugin::InferRequest::infer_preprocess() {
 void ov::template_plugin::InferRequest::start_pipeline() {
     OV_ITT_SCOPED_TASK(itt::domains::TemplatePlugin, m_profiling_task[StartPipeline])
     auto start = Time::now();
+    // the reference kernels split the heavy ops between the threads of the stream
+    ngraph::runtime::reference::ParallelScope parallel_scope;
     m_executable->call(m_backend_output_tensors,
                        m_backend_input_tensors,
                        m_eval_context,
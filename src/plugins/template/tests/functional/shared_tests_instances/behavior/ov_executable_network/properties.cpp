@@ -4,6 +4,8 @@
 
 #include "behavior/compiled_model/properties.hpp"
 
+#include "ngraph_functions/subgraph_builders.hpp"
+#include "openvino/runtime/auto/properties.hpp"
 #include "openvino/runtime/properties.hpp"
 
 using namespace ov::test::behavior;
@@ -115,4 +117,32 @@ INSTANTIATE_TEST_SUITE_P(smoke_OVClassCompiledModelGetPropertyTest,
                          OVClassCompiledModelGetPropertyTest_EXEC_DEVICES,
                          ::testing::ValuesIn(GetMetricTest_ExecutionDevice_TEMPLATE));
 
+#ifdef ENABLE_INTEL_CPU
+TEST(smoke_AutoLatencyAwareRouting, RequestsAreRoutedToBothDevices) {
+    ov::Core core;
+    auto model = ngraph::builder::subgraph::makeConvPoolRelu();
+    auto compiledModel = core.compile_model(
+        model,
+        CommonTestUtils::DEVICE_AUTO,
+        ov::device::priorities(CommonTestUtils::DEVICE_TEMPLATE, CommonTestUtils::DEVICE_CPU),
+        ov::hint::performance_mode(ov::hint::PerformanceMode::CUMULATIVE_THROUGHPUT),
+        ov::intel_auto::enable_latency_aware_routing(true),
+        ov::intel_auto::request_deadline(1000));
+    std::vector<ov::InferRequest> requests;
+    for (size_t i = 0; i < 8; i++)
+        requests.push_back(compiledModel.create_infer_request());
+    for (size_t iteration = 0; iteration < 10; iteration++) {
+        for (auto& request : requests)
+            request.start_async();
+        for (auto& request : requests)
+            request.wait();
+    }
+    auto stats = compiledModel.get_property(ov::intel_auto::routing_stats);
+    // both devices are probed, the rest requests go to the one with the earliest expected completion
+    EXPECT_NE(stats.find("\"TEMPLATE\":{"), std::string::npos) << stats;
+    EXPECT_NE(stats.find("\"CPU\":{"), std::string::npos) << stats;
+    EXPECT_NE(stats.find("\"in_flight\":0"), std::string::npos) << stats;
+}
+#endif
+
 }  // namespace